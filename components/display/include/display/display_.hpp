@@ -14,9 +14,14 @@
 #include "esp_check.h"
 
 #include "system_.hpp"
+#include "system_slab.hpp"
 #include "nvs/nvs_.hpp"
 
 #include "logging/logging_.hpp"
+#include "logging/logging_heap.hpp"
+#include "logging/logging_tasks.hpp"
+#include "logging/logging_latency.hpp"
+#include "logging/logging_trace.hpp"
 #include "diagnostics/diagnostics_.hpp"
 
 /* Forward Declarations */
@@ -34,12 +39,17 @@ extern "C"
         TaskHandle_t &getRunTaskHandle(void);    // Typically, these unsafe functions are
         QueueHandle_t &getCmdRequestQueue(void); // called at object creation and only once.
 
+        DISPLAY_CmdRequest *claimCmdRequest(void);             // A request slot, released by us once serviced.  nullptr if all are in flight.
+        bool sendCmdRequest(DISPLAY_CmdRequest *, TickType_t); // Stamps and queues a request
+
     private:
+        static constexpr esp_log_level_t logLevelCompiled = DISPLAY_LOG_LEVEL_COMPILED;
         char TAG[6] = "_disp";
 
         /* Object References */
         System *sys = nullptr;
         NVS *nvs = nullptr;
+        Bus *bus = nullptr;
 
         /* Taks Handles that we might need */
         TaskHandle_t taskHandleSystemRun = nullptr;
@@ -62,8 +72,14 @@ extern "C"
         
         TaskHandle_t taskHandleRun = nullptr;
 
-        QueueHandle_t queueCmdRequests = nullptr;           // DISPLAY <-- (Incomming commands arrive here)
-        DISPLAY_CmdRequest *ptrDisplayCmdRequest = nullptr; //
+        QueueHandle_t queueCmdRequests = nullptr;                        // DISPLAY <-- (Incomming commands arrive here)
+        SYS_Slab<DISPLAY_CmdRequest, DISPLAY_REQUEST_SLOTS> cmdRequests; // Lent to our callers
+        DISPLAY_CmdRequest *ptrDisplayCmdRequest = nullptr;              // The request being serviced
+
+        QueueHandle_t queueBusMessages = nullptr; // DISPLAY <-- (Connectivity and TimeValid from the Bus)
+        BUS_Message *ptrBusMessage = nullptr;     //
+        int8_t busSubscription = -1;              //
+        void runBusMessages(void);
 
         /* Display RUN */
         static void runMarshaller(void *);
@@ -1,6 +1,17 @@
 #pragma once
 #include "display/display_enums.hpp" // Local definitions, structs, and enumerations
 
+/* Compile Time Log Level */
+#ifndef DISPLAY_LOG_LEVEL_COMPILED
+#define DISPLAY_LOG_LEVEL_COMPILED ESP_LOG_INFO // Log sites above this level are left out of the build
+#endif
+
+/* Command Requests */
+#define DISPLAY_REQUEST_SLOTS 2 // Requests which may be in flight at once.  The request queue is this deep.
+
+/* Message Bus */
+#define DISPLAY_BUS_QUEUE_DEPTH 4 // Bus messages waiting for the run loop
+
 /* showDisplay */
 #define _showDisplay_SomeItem 0x01 // LSB
 #define _showDisplayShdnSteps 0x02
\ No newline at end of file
@@ -3,23 +3,28 @@
 #include <stdint.h> // Standard libraries
 #include <string>
 
+#include "logging/logging_latency.hpp" // LOG_LatencyStamp
+
 /* Run Notifications and Commands */
 // Task Notifications should be used for notifications or commands which need no input and return no data.
-enum class DISPLAY_NOTIFY : uint8_t
+enum class DISPLAY_NOTIFY : uint8_t // Bits, sent with eSetBits
 {
-    NFY_EMPTY = 1, // NFY are notifications
-    CMD_EMPTY,     // CMD are very simple commands without parameters
-    CMD_LOG_TASK_INFO,
-    CMD_SHUT_DOWN,
+    NFY_EMPTY = 0x01, // NFY are notifications
+    CMD_EMPTY = 0x02, // CMD are very simple commands without parameters
+    CMD_LOG_TASK_INFO = 0x04,
+    CMD_SHUT_DOWN = 0x08,
+    NFY_BUS_MESSAGE = 0x10, // The Bus put a message in queueBusMessages
 };
 
 enum class DISPLAY_COMMAND : uint8_t; // Forware Declaration
 
 struct DISPLAY_CmdRequest // The expected format of any incoming command
 {
+    uint32_t correlationId;  // Set by Display::claimCmdRequest()
     DISPLAY_COMMAND command; //
     uint8_t data[32];        //
     uint8_t dataLength;      //
+    LOG_LatencyStamp stamp;  // Set by LOG_Latency::stampEnqueue() just before sending
 };
 
 // Queue based commands should be used for commands which may provide input and perhaps return data.
@@ -27,6 +32,7 @@ enum class DISPLAY_COMMAND : uint8_t
 {
     NONE = 0,
     DO_SOMETHING = 0,
+    SET_SHOW_FLAGS, // data[0] = show, data[1] = showDisplay.  Only log sites built under DISPLAY_LOG_LEVEL_COMPILED can be shown.
 };
 
 /* Class Operations */
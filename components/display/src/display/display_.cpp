@@ -34,6 +34,9 @@ Display::Display() : Logging(), Diagnostics()
         xSemaphoreGive(semSysEntry);
     }
 
+    if (bus == nullptr)
+        bus = Bus::getInstance();
+
     setFlags();                // Enable logging statements for any area of concern.
     setLogLevels();            // Manually sets log levels for other tasks down the call stack.
     createSemaphores();        // Creates any locking semaphores owned by this object.
@@ -45,8 +48,9 @@ Display::Display() : Logging(), Diagnostics()
     dispInitStep = DISPLAY_INIT::Start; // Allow the object to initialize.  This may take some time.
     dispOP = DISPLAY_OP::Init;
 
-    logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): runStackSizek: " + std::to_string(runStackSizeK));
-    xTaskCreate(runMarshaller, "disp_run", 1024 * runStackSizeK, this, TASK_PRIORITY_MID, &taskHandleRun);
+    LOG_BY_VALUE(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): runStackSizek: " + std::to_string(runStackSizeK));
+    System::createTask(SYS_TASK::Display_Run, runMarshaller, "disp_run", &runStackSizeK, this, &taskHandleRun);
+    LOG_Tasks::registerTask(taskHandleRun, 1024 * runStackSizeK, &runStackSizeK, "display");
 }
 
 Display::~Display()
@@ -63,13 +67,13 @@ Display::~Display()
 
     // NOTE: The calling task can still send taskNotifications to the display task!  NOTE: We are accessing the task handle
     // in an unsafe way.
-    while (!xTaskNotify(taskHandleRun, static_cast<uint32_t>(DISPLAY_NOTIFY::CMD_SHUT_DOWN), eSetValueWithoutOverwrite))
-        vTaskDelay(pdMS_TO_TICKS(50)); // Wait for the notification to be received.
-    taskYIELD();                       // One last yield to make sure Idle task can run.
+    LOG_Latency::stampNotify(LOG_LAT_SOURCE::Display, static_cast<uint32_t>(DISPLAY_NOTIFY::CMD_SHUT_DOWN));
+    xTaskNotify(taskHandleRun, static_cast<uint32_t>(DISPLAY_NOTIFY::CMD_SHUT_DOWN), eSetBits);
+    taskYIELD(); // One last yield to make sure Idle task can run.
 
     while (taskHandleRun != nullptr)
         vTaskDelay(pdMS_TO_TICKS(50)); // Wait for the display task handle to become null.
-    taskYIELD();                       // One last yield to make sure Idle task can run.
+    taskYIELD(); // One last yield to make sure Idle task can run.
 
     xSemaphoreGive(semDisplayEntry); // Remember, this is the calling task which calls to "Give"
     destroySemaphores();
@@ -140,19 +144,19 @@ void Display::createQueues()
 
     if (queueCmdRequests == nullptr)
     {
-        queueCmdRequests = xQueueCreate(1, sizeof(DISPLAY_CmdRequest *)); // Initialize our Incoming Command Request Queue -- element is of size pointer
+        queueCmdRequests = xQueueCreate(DISPLAY_REQUEST_SLOTS, sizeof(DISPLAY_CmdRequest *)); // Deep enough for every slot we lend out -- element is of size pointer
         ESP_GOTO_ON_FALSE(queueCmdRequests, ESP_ERR_NO_MEM, display_createQueues_err, TAG, "IDF did not allocate memory for the command request queue.");
     }
 
-    if (ptrDisplayCmdRequest == nullptr)
+    if (queueBusMessages == nullptr)
     {
-        ptrDisplayCmdRequest = new DISPLAY_CmdRequest();
-        ESP_GOTO_ON_FALSE(ptrDisplayCmdRequest, ESP_ERR_NO_MEM, display_createQueues_err, TAG, "IDF did not allocate memory for the ptrDisplayCmdRequest structure.");
+        queueBusMessages = xQueueCreate(DISPLAY_BUS_QUEUE_DEPTH, sizeof(BUS_Message *));
+        ESP_GOTO_ON_FALSE(queueBusMessages, ESP_ERR_NO_MEM, display_createQueues_err, TAG, "IDF did not allocate memory for the bus message queue.");
     }
     return;
 
 display_createQueues_err:
-    logByValue(ESP_LOG_ERROR, semDisplayRouteLock, TAG, std::string(__func__) + "(): error: " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semDisplayRouteLock, TAG, std::string(__func__) + "(): error: " + esp_err_to_name(ret));
 }
 
 void Display::destroyQueues()
@@ -163,10 +167,12 @@ void Display::destroyQueues()
         queueCmdRequests = nullptr;
     }
 
-    if (ptrDisplayCmdRequest != nullptr)
+    ptrDisplayCmdRequest = nullptr; // Requests belong to cmdRequests or to the caller
+
+    if (queueBusMessages != nullptr) // The run loop unsubscribed on its way out
     {
-        delete ptrDisplayCmdRequest;
-        ptrDisplayCmdRequest = nullptr;
+        vQueueDelete(queueBusMessages);
+        queueBusMessages = nullptr;
     }
 }
 
@@ -180,3 +186,14 @@ QueueHandle_t &Display::getCmdRequestQueue()
 {
     return queueCmdRequests;
 }
+
+DISPLAY_CmdRequest *Display::claimCmdRequest(void)
+{
+    return cmdRequests.claim();
+}
+
+bool Display::sendCmdRequest(DISPLAY_CmdRequest *request, TickType_t ticksToWait)
+{
+    LOG_Latency::stampEnqueue(&request->stamp);
+    return xQueueSendToBack(queueCmdRequests, &request, ticksToWait);
+}
@@ -9,6 +9,8 @@ extern SemaphoreHandle_t semDisplayRouteLock;
 /* NVS */
 void Display::restoreVariablesFromNVS()
 {
+    LOG_TraceSpan span("Display::restoreVariablesFromNVS");
+
     esp_err_t ret = ESP_OK;
     bool successFlag = true;
     uint8_t temp = 0;
@@ -20,7 +22,7 @@ void Display::restoreVariablesFromNVS()
         ESP_GOTO_ON_ERROR(nvs->openNVSStorage("display"), display_restoreVariablesFromNVS_err, TAG, "nvs->openNVSStorage('display') failed");
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): display namespace start");
+        LOG_BY_VALUE(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): display namespace start");
 
     if (successFlag) // Restore runStackSizeK
     {
@@ -29,40 +31,40 @@ void Display::restoreVariablesFromNVS()
 
         if (ret == ESP_OK)
         {
-            if (temp > runStackSizeK) // Ok to use any value greater than the default size.
+            if ((temp != runStackSizeK) && LOG_Tasks::stackSizeKValid(temp, runStackSizeK)) // Written by the System stack tuner.  See LOG_Tasks::stackSizeKValid().
             {
                 runStackSizeK = temp;
                 ret = nvs->writeU8IntegerToNVS("runStackSizeK", runStackSizeK); // Over-write the value with the default minumum value.
             }
 
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): runStackSizeK       is " + std::to_string(runStackSizeK));
+                LOG_BY_VALUE(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): runStackSizeK       is " + std::to_string(runStackSizeK));
         }
 
         if (ret != ESP_OK)
         {
-            logByValue(ESP_LOG_ERROR, semDisplayRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore runStackSizeK");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semDisplayRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore runStackSizeK");
             successFlag = false;
         }
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): display namespace end");
+        LOG_BY_VALUE(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): display namespace end");
 
     if (successFlag)
     {
         if (show & _showNVS)
-            logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): Success");
+            LOG_BY_VALUE(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): Success");
     }
     else
-        logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): Failed");
+        LOG_BY_VALUE(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): Failed");
 
     nvs->closeNVStorage();
     xSemaphoreGive(semNVSEntry);
     return;
 
 display_restoreVariablesFromNVS_err:
-    logByValue(ESP_LOG_ERROR, semDisplayRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semDisplayRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
     xSemaphoreGive(semNVSEntry);
 }
 
@@ -83,38 +85,38 @@ void Display::saveVariablesToNVS()
         ESP_GOTO_ON_ERROR(nvs->openNVSStorage("display"), display_saveVariablesToNVS_err, TAG, "nvs->openNVSStorage('display') failed");
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): display namespace start");
+        LOG_BY_VALUE(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): display namespace start");
 
     if (successFlag) // Save runStackSizeK
     {
         if (nvs->writeU8IntegerToNVS("runStackSizeK", runStackSizeK) == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): runStackSizeK       = " + std::to_string(runStackSizeK));
+                LOG_BY_VALUE(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): runStackSizeK       = " + std::to_string(runStackSizeK));
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semDisplayRouteLock, TAG, std::string(__func__) + "(): Unable to writeU8IntegerToNVS runStackSizeK");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semDisplayRouteLock, TAG, std::string(__func__) + "(): Unable to writeU8IntegerToNVS runStackSizeK");
         }
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): display namespace end");
+        LOG_BY_VALUE(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): display namespace end");
 
     if (successFlag)
     {
         if (show & _showNVS)
-            logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): Success");
+            LOG_BY_VALUE(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): Success");
     }
     else
-        logByValue(ESP_LOG_ERROR, semDisplayRouteLock, TAG, std::string(__func__) + "(): Failed");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semDisplayRouteLock, TAG, std::string(__func__) + "(): Failed");
 
     nvs->closeNVStorage();
     xSemaphoreGive(semNVSEntry);
     return;
 
 display_saveVariablesToNVS_err:
-    logByValue(ESP_LOG_ERROR, semDisplayRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semDisplayRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
     xSemaphoreGive(semNVSEntry);
 }
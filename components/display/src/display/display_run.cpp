@@ -7,9 +7,11 @@ extern SemaphoreHandle_t semDisplayRouteLock;
 
 void Display::runMarshaller(void *arg)
 {
+    LOG_Heap::setTaskHeapTag(LOG_HEAP_TAG::Display);
     ((Display *)arg)->run();
-    vTaskDelete(NULL);
     ((Display *)arg)->taskHandleRun = nullptr; // This doesn't happen automatically but we look at this variable for validity, so set it to nullptr manually.
+    LOG_Tasks::unregisterTask(nullptr);
+    vTaskDelete(NULL);
 }
 
 void Display::run(void)
@@ -18,9 +20,12 @@ void Display::run(void)
     uint8_t cadenceTimeDelay = 250;
 
     DISPLAY_NOTIFY dispTaskNotifyValue = static_cast<DISPLAY_NOTIFY>(0);
+    uint32_t dispNotifyBits = 0;
 
     while (true)
     {
+        LOG_Tasks::heartbeat((uint8_t)dispOP, (dispOP == DISPLAY_OP::Idle) ? LOG_HEARTBEAT_IDLE_MS : LOG_HEARTBEAT_MS);
+
         //
         // In every pass, we examine Task Notifications and/or the Command Request Queue.  The extra bonus we get here is that this is our yield
         // time back to the scheduler.  We don't need to perform another yield anywhere else to cooperatively yield to the OS.
@@ -28,40 +33,56 @@ void Display::run(void)
         // cadenceTimeDelay for a Task Notification wait.  This permits us to reduce power consumption when we are not busy without sacrificing latentcy
         // when we are busy.  Relaxed schduling with 250mSec equates to about a 4Hz run() loop cadence.
         //
-        dispTaskNotifyValue = static_cast<DISPLAY_NOTIFY>(ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(cadenceTimeDelay)));
+        xTaskNotifyWait(0, UINT32_MAX, &dispNotifyBits, pdMS_TO_TICKS(cadenceTimeDelay)); // Notifications are bits.  We take all of them at once.
 
-        if (dispTaskNotifyValue > static_cast<DISPLAY_NOTIFY>(0)) // Looking for Task Notifications
+        if (dispNotifyBits != 0) // Looking for Task Notifications
         {
+            LOG_Latency::latencyNotified(LOG_LAT_SOURCE::Display, dispNotifyBits);
+
             // Task Notifications should be used for notifications (NFY_NOTIFICATION) or commands (CMD_COMMAND) both of which need no input and return no data.
-            switch (dispTaskNotifyValue)
-            {
-            case DISPLAY_NOTIFY::NFY_EMPTY: // Some of these notifications set Directive bits - a follow up CMD_RUN_DIRECTIVES task notification starts the action.
+            for (uint32_t pending = dispNotifyBits; pending != 0; pending &= (pending - 1)) // Lowest bit first
             {
-                if (show & _showRun)
-                    logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): Received DISPLAY_NOTIFY::NFY_EMPTY");
-                break;
-            }
+                dispTaskNotifyValue = static_cast<DISPLAY_NOTIFY>(pending & (~pending + 1));
 
-            case DISPLAY_NOTIFY::CMD_EMPTY:
-            {
-                if (show & _showRun)
-                    logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): Received DISPLAY_NOTIFY::CMD_EMPTY");
-                break;
-            }
+                switch (dispTaskNotifyValue)
+                {
+                case DISPLAY_NOTIFY::NFY_EMPTY: // Some of these notifications set Directive bits - a follow up CMD_RUN_DIRECTIVES task notification starts the action.
+                {
+                    if (show & _showRun)
+                        LOG_DEFERRED(ESP_LOG_INFO, semDisplayRouteLock, TAG, "Received DISPLAY_NOTIFY::NFY_EMPTY");
+                    break;
+                }
 
-            case DISPLAY_NOTIFY::CMD_LOG_TASK_INFO:
-            {
-                if (show & _showRun)
-                    logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): Received DISPLAY_NOTIFY::CMD_LOG_TASK_INFO");
-                break;
-            }
+                case DISPLAY_NOTIFY::CMD_EMPTY:
+                {
+                    if (show & _showRun)
+                        LOG_DEFERRED(ESP_LOG_INFO, semDisplayRouteLock, TAG, "Received DISPLAY_NOTIFY::CMD_EMPTY");
+                    break;
+                }
 
-            case DISPLAY_NOTIFY::CMD_SHUT_DOWN:
-            {
-                if (show & _showRun)
-                    logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): Received DISPLAY_NOTIFY::CMD_SHUT_DOWN");
-                break;
-            }
+                case DISPLAY_NOTIFY::CMD_LOG_TASK_INFO:
+                {
+                    if (show & _showRun)
+                        LOG_DEFERRED(ESP_LOG_INFO, semDisplayRouteLock, TAG, "Received DISPLAY_NOTIFY::CMD_LOG_TASK_INFO");
+                    break;
+                }
+
+                case DISPLAY_NOTIFY::CMD_SHUT_DOWN:
+                {
+                    if (show & _showRun)
+                        LOG_DEFERRED(ESP_LOG_INFO, semDisplayRouteLock, TAG, "Received DISPLAY_NOTIFY::CMD_SHUT_DOWN");
+
+                    dispShdnStep = DISPLAY_SHUTDOWN::Start;
+                    dispOP = DISPLAY_OP::Shutdown;
+                    break;
+                }
+
+                case DISPLAY_NOTIFY::NFY_BUS_MESSAGE:
+                {
+                    runBusMessages();
+                    break;
+                }
+                }
             }
         }
         else // If we don't have a Notification, then look for any Command Requests (thereby handling only one upon each run() loop entry)
@@ -69,11 +90,13 @@ void Display::run(void)
             // Queue based commands should be used for commands which provide input and optioanlly return data.   Use a notification if NO data is passed either way.
             if (xQueuePeek(queueCmdRequests, (void *)&ptrDisplayCmdRequest, 0)) // Do I have a command request in the queue?
             {
+                LOG_Latency::latencyDequeued(LOG_LAT_SOURCE::Display, (uint8_t)ptrDisplayCmdRequest->command, &ptrDisplayCmdRequest->stamp);
+
                 if (ptrDisplayCmdRequest != nullptr)
                 {
                     if (show & _showPayload)
                     {
-                        logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): cmd is  " + std::to_string((int)ptrDisplayCmdRequest->command));
+                        LOG_DEFERRED(ESP_LOG_INFO, semDisplayRouteLock, TAG, "cmd is  %d", (int)ptrDisplayCmdRequest->command);
                     }
                 }
 
@@ -82,12 +105,25 @@ void Display::run(void)
                 case DISPLAY_COMMAND::DO_SOMETHING:
                 {
                     if (show & _showRun)
-                        logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): Received the command DISPLAY_COMMAND::DO_SOMETHING");
+                        LOG_DEFERRED(ESP_LOG_INFO, semDisplayRouteLock, TAG, "Received the command DISPLAY_COMMAND::DO_SOMETHING");
                     saveVariablesToNVS(); // Can't afford a delay here.
                     break;
                 }
+
+                case DISPLAY_COMMAND::SET_SHOW_FLAGS:
+                {
+                    if (show & _showRun)
+                        LOG_DEFERRED(ESP_LOG_INFO, semDisplayRouteLock, TAG, "Received the command DISPLAY_COMMAND::SET_SHOW_FLAGS");
+
+                    show = ptrDisplayCmdRequest->data[0];
+                    showDisplay = ptrDisplayCmdRequest->data[1];
+                    setLogLevels();
+                    break;
+                }
                 }
+                LOG_Latency::latencyServiced(LOG_LAT_SOURCE::Display, (uint8_t)ptrDisplayCmdRequest->command, &ptrDisplayCmdRequest->stamp);
                 xQueueReceive(queueCmdRequests, (void *)&ptrDisplayCmdRequest, pdMS_TO_TICKS(0)); // Remove the item from the queue
+                cmdRequests.release(ptrDisplayCmdRequest);                                          // No response, so the slot is free again
             }
         }
 
@@ -106,9 +142,13 @@ void Display::run(void)
             case DISPLAY_SHUTDOWN::Start:
             {
                 if (showDisplay & _showDisplayShdnSteps)
-                    logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): DISPLAY_SHUTDOWN::Start");
+                    LOG_DEFERRED(ESP_LOG_INFO, semDisplayRouteLock, TAG, "DISPLAY_SHUTDOWN::Start");
 
                 cadenceTimeDelay = 10; // Always allow a bit of delay in Run processing.
+
+                bus->unsubscribe(busSubscription); // Releases anything we haven't read yet
+                busSubscription = -1;
+
                 dispShdnStep = DISPLAY_SHUTDOWN::Finished;
                 [[fallthrough]];
             }
@@ -116,7 +156,7 @@ void Display::run(void)
             case DISPLAY_SHUTDOWN::Finished:
             {
                 if (showDisplay & _showDisplayShdnSteps)
-                    logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): DISPLAY_SHUTDOWN::Finished");
+                    LOG_DEFERRED(ESP_LOG_INFO, semDisplayRouteLock, TAG, "DISPLAY_SHUTDOWN::Finished");
 
                 // This exits the run function. (notice how the compiler doesn't complain about a missing break statement)
                 // In the runMarshaller, the task is deleted and the task handler set to nullptr.
@@ -126,7 +166,7 @@ void Display::run(void)
             case DISPLAY_SHUTDOWN::Error:
             {
                 if (showDisplay & _showDisplayShdnSteps)
-                    logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): DISPLAY_SHUTDOWN::Error");
+                    LOG_DEFERRED(ESP_LOG_INFO, semDisplayRouteLock, TAG, "DISPLAY_SHUTDOWN::Error");
 
                 break;
             }
@@ -147,10 +187,15 @@ void Display::run(void)
             case DISPLAY_INIT::Start:
             {
                 if (show & _showInit)
-                    logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): DISPLAY_INIT::Start");
+                    LOG_DEFERRED(ESP_LOG_INFO, semDisplayRouteLock, TAG, "DISPLAY_INIT::Start");
 
                 cadenceTimeDelay = 10; // Don't permit scheduler delays in Run processing.
 
+                busSubscription = bus->subscribe(BUS_TOPIC_BIT(BUS_TOPIC::Connectivity) | BUS_TOPIC_BIT(BUS_TOPIC::TimeValid), queueBusMessages, taskHandleRun,
+                                                 static_cast<uint32_t>(DISPLAY_NOTIFY::NFY_BUS_MESSAGE));
+                if (busSubscription < 0)
+                    LOG_BY_VALUE(ESP_LOG_ERROR, semDisplayRouteLock, TAG, std::string(__func__) + "(): No free Bus subscriber slot");
+
                 dispInitStep = DISPLAY_INIT::Finished;
                 [[fallthrough]];
             }
@@ -158,7 +203,7 @@ void Display::run(void)
             case DISPLAY_INIT::Finished:
             {
                 if (show & _showInit)
-                    logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): DISPLAY_INIT::Finished");
+                    LOG_DEFERRED(ESP_LOG_INFO, semDisplayRouteLock, TAG, "DISPLAY_INIT::Finished");
 
                 cadenceTimeDelay = 250;          // Return to relaxed scheduling.
                 xSemaphoreGive(semDisplayEntry); // Allow entry from any other calling tasks
@@ -169,7 +214,7 @@ void Display::run(void)
             case DISPLAY_INIT::Error:
             {
                 if (show & _showInit)
-                    logByValue(ESP_LOG_INFO, semDisplayRouteLock, TAG, std::string(__func__) + "(): DISPLAY_INIT::Error");
+                    LOG_DEFERRED(ESP_LOG_INFO, semDisplayRouteLock, TAG, "DISPLAY_INIT::Error");
                 break;
             }
             }
@@ -180,7 +225,7 @@ void Display::run(void)
         {
             cadenceTimeDelay = 250; // Return to relaxed scheduling.
 
-            logByValue(ESP_LOG_ERROR, semDisplayRouteLock, TAG, "DISPLAY_OP::Error");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semDisplayRouteLock, TAG, "DISPLAY_OP::Error");
             dispOP = DISPLAY_OP::Idle;
             [[fallthrough]];
         }
@@ -193,4 +238,33 @@ void Display::run(void)
         }
         }
     }
-}
\ No newline at end of file
+}
+
+void Display::runBusMessages(void)
+{
+    while (xQueueReceive(queueBusMessages, &ptrBusMessage, 0)) // One wake may bring several messages
+    {
+        switch (ptrBusMessage->topic)
+        {
+        case BUS_TOPIC::Connectivity:
+        {
+            if (show & _showRun)
+                LOG_DEFERRED(ESP_LOG_INFO, semDisplayRouteLock, TAG, "Bus Connectivity %d (wifi state %d)", (int)ptrBusMessage->connectivity.connected,
+                             (int)ptrBusMessage->connectivity.wifiConnState);
+            break;
+        }
+
+        case BUS_TOPIC::TimeValid:
+        {
+            if (show & _showRun)
+                LOG_DEFERRED(ESP_LOG_INFO, semDisplayRouteLock, TAG, "Bus TimeValid %d", (int)ptrBusMessage->timeValid.valid);
+            break;
+        }
+
+        default:
+            break;
+        }
+
+        bus->release(ptrBusMessage);
+    }
+}
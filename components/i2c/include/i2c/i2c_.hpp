@@ -13,7 +13,13 @@
 #include "freertos/FreeRTOSConfig.h"
 
 #include "system_.hpp"
+#include "system_slab.hpp"
 #include "logging/logging_.hpp"
+#include "logging/logging_heap.hpp"
+#include "logging/logging_tasks.hpp"
+#include "logging/logging_latency.hpp"
+#include "logging/logging_telemetry.hpp"
+#include "logging/logging_trace.hpp"
 #include "diagnostics/diagnostics_.hpp"
 
 /* Forward Declarations */
@@ -30,6 +36,10 @@ extern "C"
         TaskHandle_t &getRunTaskHandle(void);
         QueueHandle_t &getCmdRequestQueue(void);
 
+        I2C_CmdRequest *claimCmdRequest(void);             // A request slot of our own.  nullptr if I2C_REQUEST_SLOTS are all in flight.
+        bool sendCmdRequest(I2C_CmdRequest *, TickType_t); // Stamps and queues a request
+        void releaseCmdRequest(I2C_CmdRequest *);          // Once its response has been read
+
         void busScan();
         bool slavePresent(uint8_t, int32_t);
 
@@ -37,6 +47,7 @@ extern "C"
         //
         // Private variables
         //
+        static constexpr esp_log_level_t logLevelCompiled = I2C_LOG_LEVEL_COMPILED;
         char TAG[6] = "_i2c ";
 
         /* Object References */
@@ -62,9 +73,10 @@ extern "C"
         //
         TaskHandle_t taskHandleRun = nullptr;
 
-        QueueHandle_t queueCmdRequests = nullptr;   // DISPLAY <-- (Incomming commands arrive here)
-        I2C_CmdRequest *ptrI2CCmdRequest = nullptr; //
-        I2C_CmdResponse *ptrI2CCmdResponse = nullptr;      //
+        QueueHandle_t queueCmdRequests = nullptr;                // I2C <-- (Incomming commands arrive here)
+        SYS_Slab<I2C_CmdRequest, I2C_REQUEST_SLOTS> cmdRequests; // Lent to our callers
+        I2C_CmdRequest *ptrI2CCmdRequest = nullptr;              // The request being serviced
+        I2C_CmdResponse *ptrI2CCmdResponse = nullptr;            // and the response inside it
 
         // QueueHandle_t xQueueI2CCmdRequests;
         // I2C_CmdRequest *ptrI2CCmdReq;
@@ -82,7 +94,7 @@ extern "C"
         uint32_t ticksToWait; // Timeout in ticks for read and write
 
         I2C_OP i2cOP = I2C_OP::Run;
-        I2C_INIT initI2CStep = I2C_INIT::Finished;
+        LOG_StateStep<I2C_INIT, LOG_MACHINE::I2C_Init> initI2CStep = I2C_INIT::Finished;
 
         //
         // Direct I2C functions
@@ -22,6 +22,14 @@ static const uint32_t defaultClockSpeed = 400000; // Clock speed in Hz, default:
 static const uint32_t defaultTimeout = 500;       // Timeout in milliseconds, default: 500ms
 
 
+/* Command Requests */
+#define I2C_REQUEST_SLOTS 4 // Requests which may be in flight at once.  The request queue is this deep.
+
+/* Compile Time Log Level */
+#ifndef I2C_LOG_LEVEL_COMPILED
+#define I2C_LOG_LEVEL_COMPILED ESP_LOG_INFO // Log sites above this level are left out of the build
+#endif
+
 /* showI2C */
 #define _showI2C_SomeItem 0x01 // LSB
 #define _showI2CShdnSteps 0x02
\ No newline at end of file
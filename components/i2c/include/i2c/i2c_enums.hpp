@@ -5,34 +5,40 @@
 #include "freertos/FreeRTOS.h" // RTOS Libraries
 #include "freertos/queue.h"
 
-enum class I2C_NOTIFY : uint32_t // Task Notification definitions for the Run loop
+#include "logging/logging_latency.hpp" // LOG_LatencyStamp
+
+enum class I2C_NOTIFY : uint32_t // Task Notification bits for the Run loop (sent with eSetBits)
 {
-    NFY_EMPTY = 1,     //
-    CMD_EMPTY,         // CMDs are very simple commands without parameters
-    CMD_LOG_TASK_INFO, // (Calls for an action but no data)
-    CMD_SHUT_DOWN,     //
+    NFY_EMPTY = 0x01,         //
+    CMD_EMPTY = 0x02,         // CMDs are very simple commands without parameters
+    CMD_LOG_TASK_INFO = 0x04, // (Calls for an action but no data)
+    CMD_SHUT_DOWN = 0x08,     //
 };
 
 enum class I2C_COMMAND : uint8_t; // Foreword declarations
 enum class I2C_RESPONSE : uint8_t;
 
-struct I2C_CmdRequest
+struct I2C_CmdResponse
 {
-    QueueHandle_t QueueToSendResponse; // 4 bytes.   If NULL, no response will be sent.
-    uint8_t busDevAddress;
-    I2C_COMMAND command;
+    uint32_t correlationId; // That of the request answered
+    I2C_RESPONSE response;
     uint8_t deviceRegister;
     uint8_t dataLength;
     uint8_t data[32];
-    bool debug = false;
 };
 
-struct I2C_CmdResponse
+struct I2C_CmdRequest
 {
-    I2C_RESPONSE response;
+    QueueHandle_t QueueToSendResponse; // 4 bytes.   If NULL, no response will be sent.
+    uint32_t correlationId;            // Set by I2C::claimCmdRequest()
+    uint8_t busDevAddress;
+    I2C_COMMAND command;
     uint8_t deviceRegister;
     uint8_t dataLength;
     uint8_t data[32];
+    bool debug = false;
+    LOG_LatencyStamp stamp;   // Set by LOG_Latency::stampEnqueue() just before sending
+    I2C_CmdResponse response; // Every request carries its own response.  A pointer to it is what goes back to the caller.
 };
 //
 // Request/Response
@@ -43,6 +49,7 @@ enum class I2C_COMMAND : uint8_t
     Write_Bytes_RegAddr,
     Read_Bytes_Immediate,
     Write_Bytes_Immediate,
+    Set_Show_Flags, // data[0] = show, data[1] = showI2C.  Only log sites built under I2C_LOG_LEVEL_COMPILED can be shown.
 };
 
 enum class I2C_RESPONSE : uint8_t
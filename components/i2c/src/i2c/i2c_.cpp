@@ -37,7 +37,8 @@ I2C::I2C()
     //
     i2cOP = I2C_OP::Init;
     initI2CStep = I2C_INIT::Start;
-    xTaskCreate(runMarshaller, "I2C::Run", 1024 * 3, this, 8, &taskHandleRun);
+    System::createTask(SYS_TASK::I2C_Run, runMarshaller, "I2C::Run", &runStackSizeK, this, &taskHandleRun);
+    LOG_Tasks::registerTask(taskHandleRun, 1024 * runStackSizeK);
 }
 
 I2C::~I2C()
@@ -53,13 +54,13 @@ I2C::~I2C()
     // 8) Done.
 
     // The calling task can still send taskNotifications to the indication task!
-    while (!xTaskNotify(taskHandleRun, static_cast<uint32_t>(I2C_NOTIFY::CMD_SHUT_DOWN), eSetValueWithoutOverwrite))
-        vTaskDelay(pdMS_TO_TICKS(50)); // Wait for the notification to be received.
-    taskYIELD();                       // One last yield to make sure Idle task can run.
+    LOG_Latency::stampNotify(LOG_LAT_SOURCE::I2C, static_cast<uint32_t>(I2C_NOTIFY::CMD_SHUT_DOWN));
+    xTaskNotify(taskHandleRun, static_cast<uint32_t>(I2C_NOTIFY::CMD_SHUT_DOWN), eSetBits);
+    taskYIELD(); // One last yield to make sure Idle task can run.
 
     while (taskHandleRun != nullptr)
         vTaskDelay(pdMS_TO_TICKS(50)); // Wait for the indication task handle to become null.
-    taskYIELD();                       // One last yield to make sure Idle task can run.
+    taskYIELD(); // One last yield to make sure Idle task can run.
 
     i2c_driver_delete(i2c_port);
 
@@ -131,25 +132,13 @@ void I2C::createQueues()
 
     if (queueCmdRequests == nullptr)
     {
-        queueCmdRequests = xQueueCreate(1, sizeof(I2C_CmdRequest *)); // Initialize our Incoming Command Request Queue -- element is of size pointer
+        queueCmdRequests = xQueueCreate(I2C_REQUEST_SLOTS, sizeof(I2C_CmdRequest *)); // Deep enough for every slot we lend out -- element is of size pointer
         ESP_GOTO_ON_FALSE(queueCmdRequests, ESP_ERR_NO_MEM, i2c_createQueues_err, TAG, "IDF did not allocate memory for the command request queue.");
     }
-
-    if (ptrI2CCmdRequest == nullptr)
-    {
-        ptrI2CCmdRequest = new I2C_CmdRequest();
-        ESP_GOTO_ON_FALSE(ptrI2CCmdRequest, ESP_ERR_NO_MEM, i2c_createQueues_err, TAG, "IDF did not allocate memory for the ptrI2CCmdRequest structure.");
-    }
-
-    if (ptrI2CCmdResponse == nullptr)
-    {
-        ptrI2CCmdResponse = new I2C_CmdResponse();
-        ESP_GOTO_ON_FALSE(ptrI2CCmdResponse, ESP_ERR_NO_MEM, i2c_createQueues_err, TAG, "IDF did not allocate memory for the ptrI2CCmdResponse structure.");
-    }
     return;
 
 i2c_createQueues_err:
-    logByValue(ESP_LOG_ERROR, semI2CRouteLock, TAG, std::string(__func__) + "(): error: " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semI2CRouteLock, TAG, std::string(__func__) + "(): error: " + esp_err_to_name(ret));
 }
 
 void I2C::destroyQueues()
@@ -160,17 +149,8 @@ void I2C::destroyQueues()
         queueCmdRequests = nullptr;
     }
 
-    if (ptrI2CCmdRequest != nullptr)
-    {
-        delete ptrI2CCmdRequest;
-        ptrI2CCmdRequest = nullptr;
-    }
-
-    if (ptrI2CCmdResponse != nullptr)
-    {
-        delete ptrI2CCmdResponse;
-        ptrI2CCmdResponse = nullptr;
-    }
+    ptrI2CCmdRequest = nullptr; // Requests belong to cmdRequests or to the caller
+    ptrI2CCmdResponse = nullptr;
 }
 
 /* Public Member Functions */
@@ -183,3 +163,19 @@ QueueHandle_t &I2C::getCmdRequestQueue(void) // Other items in the system need a
 {
     return queueCmdRequests;
 }
+
+I2C_CmdRequest *I2C::claimCmdRequest(void)
+{
+    return cmdRequests.claim();
+}
+
+bool I2C::sendCmdRequest(I2C_CmdRequest *request, TickType_t ticksToWait)
+{
+    LOG_Latency::stampEnqueue(&request->stamp);
+    return xQueueSendToBack(queueCmdRequests, &request, ticksToWait);
+}
+
+void I2C::releaseCmdRequest(I2C_CmdRequest *request)
+{
+    cmdRequests.release(request);
+}
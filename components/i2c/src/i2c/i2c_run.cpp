@@ -7,23 +7,46 @@ extern SemaphoreHandle_t semI2CRouteLock;
 
 void I2C::runMarshaller(void *arg)
 {
+    LOG_Heap::setTaskHeapTag(LOG_HEAP_TAG::I2C);
     ((I2C *)arg)->run();
-    vTaskDelete(NULL);
     ((I2C *)arg)->taskHandleRun = nullptr; // This doesn't happen automatically but we look at this variable for validity, so set it to nullptr manually.
+    LOG_Tasks::unregisterTask(nullptr);
+    vTaskDelete(NULL);
 }
 
 void I2C::run(void) // I2C processing lives here for the lifetime of the object
 {
     esp_err_t ret = ESP_OK;
+    uint32_t i2cNotifyBits = 0;
 
     while (true) // Process all incomeing I2C requests and return any results
     {
+        LOG_Tasks::heartbeat((uint8_t)i2cOP); // The Run state waits up to 1.5 seconds for a request
+
         switch (i2cOP)
         {
         case I2C_OP::Run:
         {
+            if (xTaskNotifyWait(0, UINT32_MAX, &i2cNotifyBits, 0)) // Notifications are bits.  Only CMD_SHUT_DOWN calls for any action.
+            {
+                LOG_Latency::latencyNotified(LOG_LAT_SOURCE::I2C, i2cNotifyBits);
+
+                if (i2cNotifyBits & static_cast<uint32_t>(I2C_NOTIFY::CMD_SHUT_DOWN))
+                {
+                    if (showRun)
+                        ESP_LOGI(TAG, "Received I2C_NOTIFY::CMD_SHUT_DOWN");
+                    return; // The destructor is waiting for taskHandleRun to become null
+                }
+            }
+
             if (xQueueReceive(queueCmdRequests, &ptrI2CCmdRequest, pdMS_TO_TICKS(1500))) // We wait here for each message
+            {
+                LOG_Latency::latencyDequeued(LOG_LAT_SOURCE::I2C, (uint8_t)ptrI2CCmdRequest->command, &ptrI2CCmdRequest->stamp);
+
+                ptrI2CCmdResponse = &ptrI2CCmdRequest->response; // Answered in place, so no caller can overwrite another's data
+                ptrI2CCmdResponse->correlationId = ptrI2CCmdRequest->correlationId;
                 i2cOP = I2C_OP::ReadWriteI2CBus;
+            }
 
             // By default, this is the correct processing path...
 
@@ -58,7 +81,6 @@ void I2C::run(void) // I2C processing lives here for the lifetime of the object
                 {
                     readBytesRegAddr(ptrI2CCmdRequest->busDevAddress, ptrI2CCmdRequest->deviceRegister, ptrI2CCmdRequest->dataLength, ptrI2CCmdResponse->data, defaultTimeout);
                 }
-                xQueueSendToBack(ptrI2CCmdRequest->QueueToSendResponse, &ptrI2CCmdResponse, 50);
                 i2cOP = I2C_OP::Run;
                 break;
             }
@@ -74,7 +96,6 @@ void I2C::run(void) // I2C processing lives here for the lifetime of the object
                 {
                     writeBytesRegAddr(ptrI2CCmdRequest->busDevAddress, ptrI2CCmdRequest->deviceRegister, ptrI2CCmdRequest->dataLength, ptrI2CCmdRequest->data, defaultTimeout);
                 }
-                xQueueSendToBack(ptrI2CCmdRequest->QueueToSendResponse, &ptrI2CCmdResponse, 50);
                 i2cOP = I2C_OP::Run;
                 break;
             }
@@ -91,9 +112,8 @@ void I2C::run(void) // I2C processing lives here for the lifetime of the object
                 }
                 else
                 {
-                    readBytesImmediate(ptrI2CCmdRequest->busDevAddress, ptrI2CCmdRequest->dataLength, ptrI2CCmdRequest->data, defaultTimeout);
+                    readBytesImmediate(ptrI2CCmdRequest->busDevAddress, ptrI2CCmdRequest->dataLength, ptrI2CCmdResponse->data, defaultTimeout);
                 }
-                xQueueSendToBack(ptrI2CCmdRequest->QueueToSendResponse, &ptrI2CCmdResponse, 50);
                 i2cOP = I2C_OP::Run;
                 break;
             }
@@ -109,11 +129,29 @@ void I2C::run(void) // I2C processing lives here for the lifetime of the object
                 {
                     writeBytesImmediate(ptrI2CCmdRequest->busDevAddress, ptrI2CCmdRequest->dataLength, ptrI2CCmdRequest->data, defaultTimeout);
                 }
-                xQueueSendToBack(ptrI2CCmdRequest->QueueToSendResponse, &ptrI2CCmdResponse, 50);
+                i2cOP = I2C_OP::Run;
+                break;
+            }
+
+            case I2C_COMMAND::Set_Show_Flags:
+            {
+                show = ptrI2CCmdRequest->data[0];
+                showI2C = ptrI2CCmdRequest->data[1];
+                showRun = ((show & _showRun) > 0);
+                showInitSteps = ((show & _showInit) > 0);
+                setLogLevels();
+
+                ptrI2CCmdResponse->response = I2C_RESPONSE::Returning_Ack;
+                ptrI2CCmdResponse->dataLength = 0;
                 i2cOP = I2C_OP::Run;
                 break;
             }
             }
+            LOG_Latency::latencyServiced(LOG_LAT_SOURCE::I2C, (uint8_t)ptrI2CCmdRequest->command, &ptrI2CCmdRequest->stamp); // Once the response goes out, the slot is the caller's
+
+            if ((ptrI2CCmdRequest->QueueToSendResponse == nullptr) ||                                            // Nobody is waiting to read a response,
+                (xQueueSendToBack(ptrI2CCmdRequest->QueueToSendResponse, &ptrI2CCmdResponse, 50) != pdTRUE)) // or it could not be sent and the caller will never
+                cmdRequests.release(ptrI2CCmdRequest);                                                       // see it.  Either way the slot is free again.
             break;
         }
 
@@ -178,7 +216,7 @@ void I2C::run(void) // I2C processing lives here for the lifetime of the object
     }
 
 i2c_I2C_run_err:
-    logByValue(ESP_LOG_ERROR, semI2CRouteLock, TAG, std::string(__func__) + "(): error: " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semI2CRouteLock, TAG, std::string(__func__) + "(): error: " + esp_err_to_name(ret));
 }
 
 void I2C::readBytesRegAddr(uint8_t devAddr, uint8_t regAddr, size_t length, uint8_t *data, int32_t timeout)
@@ -321,6 +359,8 @@ void I2C::writeBytesImmediate(uint8_t devAddr, size_t length, uint8_t *data, int
 //
 void I2C::busScan() // Scan the I2C bus looking for devices.
 {
+    LOG_TraceSpan span("I2C::busScan");
+
     // A scan is performed on the I2C bus looking for devices.  A table is written
     // to the serial output describing what devices(if any) were found.
     //
@@ -0,0 +1,208 @@
+#pragma once
+
+#include <stdint.h> // Standard libraries
+#include <string>
+#include <string_view>
+#include <atomic>
+#include <type_traits>
+
+#include "freertos/FreeRTOS.h" // RTOS Libraries
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/projdefs.h"
+
+#include "esp_log.h" // ESP libraries
+#include "esp_check.h"
+
+#include "logging/logging_limiter.hpp" // LOG_LIMITED() keeps a LOG_Limiter per site
+
+/* Log Ring */
+#define LOG_RING_SLOTS 32     // Slots per core.  Must be a power of 2.
+#define LOG_RING_MSG_SIZE 128 // Longer messages are truncated when they are copied into the ring.
+#define LOG_RING_CORES 2
+
+#define LOG_DRAINER_STACK_SIZE_K 4 // The network stream sends from the drainer task
+#define LOG_DRAINER_WAIT_MS 100 // Longest time the drainer sleeps if a producer notification is missed.
+
+/* Compile Time Log Gating */
+#ifndef LOG_LEVEL_COMPILED_DEFAULT
+#define LOG_LEVEL_COMPILED_DEFAULT ESP_LOG_INFO
+#endif
+
+//
+// Every class that logs carries a logLevelCompiled constant (see the *_LOG_LEVEL_COMPILED values in each *_defs.hpp file).
+// LOG_BY_VALUE() and LOG_DEFERRED() sites above that level sit in a discarded "if constexpr" branch, so their message text and
+// string building never reach the binary.  The runtime show flags (and each SET_SHOW_FLAGS command) only choose among the
+// sites which were built.
+//
+#define LOG_COMPILED(level) ((level) <= logLevelCompiled)
+
+#define LOG_BY_VALUE(level, semRouteLock, ourTAG, msg)       \
+    do                                                       \
+    {                                                        \
+        if constexpr (LOG_COMPILED(level))                   \
+            logByValue(level, semRouteLock, ourTAG, msg);    \
+    } while (0)
+
+//
+// LOG_PRINTF() is the allocation free way to log text.  The message is formatted into a LOG_RING_MSG_SIZE buffer on the caller's
+// stack (prefixed with "<function>(): ") and is never copied into a std::string.  Use it in place of std::string concatenation
+// anywhere a run loop may log while it is in its steady state.
+//
+// Example:  LOG_PRINTF(ESP_LOG_INFO, semSNTPRouteLock, TAG, "SNTP Server set to %s", serverName.c_str());
+//
+#define LOG_PRINTF(level, semRouteLock, ourTAG, format, ...)                                 \
+    do                                                                                       \
+    {                                                                                        \
+        if constexpr (LOG_COMPILED(level))                                                   \
+            logPrintf(level, semRouteLock, ourTAG, __func__, format, ##__VA_ARGS__);         \
+    } while (0)
+
+/* Deferred Logging */
+#define LOG_DEFERRED_MAX_ARGS 4
+#define LOG_BINARY_PREFIX "#LB" // Console lines starting with this are decoded on the host by tools/log_decoder.py
+
+//
+// LOG_DEFERRED() is the cheap way to log from a run loop.  The format string and __func__ stay in flash and only their
+// pointers and up to 4 integer arguments are copied into the log ring.  The drainer does the formatting later, or when binary
+// output is selected, sends only the message ID and raw arguments to the console.
+//
+// The message ID is an FNV-1a hash of "<source file name>|<format>" computed at compile time.  The host decoder builds the same
+// table by scanning the sources.
+//
+// Example:  LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_CONN::Wifi_Init - Step %d", (int)WIFI_CONN::Wifi_Init);
+//
+#define LOG_MSG_ID(format) (std::integral_constant<uint32_t, logMessageId(__FILE_NAME__ "|" format)>::value)
+
+#define LOG_DEFERRED(level, semRouteLock, ourTAG, format, ...)                                                         \
+    do                                                                                                                 \
+    {                                                                                                                  \
+        if constexpr (LOG_COMPILED(level))                                                                             \
+        {                                                                                                              \
+            if (false)                                                                                                 \
+                logFormatCheck(format, ##__VA_ARGS__); /* Lets the compiler check our arguments against the format */ \
+            uint32_t logWords[LOG_DEFERRED_MAX_ARGS] = {};                                                             \
+            uint8_t logWordCount = logPackArgs(logWords, ##__VA_ARGS__);                                               \
+            logDeferredWords(level, semRouteLock, ourTAG, __func__, LOG_MSG_ID(format), format, logWordCount, logWords); \
+        }                                                                                                              \
+    } while (0)
+
+//
+// LOG_LIMITED() is LOG_DEFERRED() with a token bucket and duplicate suppression for this one site.  Use it where a loop can
+// repeat the same message many times (countdowns, reconnect loops).  A message identical to the last one let through (same
+// format and arguments) is counted and dropped.  Other messages spend a token.  The next message let through is preceded by a
+// "last message repeated N times" line.  See LOG_RateLimit::printLogSuppression() for the totals.
+//
+#define LOG_LIMITED(level, semRouteLock, ourTAG, format, ...)                                                              \
+    do                                                                                                                     \
+    {                                                                                                                      \
+        if constexpr (LOG_COMPILED(level))                                                                                 \
+        {                                                                                                                  \
+            static LOG_Limiter logLimiter = {format}; /* One bucket per log site */                                        \
+            if (false)                                                                                                     \
+                logFormatCheck(format, ##__VA_ARGS__);                                                                     \
+            uint32_t logWords[LOG_DEFERRED_MAX_ARGS] = {};                                                                 \
+            uint8_t logWordCount = logPackArgs(logWords, ##__VA_ARGS__);                                                   \
+            if (logLimitAllow(&logLimiter, level, semRouteLock, ourTAG, __func__, LOG_MSG_ID(format), logWords))           \
+                logDeferredWords(level, semRouteLock, ourTAG, __func__, LOG_MSG_ID(format), format, logWordCount, logWords); \
+        }                                                                                                                  \
+    } while (0)
+
+constexpr uint32_t logMessageId(const char *text)
+{
+    uint32_t hash = 2166136261u; // FNV-1a 32 bit
+
+    while (*text != 0)
+    {
+        hash ^= (uint8_t)*text++;
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
+
+inline void logFormatCheck(const char *, ...) __attribute__((format(printf, 1, 2)));
+inline void logFormatCheck(const char *, ...) {}
+
+template <typename... Args>
+constexpr uint8_t logPackArgs(uint32_t *words, Args... args)
+{
+    static_assert(sizeof...(Args) <= LOG_DEFERRED_MAX_ARGS, "LOG_DEFERRED() takes at most LOG_DEFERRED_MAX_ARGS arguments");
+    static_assert(((std::is_integral_v<Args> || std::is_enum_v<Args>) && ...), "LOG_DEFERRED() only carries integer arguments");
+    static_assert(((sizeof(Args) <= sizeof(uint32_t)) && ...), "LOG_DEFERRED() arguments must fit in 32 bits.  Use LOG_PRINTF() for 64 bit values.");
+
+    uint8_t count = 0;
+    ((words[count++] = static_cast<uint32_t>(args)), ...);
+    return count;
+}
+
+struct LOG_Deferred
+{
+    uint32_t msgId;
+    const char *format; // Both of these point into flash
+    const char *func;   //
+    uint8_t argCount;
+    uint32_t args[LOG_DEFERRED_MAX_ARGS];
+};
+
+struct LOG_Record
+{
+    std::atomic<uint32_t> sequence; // Slot state.  Equal to the claim position when free, position + 1 when it holds a record.
+    uint32_t timeStamp;             // esp_log_timestamp() taken by the producer, so the console shows when the event happened.
+    esp_log_level_t level;
+    bool deferred; // Selects which member of the union is valid
+    char tag[6];
+    union
+    {
+        char msg[LOG_RING_MSG_SIZE];
+        LOG_Deferred bin;
+    };
+};
+
+struct LOG_Ring
+{
+    std::atomic<uint32_t> head;    // Next position to be claimed by any producer on this core
+    uint32_t tail;                 // Next position to be drained.  Only the drainer task touches this.
+    std::atomic<uint32_t> dropped; // Records lost because the ring was full
+    LOG_Record records[LOG_RING_SLOTS];
+};
+
+extern "C"
+{
+    class Logging
+    {
+    public:
+        Logging(){};
+        virtual ~Logging() = default; // Marks this class as abstract
+
+        static void startLogDrainer(UBaseType_t);  // Call once, early in startup.  Until then, logging is done synchronously.
+        static uint32_t getLogDroppedCount(void);  //
+        static void setLogBinaryOutput(bool);      // Deferred records are printed as LOG_BINARY_PREFIX lines for the host decoder
+
+    protected:
+        static constexpr esp_log_level_t logLevelCompiled = LOG_LEVEL_COMPILED_DEFAULT; // Each class replaces this with its own level
+        std::string errMsg = "";
+        void logByValue(esp_log_level_t, SemaphoreHandle_t, char[6], std::string_view); // A std::string argument is viewed, not copied
+        void logByValueLocked(esp_log_level_t, SemaphoreHandle_t, char[6], std::string_view);
+        void logPrintf(esp_log_level_t, SemaphoreHandle_t, char *, const char *, const char *, ...) __attribute__((format(printf, 6, 7)));
+        void logTaskInfo(SemaphoreHandle_t, char *);
+
+        void logDeferredWords(esp_log_level_t, SemaphoreHandle_t, char *, const char *, uint32_t, const char *, uint8_t, const uint32_t *);
+        bool logLimitAllow(LOG_Limiter *, esp_log_level_t, SemaphoreHandle_t, char *, const char *, uint32_t, const uint32_t *);
+
+    private:
+        static LOG_Ring logRing[LOG_RING_CORES];
+        static std::atomic<TaskHandle_t> taskHandleLogDrainer;
+        static std::atomic<bool> logBinaryOutput;
+
+        static LOG_Record *logRingClaim(uint32_t *);
+        static void logRingPublish(LOG_Record *, uint32_t);
+        static bool logRingPush(esp_log_level_t, const char *, std::string_view);
+        static bool logRingPeek(LOG_Ring *, LOG_Record **);
+        static void logRingRelease(LOG_Ring *);
+        static void logRecordWrite(LOG_Record *);
+        static void logDeferredFormat(char *, size_t, const char *, const uint32_t *);
+        static void runLogDrainer(void *);
+    };
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stdint.h> // Standard libraries
+#include <cstddef>
+#include <atomic>
+
+#include "freertos/FreeRTOS.h" // RTOS Libraries
+
+/* Heap Accounting */
+#define LOG_HEAP_TRACK_SLOTS 1024 // Live allocations followed while tracking is on.  Must be a power of 2.  8 bytes each, internal RAM.
+
+//
+// While heap tracking is on, every allocation is tagged with the component of the task (or LOG_HeapScope) that made it, and
+// every free is charged back to that same component, whichever task frees it.  That gives the bytes each component still holds.
+//
+enum class LOG_HEAP_TAG : uint8_t
+{
+    Other = 0, // IDF tasks, and anything outside a scope
+    System,
+    Wifi, // SNTP runs on the Wifi task
+    Prov,
+    Display,
+    I2C,
+    SPI,
+    NVS,
+    Count, // Keep this last
+};
+
+struct LOG_HeapTagStats
+{
+    int32_t bytes;  // Allocated minus freed since tracking began
+    int32_t blocks; //
+};
+
+struct LOG_HeapTrack
+{
+    void *ptr;
+    uint32_t size : 24;
+    uint32_t tag : 8;
+};
+
+struct LOG_HeapAllocStats // Filled in by the run() loops which prove their steady state is allocation free
+{
+    uint32_t quietPasses = 0; // Passes which handled no event, notification, or command and changed no state
+    uint32_t quietAllocs = 0; // Heap allocations made during those passes.  This should stay at zero.
+};
+
+extern "C"
+{
+    class LOG_Heap
+    {
+    public:
+        static uint32_t getTaskHeapAllocs(void); // Heap allocations made so far by the calling task.  Needs CONFIG_HEAP_USE_HOOKS, otherwise 0.
+        static uint32_t getLogHeapAllocs(void);  // Heap allocations made inside the logging calls themselves (all tasks)
+        static void countHeapAlloc(void);        // Called from the heap allocation hook only
+
+        static bool startHeapTracking(void);                         // Needs CONFIG_HEAP_USE_HOOKS.  Clears the per component counts.
+        static void stopHeapTracking(void);                          //
+        static void getHeapTagStats(LOG_HEAP_TAG, LOG_HeapTagStats *); //
+        static uint32_t getHeapUntracked(void);                      // Allocations missed because the table was full
+        static LOG_HEAP_TAG setTaskHeapTag(LOG_HEAP_TAG);            // Tags the calling task's allocations.  Returns the previous tag.
+        static void trackHeapAlloc(void *, size_t);                  // Called from the heap hooks only
+        static void trackHeapFree(void *);                           //
+
+    private:
+        static thread_local uint32_t taskHeapAllocs;
+        static std::atomic<uint32_t> logHeapAllocs;
+
+        static thread_local LOG_HEAP_TAG taskHeapTag;
+        static LOG_HeapTrack *heapTrack;
+        static std::atomic<bool> heapTracking;
+        static portMUX_TYPE heapTrackLock;
+        static LOG_HeapTagStats heapTagStats[(int)LOG_HEAP_TAG::Count];
+        static uint32_t heapUntracked;
+
+        friend class Logging; // Charges what its own calls allocate to logHeapAllocs
+    };
+}
+
+//
+// Tags the allocations of the calling task for as long as it is in scope, e.g. around "new Wifi()" made on the System task.
+//
+class LOG_HeapScope
+{
+public:
+    explicit LOG_HeapScope(LOG_HEAP_TAG tag) : previous(LOG_Heap::setTaskHeapTag(tag)) {}
+    ~LOG_HeapScope() { LOG_Heap::setTaskHeapTag(previous); }
+
+    LOG_HeapScope(const LOG_HeapScope &) = delete;
+    void operator=(const LOG_HeapScope &) = delete;
+
+private:
+    LOG_HEAP_TAG previous;
+};
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h> // Standard libraries
+#include <string_view>
+#include <atomic>
+
+#include "freertos/FreeRTOS.h" // RTOS Libraries
+
+#include "esp_log.h" // ESP libraries
+
+/* Error Journal */
+#define LOG_JOURNAL_SLOTS 16     // Must be a power of 2
+#define LOG_JOURNAL_MSG_SIZE 96  // Keeps a flash record (see SYS_JournalRecord) at 128 bytes
+#define LOG_JOURNAL_MAGIC 0x4A524E4C
+
+//
+// Every ERROR and WARN record is also copied into a small journal in RTC memory which is not cleared by a panic, watchdog or
+// brownout reset.  The System object flushes the journal in batches to the errlog flash partition and reads it back in
+// resetHandling() after an abnormal reset.
+//
+struct LOG_JournalEntry
+{
+    uint32_t timeStamp;
+    uint32_t check; // Lets us skip an entry that was only half written when the system went down
+    uint8_t level;
+    char tag[6];
+    char msg[LOG_JOURNAL_MSG_SIZE];
+};
+
+struct LOG_Journal
+{
+    uint32_t magic;
+    uint32_t head;    // Entries ever written.  head & (LOG_JOURNAL_SLOTS - 1) is the next slot.
+    uint32_t flushed; // Entries before this position are already in flash
+    uint32_t lost;    // Entries overwritten before they could be flushed
+    LOG_JournalEntry entries[LOG_JOURNAL_SLOTS];
+};
+
+extern "C"
+{
+    class LOG_ErrorJournal
+    {
+    public:
+        static bool initErrorJournal(void);                       // Returns true if the journal survived the last reset
+        static uint32_t getJournalHead(void);                     //
+        static uint32_t getJournalFlushed(void);                  //
+        static uint32_t getJournalLost(void);                     //
+        static bool getJournalEntry(uint32_t, LOG_JournalEntry *); // False if the entry was overwritten or is damaged
+        static void setJournalFlushed(uint32_t);                  //
+
+    private:
+        static LOG_Journal journal;
+        static portMUX_TYPE journalLock;
+        static std::atomic<bool> journalReady;
+
+        static uint32_t journalCheck(const LOG_JournalEntry *);
+        static void journalWrite(esp_log_level_t, const char *, std::string_view);
+
+        friend class Logging; // Every ERROR and WARN record is written here
+    };
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stdint.h> // Standard libraries
+#include <atomic>
+
+#include "freertos/FreeRTOS.h" // RTOS Libraries
+
+/* Latency Histograms */
+#define LOG_LATENCY_CHANNELS 24      // Distinct (source, path, code) combinations followed
+#define LOG_LATENCY_BUCKETS 80       // Four buckets per power of two.  The last one starts at about one second.
+#define LOG_LATENCY_NOTIFY_CODES 32  // Notification bits we can stamp per target
+
+//
+// Cross task latency.  Requests carry a LOG_LatencyStamp which the sender sets just before xQueueSend(); the receiver records
+// the wait in the queue when it takes the request and the service time when it is done with it.  Notifications can't carry a
+// stamp, so the sender stamps a per (target, value) slot instead, which the receiver clears when it takes the notification.
+//
+enum class LOG_LAT_SOURCE : uint8_t // The receiving object
+{
+    System = 0,
+    Wifi,
+    Display,
+    I2C,
+    SPI,
+    Count, // Keep this last
+};
+
+enum class LOG_LAT_PATH : uint8_t
+{
+    Queued = 0, // Enqueue to dequeue
+    Service,    // Dequeue to response (or done, for requests without a response)
+    Notify,     // Notify to handled
+    Count,      // Keep this last
+};
+
+struct LOG_LatencyStamp
+{
+    uint32_t enqueuedUs = 0; // Low 32 bits of esp_timer_get_time().  Zero means the sender didn't stamp the request.
+    uint32_t dequeuedUs = 0; //
+};
+
+struct LOG_LatencyHistogram // Log-linear, so each bucket is within 25% of its neighbours at any scale
+{
+    bool used;
+    LOG_LAT_SOURCE source;
+    LOG_LAT_PATH path;
+    uint8_t code; // The command or notification value
+    uint32_t count;
+    uint32_t maxUs;
+    uint16_t buckets[LOG_LATENCY_BUCKETS]; // All halved when one would overflow, so old samples fade
+};
+
+struct LOG_LatencySummary
+{
+    LOG_LAT_SOURCE source;
+    LOG_LAT_PATH path;
+    uint8_t code;
+    uint32_t count;
+    uint32_t p50Us; // Upper edge of the bucket holding the percentile
+    uint32_t p99Us; //
+    uint32_t maxUs; // Exact
+};
+
+extern "C"
+{
+    class LOG_Latency
+    {
+    public:
+        static void stampEnqueue(LOG_LatencyStamp *);                              // Just before the request is sent
+        static void latencyDequeued(LOG_LAT_SOURCE, uint8_t, LOG_LatencyStamp *);  // Receiver took the request (command code)
+        static void latencyServiced(LOG_LAT_SOURCE, uint8_t, LOG_LatencyStamp *);  // Receiver responded or finished
+        static void stampNotify(LOG_LAT_SOURCE, uint32_t);                         // Just before xTaskNotify() of one bit to the target
+        static void latencyNotified(LOG_LAT_SOURCE, uint32_t);                     // Target took these notification bits
+        static void recordLatency(LOG_LAT_SOURCE, LOG_LAT_PATH, uint8_t, uint32_t); //
+        static bool getLatencySummary(uint8_t, LOG_LatencySummary *);              // False for an unused channel
+        static void resetLatency(void);                                            //
+        static void printLatency(void);                                            //
+
+    private:
+        static LOG_LatencyHistogram latencyHistograms[LOG_LATENCY_CHANNELS];
+        static portMUX_TYPE latencyLock;
+        static std::atomic<uint32_t> latencyNotifyStamps[(int)LOG_LAT_SOURCE::Count][LOG_LATENCY_NOTIFY_CODES];
+    };
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdint.h> // Standard libraries
+#include <atomic>
+
+#include "freertos/FreeRTOS.h" // RTOS Libraries
+
+/* Rate Limiting */
+#define LOG_LIMIT_BURST 3               // Messages a site may send back to back
+#define LOG_LIMIT_PER_MINUTE 6          // Steady rate a site may send after its burst is used up
+#define LOG_LIMIT_REPEAT_REPORT_MS 30000 // An identical message still gets through this often, with its repeat count
+
+struct LOG_Limiter
+{
+    const char *format;      // Identifies the site in printLogSuppression()
+    bool primed;             // The bucket starts full on first use
+    uint32_t milliTokens;    // 1000 per message
+    uint32_t lastRefillMs;   //
+    uint32_t lastSentMs;     //
+    uint32_t lastHash;       // Message ID and arguments of the last message let through
+    uint32_t repeats;        // Identical messages dropped since the last one let through
+    uint32_t dropped;        // Messages dropped by the bucket since the last one let through
+    uint32_t totalRepeats;   // Lifetime counts for operators
+    uint32_t totalDropped;   //
+    LOG_Limiter *next;       // Sites register themselves on first use
+};
+
+extern "C"
+{
+    class LOG_RateLimit // The token buckets behind LOG_LIMITED()
+    {
+    public:
+        static uint32_t getLogSuppressedCount(void); // Everything LOG_LIMITED() has held back, all sites
+        static void printLogSuppression(void);      // Per site counts
+
+        static bool limitAllow(LOG_Limiter *, uint32_t, uint32_t *, uint32_t *); // Message hash in.  Repeats and drops to report out when allowed.
+
+    private:
+        static std::atomic<LOG_Limiter *> logLimiters;
+        static std::atomic<uint32_t> logSuppressed;
+        static portMUX_TYPE logLimiterLock;
+    };
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdint.h> // Standard libraries
+#include <atomic>
+
+/* Network Log Stream */
+#define LOG_STREAM_FRAME_SIZE 1400   // One UDP datagram.  Fits a 1500 byte Ethernet/Wifi MTU after the IP and UDP headers.
+#define LOG_STREAM_FLUSH_MS 1000     // A partly filled frame is sent once it is this old
+#define LOG_STREAM_METRICS_MS 10000  // How often a "#M" metrics line is added to the stream
+
+extern "C"
+{
+    class LOG_Stream
+    {
+    public:
+        static bool startLogStream(const char *, uint16_t); // Copy drained records to a UDP collector (IPv4 address, port)
+        static void stopLogStream(void);                    //
+        static uint32_t getLogStreamSentCount(void);        // Records which left in a frame
+        static uint32_t getLogStreamLostCount(void);        // Records lost because the link was down or busy
+
+    private:
+        static std::atomic<uint32_t> logStreamAddress; // IPv4 in network order.  Zero when no stream is wanted.
+        static std::atomic<uint16_t> logStreamPort;    //
+        static std::atomic<uint32_t> logStreamSent;    //
+        static std::atomic<uint32_t> logStreamLost;    //
+        static int logStreamSocket;                    // The remaining members belong to the drainer task alone
+        static uint32_t logStreamOpenAddress;          //
+        static uint16_t logStreamOpenPort;             //
+        static char logStreamFrame[LOG_STREAM_FRAME_SIZE];
+        static uint16_t logStreamLength;  //
+        static uint16_t logStreamRecords; // Records in the frame being filled
+        static uint32_t logStreamFrameMs; // When the first record went into the frame
+        static uint32_t logStreamMetricsMs;
+        static uint32_t logStreamLostReported;
+
+        static bool logStreamOpen(void);
+        static void logStreamAppend(const char *, int, bool);
+        static void logStreamFlush(void);
+        static void logStreamService(void);
+
+        friend class Logging; // The drainer feeds the stream
+    };
+}
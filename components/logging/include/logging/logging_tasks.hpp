@@ -0,0 +1,69 @@
+#pragma once
+
+#include <stdint.h> // Standard libraries
+
+#include "freertos/FreeRTOS.h" // RTOS Libraries
+#include "freertos/task.h"
+
+/* Task Registry */
+#define LOG_TASK_SLOTS 16            // Run tasks of our own objects.  The IDF tasks are looked up by name when printed.
+#define LOG_STACK_MARGIN_BYTES 1024  // Head room kept above the deepest stack use seen
+#define LOG_STACK_MIN_K 3            // Smallest stack the tuner will recommend
+#define LOG_STACK_MAX_K 32           // Largest stack the tuner will recommend, or an owner will restore from NVS
+#define LOG_STACK_TUNE_SAMPLES 60    // Samples needed before a stack may shrink.  System samples once a minute.
+
+#ifndef LOG_STACK_SHRINK
+#define LOG_STACK_SHRINK 0 // 1: The tuner may shrink a stack below its compiled default.  0: It only grows them.
+#endif
+
+/* Run Loop Heartbeats */
+#define LOG_HEARTBEAT_MS 3000      // Longest gap expected between two passes of a run loop
+#define LOG_HEARTBEAT_IDLE_MS 8000 // The same in an Idle state, which sleeps for 5 seconds a pass
+
+//
+// Each object registers its run task right after creating it.  The System object samples every stack high water mark once
+// a minute and, from the deepest use seen, recommends a runStackSizeK for the owner to restore from NVS on the next boot.
+//
+struct LOG_TaskEntry
+{
+    TaskHandle_t handle;
+    char name[configMAX_TASK_NAME_LEN]; // Copied, so a report never touches a task which has just been deleted
+    const char *nvsNamespace; // Where the owner keeps its stack size.  nullptr if the stack size is fixed.
+    const char *nvsKey;       // Usually "runStackSizeK"
+    uint8_t *stackSizeK;      // The owner's copy of the stack size.  nullptr if the stack size is fixed.
+    uint32_t stackBytes;      // Size the task was created with
+    uint32_t minFreeBytes;    // Lowest high water mark seen
+    uint32_t samples;         //
+    UBaseType_t priority;     // At the last sample
+
+    uint32_t beats;        // Passes of the run loop.  Zero for a task which doesn't call heartbeat(), which is not supervised.
+    int64_t lastBeatUs;    //
+    uint32_t maxPeriodMs;  // Longest gap expected before the next beat, given the state at the last one
+    uint32_t longestGapMs; // Between two beats, measured when the later one arrives
+    uint32_t stalls;       //
+    uint8_t state;         // The loop's _OP state at the last beat.  While stalled, the state it is stuck in.
+    bool stalled;          // Cleared by the next beat
+};
+
+extern "C"
+{
+    class LOG_Tasks
+    {
+    public:
+        static void registerTask(TaskHandle_t, uint32_t, uint8_t *stackSizeK = nullptr, const char *nvsNamespace = nullptr, const char *nvsKey = "runStackSizeK");
+        static void unregisterTask(TaskHandle_t);       // Before the task is deleted.  nullptr means the calling task.
+        static void sampleTaskStacks(void);             //
+        static bool getTaskEntry(uint8_t, LOG_TaskEntry *); // False for an empty slot
+        static uint8_t getTunedStackSizeK(const LOG_TaskEntry *); // 0 if the current size should stay
+        static bool stackSizeKValid(uint8_t, uint8_t);            // A size restored from NVS, against the compiled default
+        static void printTaskRegistry(void);            //
+
+        static void heartbeat(uint8_t, uint32_t maxPeriodMs = LOG_HEARTBEAT_MS); // Once at the top of every run loop pass, with the _OP state
+        static bool checkHeartbeat(uint8_t, int64_t, LOG_TaskEntry *);           // True once, when the loop in the slot is first seen stalled
+        static void printHeartbeats(void);                                       //
+
+    private:
+        static LOG_TaskEntry taskRegistry[LOG_TASK_SLOTS];
+        static portMUX_TYPE taskRegistryLock;
+    };
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <stdint.h> // Standard libraries
+
+#include "freertos/FreeRTOS.h" // RTOS Libraries
+
+/* State Transition Telemetry */
+#define LOG_TRANSITION_SLOTS 64 // Must be a power of 2
+
+//
+// State machines which are declared with LOG_StateStep<> (below) record every change of step into a shared ring, so the time
+// spent in any step can be measured in the field without turning on the show flags or verbose logging.
+//
+enum class LOG_MACHINE : uint8_t
+{
+    Sys_Init = 0,
+    Wifi_Conn,
+    Wifi_Disc,
+    Prov_Run,
+    SNTP_Conn,
+    I2C_Init,
+    Count, // Keep this last
+};
+
+struct LOG_Transition
+{
+    int64_t timeUs; // esp_timer_get_time() when the new step was entered
+    LOG_MACHINE machine;
+    uint8_t from;
+    uint8_t to;
+};
+
+extern "C"
+{
+    class LOG_Telemetry
+    {
+    public:
+        static void logTransition(LOG_MACHINE, uint8_t, uint8_t);                    // Called by LOG_StateStep<> on every change of step
+        static uint32_t getTransitionHead(void);                                      // Transitions ever recorded
+        static bool getTransition(uint32_t, LOG_Transition *);                        // False if the position was overwritten or not yet written
+        static int64_t getStateDuration(LOG_MACHINE, uint8_t, bool latest = true);    // Microseconds in a step, latest or longest stay.  -1 if unknown.
+        static void printTransitions(LOG_MACHINE, uint8_t);                           // Newest first
+        static const char *getMachineName(LOG_MACHINE);                               //
+
+    private:
+        static LOG_Transition transitions[LOG_TRANSITION_SLOTS];
+        static uint32_t transitionHead;
+        static portMUX_TYPE transitionLock;
+    };
+}
+
+//
+// A drop in replacement for a plain state machine step variable.  Reads, compares and switch statements work as before, but
+// every assignment which changes the step is recorded with LOG_Telemetry::logTransition().
+//
+template <typename STEP, LOG_MACHINE machine>
+class LOG_StateStep
+{
+public:
+    constexpr LOG_StateStep(STEP initial) : step(initial) {}
+
+    LOG_StateStep &operator=(STEP next)
+    {
+        if (next != step)
+            LOG_Telemetry::logTransition(machine, (uint8_t)step, (uint8_t)next);
+        step = next;
+        return *this;
+    }
+
+    constexpr operator STEP() const { return step; }
+
+private:
+    STEP step;
+};
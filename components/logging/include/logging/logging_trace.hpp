@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdint.h> // Standard libraries
+
+#include "freertos/FreeRTOS.h" // RTOS Libraries
+#include "freertos/task.h"
+
+/* Trace Spans */
+#define LOG_TRACE_SLOTS 128 // Must be a power of 2.  20 bytes each.
+
+//
+// One finished LOG_TraceSpan.  Together with the state transitions, these are exported as a Chrome trace (see exportTrace()).
+//
+struct LOG_TraceEvent
+{
+    int64_t startUs;     // esp_timer_get_time()
+    uint32_t durationUs; //
+    const char *name;    // A string literal.  Only the pointer is kept.
+    TaskHandle_t task;   // Named through the task registry when exported
+    uint16_t arg;        // Shown in the trace viewer's details pane
+    uint8_t core;        //
+};
+
+extern "C"
+{
+    class LOG_Trace
+    {
+    public:
+        static void traceRecord(const char *, uint16_t, int64_t, int64_t); // Called by LOG_TraceSpan when it goes out of scope
+        static void exportTrace(void);                                     // Chrome trace JSON on the console.  Also opens in ui.perfetto.dev.
+        static void clearTrace(void);                                      //
+
+    private:
+        static LOG_TraceEvent traceEvents[LOG_TRACE_SLOTS];
+        static uint32_t traceHead;
+        static portMUX_TYPE traceLock;
+    };
+}
+
+//
+// Times the enclosing scope and records it as one trace event, e.g.
+//
+//     LOG_TraceSpan span("I2C::busScan");
+//
+// The name must be a string literal (only its pointer is kept).  The cost is two esp_timer_get_time() calls and a spinlock.
+//
+class LOG_TraceSpan
+{
+public:
+    explicit LOG_TraceSpan(const char *, uint16_t arg = 0);
+    ~LOG_TraceSpan();
+
+    LOG_TraceSpan(const LOG_TraceSpan &) = delete;
+    void operator=(const LOG_TraceSpan &) = delete;
+
+private:
+    const char *name;
+    uint16_t arg;
+    int64_t startUs;
+};
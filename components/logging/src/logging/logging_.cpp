@@ -0,0 +1,403 @@
+#include "logging/logging_.hpp"
+#include "logging/logging_journal.hpp"
+#include "logging/logging_stream.hpp"
+#include "logging/logging_heap.hpp"
+
+#include <cstdio>
+#include <cstdarg>
+#include <cinttypes>
+#include <cstring>
+
+//
+// I bring most logging formation here (inside each object) because in a more advanced project, I route logging
+// information back to the cloud.  We could also just as easily log to a file storage location like an SD card.
+//
+// At is also at this location (in my more advanced projects) that I store Error information to Flash.  This makes it possible
+// to transmit error logging to the cloud after a reboot.
+//
+// Once the drainer task is started, logByValue() no longer waits on the route lock or on the UART.  Each core owns a
+// lock-free multi-producer ring.  The calling task only claims a slot, copies its record in, and goes back to work.  The
+// low priority drainer task does all the formatting and console output.
+//
+// logByValue() takes a std::string_view and LOG_PRINTF() formats into a stack buffer, so nothing here needs the heap.  Whatever
+// our own calls do allocate is counted in LOG_Heap::getLogHeapAllocs().
+//
+LOG_Ring Logging::logRing[LOG_RING_CORES] = {};
+std::atomic<TaskHandle_t> Logging::taskHandleLogDrainer = nullptr;
+std::atomic<bool> Logging::logBinaryOutput = false;
+
+void Logging::startLogDrainer(UBaseType_t priority)
+{
+    if (taskHandleLogDrainer.load() != nullptr)
+        return;
+
+    for (int core = 0; core < LOG_RING_CORES; core++)
+    {
+        logRing[core].head.store(0, std::memory_order_relaxed);
+        logRing[core].tail = 0;
+        logRing[core].dropped.store(0, std::memory_order_relaxed);
+
+        for (uint32_t i = 0; i < LOG_RING_SLOTS; i++)
+            logRing[core].records[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    TaskHandle_t handle = nullptr;
+    if (xTaskCreate(runLogDrainer, "log_drn", 1024 * LOG_DRAINER_STACK_SIZE_K, nullptr, priority, &handle) == pdPASS)
+        taskHandleLogDrainer.store(handle, std::memory_order_release); // Producers start using the rings from here on.
+    else
+        ESP_LOGE("_log ", "startLogDrainer(): Unable to create log_drn task.  Logging stays synchronous.");
+}
+
+uint32_t Logging::getLogDroppedCount(void)
+{
+    uint32_t count = 0;
+
+    for (int core = 0; core < LOG_RING_CORES; core++)
+        count += logRing[core].dropped.load(std::memory_order_relaxed);
+
+    return count;
+}
+
+void Logging::setLogBinaryOutput(bool binary)
+{
+    logBinaryOutput.store(binary, std::memory_order_relaxed);
+}
+
+void Logging::logByValue(esp_log_level_t level, SemaphoreHandle_t semRouteLock, char *ourTAG, std::string_view msg)
+{
+    if ((level == ESP_LOG_NONE) || (level > ESP_LOG_INFO)) // Debug and Verbose levels are not routed anywhere.
+        return;
+
+    uint32_t heapAllocsAtEntry = LOG_Heap::getTaskHeapAllocs();
+    TaskHandle_t drainer = taskHandleLogDrainer.load(std::memory_order_acquire);
+
+    if (level <= ESP_LOG_WARN) // Errors and warnings are kept in the error journal as well.
+        LOG_ErrorJournal::journalWrite(level, ourTAG, msg);
+
+    if (drainer == nullptr)                                 // The drainer isn't running yet (early startup).
+        logByValueLocked(level, semRouteLock, ourTAG, msg); //
+    else if (logRingPush(level, ourTAG, msg))
+        xTaskNotifyGive(drainer);
+    else if (level == ESP_LOG_ERROR)
+        logByValueLocked(level, semRouteLock, ourTAG, msg); // Errors are never dropped.  We pay for the console if the ring is full.
+
+    LOG_Heap::logHeapAllocs.fetch_add(LOG_Heap::getTaskHeapAllocs() - heapAllocsAtEntry, std::memory_order_relaxed);
+}
+
+void Logging::logPrintf(esp_log_level_t level, SemaphoreHandle_t semRouteLock, char *ourTAG, const char *func, const char *format, ...)
+{
+    if ((level == ESP_LOG_NONE) || (level > ESP_LOG_INFO))
+        return;
+
+    char msg[LOG_RING_MSG_SIZE]; // Bounded, like a ring slot.  Longer messages are truncated.
+    va_list args;
+
+    uint32_t heapAllocsAtEntry = LOG_Heap::getTaskHeapAllocs();
+    int length = snprintf(msg, sizeof(msg), "%s(): ", func);
+
+    if ((length > 0) && (length < (int)sizeof(msg)))
+    {
+        va_start(args, format);
+        vsnprintf(&msg[length], sizeof(msg) - length, format, args);
+        va_end(args);
+    }
+
+    LOG_Heap::logHeapAllocs.fetch_add(LOG_Heap::getTaskHeapAllocs() - heapAllocsAtEntry, std::memory_order_relaxed);
+    logByValue(level, semRouteLock, ourTAG, std::string_view(msg));
+}
+
+void Logging::logByValueLocked(esp_log_level_t level, SemaphoreHandle_t semRouteLock, char *ourTAG, std::string_view msg)
+{
+    if (xSemaphoreTake(semRouteLock, portMAX_DELAY)) // We use this lock to prevent sys_evt and disp_run tasks from having conflicts
+    {
+        switch (level)
+        {
+        case ESP_LOG_NONE:
+        {
+            break;
+        }
+
+        case ESP_LOG_ERROR:
+        {
+            ESP_LOGE(ourTAG, "%.*s", (int)msg.size(), msg.data()); // Print out our errors here so we see it in the console.
+            break;
+        }
+
+        case ESP_LOG_WARN:
+        {
+            ESP_LOGW(ourTAG, "%.*s", (int)msg.size(), msg.data()); // Print out our warning here so we see it in the console.
+            break;
+        }
+
+        case ESP_LOG_INFO:
+        {
+            ESP_LOGI(ourTAG, "%.*s", (int)msg.size(), msg.data()); // Print out our information here so we see it in the console.
+            break;
+        }
+
+        case ESP_LOG_DEBUG:
+        {
+            break;
+        }
+
+        case ESP_LOG_VERBOSE:
+        {
+            break;
+        }
+        }
+
+        xSemaphoreGive(semRouteLock);
+    }
+}
+
+void Logging::logTaskInfo(SemaphoreHandle_t routingSemaphoreHandle, char *ourTAG)
+{
+    char *name = pcTaskGetName(NULL); // Note: The value of NULL can be used as a parameter if the statement is running on the task of your inquiry.
+    uint32_t priority = uxTaskPriorityGet(NULL);
+    uint32_t highWaterMark = uxTaskGetStackHighWaterMark(NULL);
+
+    LOG_PRINTF(ESP_LOG_INFO, routingSemaphoreHandle, ourTAG, "name: %s priority: %" PRIu32 " highWaterMark: %" PRIu32, name, priority, highWaterMark);
+}
+
+void Logging::logDeferredWords(esp_log_level_t level, SemaphoreHandle_t semRouteLock, char *ourTAG, const char *func, uint32_t msgId, const char *format, uint8_t argCount, const uint32_t *args)
+{
+    if ((level == ESP_LOG_NONE) || (level > ESP_LOG_INFO))
+        return;
+
+    TaskHandle_t drainer = taskHandleLogDrainer.load(std::memory_order_acquire);
+    char msg[LOG_RING_MSG_SIZE];
+
+    if ((drainer == nullptr) || (level <= ESP_LOG_WARN)) // We need the text now, either for the console or for the error journal.
+    {
+        int length = snprintf(msg, sizeof(msg), "%s(): ", func);
+        if ((length > 0) && (length < (int)sizeof(msg)))
+            logDeferredFormat(&msg[length], sizeof(msg) - length, format, args);
+
+        if (level <= ESP_LOG_WARN)
+            LOG_ErrorJournal::journalWrite(level, ourTAG, std::string_view(msg));
+    }
+
+    if (drainer == nullptr) // No drainer yet, so we print it ourselves.
+    {
+        logByValueLocked(level, semRouteLock, ourTAG, std::string_view(msg));
+        return;
+    }
+
+    uint32_t pos = 0;
+    LOG_Record *record = logRingClaim(&pos);
+
+    if (record == nullptr) // Already counted as dropped
+    {
+        if (level == ESP_LOG_ERROR)
+            logByValueLocked(level, semRouteLock, ourTAG, std::string_view(msg)); // Errors are never dropped.  The text was formatted above.
+        return;
+    }
+
+    record->timeStamp = esp_log_timestamp();
+    record->level = level;
+    record->deferred = true;
+    strlcpy(record->tag, ourTAG, sizeof(record->tag));
+    record->bin.msgId = msgId;
+    record->bin.format = format;
+    record->bin.func = func;
+    record->bin.argCount = argCount;
+    memcpy(record->bin.args, args, sizeof(record->bin.args));
+
+    logRingPublish(record, pos);
+    xTaskNotifyGive(drainer);
+}
+
+bool Logging::logLimitAllow(LOG_Limiter *site, esp_log_level_t level, SemaphoreHandle_t semRouteLock, char *ourTAG, const char *func, uint32_t msgId, const uint32_t *args)
+{
+    uint32_t hash = msgId;
+    uint32_t repeats = 0;
+    uint32_t dropped = 0;
+
+    for (int i = 0; i < LOG_DEFERRED_MAX_ARGS; i++) // Fold the arguments in, so only a truly identical message counts as a repeat.
+        hash = (hash ^ args[i]) * 16777619u;
+
+    if (!LOG_RateLimit::limitAllow(site, hash, &repeats, &dropped))
+        return false;
+
+    if ((repeats + dropped) > 0)
+        logPrintf(level, semRouteLock, ourTAG, func, "(last message repeated %" PRIu32 " times, %" PRIu32 " others rate limited)", repeats, dropped);
+    return true;
+}
+
+/* Log Ring */
+LOG_Record *Logging::logRingClaim(uint32_t *posOut)
+{
+    LOG_Ring *ring = &logRing[xPortGetCoreID() % LOG_RING_CORES]; // Being moved to the other core after this line is harmless.
+    LOG_Record *record = nullptr;
+    uint32_t pos = ring->head.load(std::memory_order_relaxed);
+
+    while (true)
+    {
+        record = &ring->records[pos & (LOG_RING_SLOTS - 1)];
+        int32_t diff = (int32_t)(record->sequence.load(std::memory_order_acquire) - pos);
+
+        if (diff == 0) // Slot is free for this position, try to claim it.
+        {
+            if (ring->head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0) // The drainer hasn't released this slot yet.  The ring is full.
+        {
+            ring->dropped.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        else // Another producer beat us to it.
+            pos = ring->head.load(std::memory_order_relaxed);
+    }
+
+    *posOut = pos;
+    return record;
+}
+
+void Logging::logRingPublish(LOG_Record *record, uint32_t pos)
+{
+    record->sequence.store(pos + 1, std::memory_order_release); // Hand the record to the drainer
+}
+
+bool Logging::logRingPush(esp_log_level_t level, const char *ourTAG, std::string_view msg)
+{
+    uint32_t pos = 0;
+    LOG_Record *record = logRingClaim(&pos);
+
+    if (record == nullptr)
+        return false;
+
+    record->timeStamp = esp_log_timestamp();
+    record->level = level;
+    record->deferred = false;
+    strlcpy(record->tag, ourTAG, sizeof(record->tag));
+    size_t length = (msg.size() < sizeof(record->msg)) ? msg.size() : (sizeof(record->msg) - 1);
+    memcpy(record->msg, msg.data(), length);
+    record->msg[length] = 0;
+
+    logRingPublish(record, pos);
+    return true;
+}
+
+bool Logging::logRingPeek(LOG_Ring *ring, LOG_Record **record)
+{
+    *record = &ring->records[ring->tail & (LOG_RING_SLOTS - 1)];
+    return ((*record)->sequence.load(std::memory_order_acquire) == (ring->tail + 1));
+}
+
+void Logging::logRingRelease(LOG_Ring *ring)
+{
+    LOG_Record *record = &ring->records[ring->tail & (LOG_RING_SLOTS - 1)];
+    record->sequence.store(ring->tail + LOG_RING_SLOTS, std::memory_order_release); // Hand the slot back for the next lap
+    ring->tail++;
+}
+
+void Logging::logDeferredFormat(char *buffer, size_t size, const char *format, const uint32_t *args)
+{
+    // Every argument was widened to a 32 bit word, so passing all of them is safe.  printf ignores the ones the format doesn't use.
+    snprintf(buffer, size, format, args[0], args[1], args[2], args[3]);
+}
+
+void Logging::logRecordWrite(LOG_Record *record)
+{
+    char text[LOG_RING_MSG_SIZE];
+    char line[LOG_RING_MSG_SIZE + 32]; // Room for the level, time stamp, and tag in front of the message
+    const char *msg = record->msg;
+    int length = 0;
+
+    if (record->deferred)
+    {
+        if (logBinaryOutput.load(std::memory_order_relaxed))
+        {
+            // #LB <timeStamp> <level> <tag> <msgId> <argCount> [<arg>...]  -- all numbers in hex
+            length = snprintf(line, sizeof(line), LOG_BINARY_PREFIX " %" PRIx32 " %d %s %08" PRIx32 " %d", record->timeStamp, (int)record->level, record->tag, record->bin.msgId, record->bin.argCount);
+            for (uint8_t i = 0; i < record->bin.argCount; i++)
+                length += snprintf(&line[length], sizeof(line) - length, " %" PRIx32, record->bin.args[i]);
+            printf("%s\n", line);
+            LOG_Stream::logStreamAppend(line, length, true);
+            return;
+        }
+
+        length = snprintf(text, sizeof(text), "%s(): ", record->bin.func);
+        if ((length > 0) && (length < (int)sizeof(text)))
+            logDeferredFormat(&text[length], sizeof(text) - length, record->bin.format, record->bin.args);
+        msg = text;
+    }
+
+    switch (record->level)
+    {
+    case ESP_LOG_ERROR:
+    {
+        esp_log_write(ESP_LOG_ERROR, record->tag, LOG_FORMAT(E, "%s"), record->timeStamp, record->tag, msg);
+        break;
+    }
+
+    case ESP_LOG_WARN:
+    {
+        esp_log_write(ESP_LOG_WARN, record->tag, LOG_FORMAT(W, "%s"), record->timeStamp, record->tag, msg);
+        break;
+    }
+
+    case ESP_LOG_INFO:
+    {
+        esp_log_write(ESP_LOG_INFO, record->tag, LOG_FORMAT(I, "%s"), record->timeStamp, record->tag, msg);
+        break;
+    }
+
+    default:
+        break;
+    }
+
+    if (LOG_Stream::logStreamOpen()) // The collector gets the same line, without the console colours
+    {
+        length = snprintf(line, sizeof(line), "%c (%" PRIu32 ") %s: %s", (record->level == ESP_LOG_ERROR) ? 'E' : (record->level == ESP_LOG_WARN) ? 'W' : 'I', record->timeStamp, record->tag, msg);
+        LOG_Stream::logStreamAppend(line, length, true);
+    }
+}
+
+void Logging::runLogDrainer(void *arg)
+{
+    LOG_Record *record = nullptr;
+    LOG_Record *oldest = nullptr;
+    LOG_Ring *oldestRing = nullptr;
+    uint32_t droppedReported = 0;
+    uint32_t droppedNow = 0;
+
+    while (true)
+    {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LOG_DRAINER_WAIT_MS));
+
+        while (true) // Merge the per-core rings back into time order as we print them.
+        {
+            oldest = nullptr;
+            oldestRing = nullptr;
+
+            for (int core = 0; core < LOG_RING_CORES; core++)
+            {
+                if (logRingPeek(&logRing[core], &record))
+                {
+                    if ((oldest == nullptr) || ((int32_t)(record->timeStamp - oldest->timeStamp) < 0))
+                    {
+                        oldest = record;
+                        oldestRing = &logRing[core];
+                    }
+                }
+            }
+
+            if (oldest == nullptr)
+                break;
+
+            logRecordWrite(oldest);
+            logRingRelease(oldestRing);
+        }
+
+        droppedNow = getLogDroppedCount();
+        if (droppedNow != droppedReported)
+        {
+            ESP_LOGW("_log ", "%ld log records dropped (ring full)", droppedNow - droppedReported);
+            droppedReported = droppedNow;
+        }
+
+        LOG_Stream::logStreamService();
+    }
+}
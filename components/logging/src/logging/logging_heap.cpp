@@ -0,0 +1,198 @@
+#include "logging/logging_heap.hpp"
+
+#include "sdkconfig.h"
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/task.h"
+
+#include <cstring>
+
+//
+// Per component heap accounting.  The heap hooks below call in here for every malloc and free.  While tracking is off,
+// that costs one atomic load.  While it is on, each live allocation made since tracking began sits in an open addressed table
+// (linear probing, backward shift delete) with its size and tag, so a free is charged to the component that allocated.
+//
+// The table lives in internal RAM because the hooks may run while the flash cache (and with it PSRAM) is disabled.
+//
+// With CONFIG_HEAP_USE_HOOKS enabled, every allocation is also counted against the task that made it.  That lets each run loop
+// prove that its steady state passes do not allocate (see getTaskHeapAllocs()).
+//
+thread_local uint32_t LOG_Heap::taskHeapAllocs = 0;
+std::atomic<uint32_t> LOG_Heap::logHeapAllocs = 0;
+
+thread_local LOG_HEAP_TAG LOG_Heap::taskHeapTag = LOG_HEAP_TAG::Other;
+LOG_HeapTrack *LOG_Heap::heapTrack = nullptr;
+std::atomic<bool> LOG_Heap::heapTracking = false;
+portMUX_TYPE LOG_Heap::heapTrackLock = portMUX_INITIALIZER_UNLOCKED;
+LOG_HeapTagStats LOG_Heap::heapTagStats[(int)LOG_HEAP_TAG::Count] = {};
+uint32_t LOG_Heap::heapUntracked = 0;
+
+#if CONFIG_HEAP_USE_HOOKS
+extern "C" void IRAM_ATTR esp_heap_trace_alloc_hook(void *ptr, size_t size, uint32_t caps)
+{
+    LOG_Heap::countHeapAlloc();
+    LOG_Heap::trackHeapAlloc(ptr, size);
+}
+
+extern "C" void IRAM_ATTR esp_heap_trace_free_hook(void *ptr)
+{
+    LOG_Heap::trackHeapFree(ptr);
+}
+#endif
+
+static inline uint32_t IRAM_ATTR heapTrackSlot(void *ptr)
+{
+    return (((uintptr_t)ptr >> 3) * 2654435761u) & (LOG_HEAP_TRACK_SLOTS - 1); // Blocks are 8 byte aligned
+}
+
+uint32_t LOG_Heap::getTaskHeapAllocs(void)
+{
+    if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED)
+        return 0;
+
+    return taskHeapAllocs;
+}
+
+uint32_t LOG_Heap::getLogHeapAllocs(void)
+{
+    return logHeapAllocs.load(std::memory_order_relaxed);
+}
+
+void IRAM_ATTR LOG_Heap::countHeapAlloc(void)
+{
+    if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED) // There is no task (and no thread local storage) before the scheduler runs.
+        return;
+
+    taskHeapAllocs++;
+}
+
+bool LOG_Heap::startHeapTracking(void)
+{
+#if CONFIG_HEAP_USE_HOOKS
+    LOG_HeapTrack *table = nullptr;
+
+    if (heapTracking.load(std::memory_order_acquire))
+        return true;
+
+    if (heapTrack == nullptr) // Allocated while tracking is still off, so the table doesn't track itself
+        table = (LOG_HeapTrack *)heap_caps_calloc(LOG_HEAP_TRACK_SLOTS, sizeof(LOG_HeapTrack), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+
+    portENTER_CRITICAL(&heapTrackLock);
+    if (table != nullptr)
+        heapTrack = table;
+    else if (heapTrack != nullptr)
+        memset(heapTrack, 0, LOG_HEAP_TRACK_SLOTS * sizeof(LOG_HeapTrack));
+    memset(heapTagStats, 0, sizeof(heapTagStats));
+    heapUntracked = 0;
+    portEXIT_CRITICAL(&heapTrackLock);
+
+    if (heapTrack == nullptr)
+    {
+        ESP_LOGE("_log ", "startHeapTracking(): No memory for the tracking table");
+        return false;
+    }
+
+    heapTracking.store(true, std::memory_order_release);
+    return true;
+#else
+    return false;
+#endif
+}
+
+void LOG_Heap::stopHeapTracking(void)
+{
+    heapTracking.store(false, std::memory_order_release); // The table is kept for the next start.  The counts stay readable.
+}
+
+void LOG_Heap::getHeapTagStats(LOG_HEAP_TAG tag, LOG_HeapTagStats *stats)
+{
+    portENTER_CRITICAL(&heapTrackLock);
+    *stats = heapTagStats[(int)tag];
+    portEXIT_CRITICAL(&heapTrackLock);
+}
+
+uint32_t LOG_Heap::getHeapUntracked(void)
+{
+    return heapUntracked;
+}
+
+LOG_HEAP_TAG LOG_Heap::setTaskHeapTag(LOG_HEAP_TAG tag)
+{
+    LOG_HEAP_TAG previous = taskHeapTag;
+    taskHeapTag = tag;
+    return previous;
+}
+
+void IRAM_ATTR LOG_Heap::trackHeapAlloc(void *ptr, size_t size)
+{
+    if (!heapTracking.load(std::memory_order_acquire) || (ptr == nullptr))
+        return;
+
+    if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED) // No thread local storage yet
+        return;
+
+    LOG_HEAP_TAG tag = taskHeapTag;
+    uint32_t slot = heapTrackSlot(ptr);
+
+    portENTER_CRITICAL_SAFE(&heapTrackLock);
+    for (uint32_t probe = 0; probe < LOG_HEAP_TRACK_SLOTS; probe++)
+    {
+        if (heapTrack[slot].ptr == nullptr)
+        {
+            heapTrack[slot].ptr = ptr;
+            heapTrack[slot].size = size;
+            heapTrack[slot].tag = (uint8_t)tag;
+            heapTagStats[(int)tag].bytes += size;
+            heapTagStats[(int)tag].blocks++;
+            portEXIT_CRITICAL_SAFE(&heapTrackLock);
+            return;
+        }
+        slot = (slot + 1) & (LOG_HEAP_TRACK_SLOTS - 1);
+    }
+    heapUntracked++;
+    portEXIT_CRITICAL_SAFE(&heapTrackLock);
+}
+
+void IRAM_ATTR LOG_Heap::trackHeapFree(void *ptr)
+{
+    if (!heapTracking.load(std::memory_order_acquire) || (ptr == nullptr))
+        return;
+
+    uint32_t slot = heapTrackSlot(ptr);
+    uint32_t next = 0;
+    uint32_t home = 0;
+
+    portENTER_CRITICAL_SAFE(&heapTrackLock);
+    for (uint32_t probe = 0; probe < LOG_HEAP_TRACK_SLOTS; probe++)
+    {
+        if (heapTrack[slot].ptr == nullptr) // Allocated before tracking began (or untracked).  Nothing to charge.
+            break;
+
+        if (heapTrack[slot].ptr == ptr)
+        {
+            heapTagStats[heapTrack[slot].tag].bytes -= heapTrack[slot].size;
+            heapTagStats[heapTrack[slot].tag].blocks--;
+
+            //
+            // Backward shift delete: pull later entries of the probe run into the gap when their home slot allows it, so
+            // lookups never need tombstones.
+            //
+            next = (slot + 1) & (LOG_HEAP_TRACK_SLOTS - 1);
+            while (heapTrack[next].ptr != nullptr)
+            {
+                home = heapTrackSlot(heapTrack[next].ptr);
+                if (((next - home) & (LOG_HEAP_TRACK_SLOTS - 1)) >= ((next - slot) & (LOG_HEAP_TRACK_SLOTS - 1)))
+                {
+                    heapTrack[slot] = heapTrack[next];
+                    slot = next;
+                }
+                next = (next + 1) & (LOG_HEAP_TRACK_SLOTS - 1);
+            }
+            heapTrack[slot] = {};
+            break;
+        }
+        slot = (slot + 1) & (LOG_HEAP_TRACK_SLOTS - 1);
+    }
+    portEXIT_CRITICAL_SAFE(&heapTrackLock);
+}
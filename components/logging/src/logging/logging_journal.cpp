@@ -0,0 +1,116 @@
+#include "logging/logging_journal.hpp"
+
+#include <cstring>
+#include <cstddef>
+
+#include "esp_attr.h"
+
+//
+// The journal lives in RTC memory that the startup code leaves alone (RTC_NOINIT_ATTR).  Its contents survive a panic, a watchdog
+// or a brownout reset, but not a power on.  Writers only hold the spinlock long enough to copy one entry.
+//
+RTC_NOINIT_ATTR LOG_Journal LOG_ErrorJournal::journal;
+portMUX_TYPE LOG_ErrorJournal::journalLock = portMUX_INITIALIZER_UNLOCKED;
+std::atomic<bool> LOG_ErrorJournal::journalReady = false;
+
+bool LOG_ErrorJournal::initErrorJournal(void)
+{
+    bool survived = (journal.magic == LOG_JOURNAL_MAGIC) &&
+                    ((journal.head - journal.flushed) <= LOG_JOURNAL_SLOTS);
+
+    if (!survived) // Power on (or garbage).  Start over.
+    {
+        memset(&journal, 0, sizeof(journal));
+        journal.magic = LOG_JOURNAL_MAGIC;
+    }
+
+    journalReady.store(true, std::memory_order_release);
+    return survived;
+}
+
+uint32_t LOG_ErrorJournal::getJournalHead(void)
+{
+    return journal.head;
+}
+
+uint32_t LOG_ErrorJournal::getJournalFlushed(void)
+{
+    return journal.flushed;
+}
+
+uint32_t LOG_ErrorJournal::getJournalLost(void)
+{
+    return journal.lost;
+}
+
+bool LOG_ErrorJournal::getJournalEntry(uint32_t position, LOG_JournalEntry *entry)
+{
+    bool valid = false;
+
+    portENTER_CRITICAL(&journalLock);
+    if (((journal.head - position) > 0) && ((journal.head - position) <= LOG_JOURNAL_SLOTS))
+    {
+        *entry = journal.entries[position & (LOG_JOURNAL_SLOTS - 1)];
+        valid = true;
+    }
+    portEXIT_CRITICAL(&journalLock);
+
+    return valid && (entry->check == journalCheck(entry));
+}
+
+void LOG_ErrorJournal::setJournalFlushed(uint32_t position)
+{
+    portENTER_CRITICAL(&journalLock);
+    if ((int32_t)(position - journal.flushed) > 0) // Never move backwards.  A writer may have pushed it forward while we flushed.
+        journal.flushed = position;
+    portEXIT_CRITICAL(&journalLock);
+}
+
+static uint32_t journalHash(uint32_t hash, const void *data, size_t size) // One FNV-1a step per byte
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+uint32_t LOG_ErrorJournal::journalCheck(const LOG_JournalEntry *entry)
+{
+    uint32_t hash = 2166136261u; // FNV-1a over the named fields only.  A struct copy need not keep the padding between them.
+
+    hash = journalHash(hash, &entry->timeStamp, sizeof(entry->timeStamp));
+    hash = journalHash(hash, &entry->level, sizeof(entry->level));
+    hash = journalHash(hash, entry->tag, sizeof(entry->tag));
+    hash = journalHash(hash, entry->msg, sizeof(entry->msg));
+    return hash;
+}
+
+void LOG_ErrorJournal::journalWrite(esp_log_level_t level, const char *ourTAG, std::string_view msg)
+{
+    if (!journalReady.load(std::memory_order_acquire))
+        return;
+
+    LOG_JournalEntry entry = {}; // Built on our stack so the critical section is only a copy
+    size_t length = (msg.size() < sizeof(entry.msg)) ? msg.size() : (sizeof(entry.msg) - 1);
+
+    entry.timeStamp = esp_log_timestamp();
+    entry.level = (uint8_t)level;
+    strlcpy(entry.tag, ourTAG, sizeof(entry.tag));
+    memcpy(entry.msg, msg.data(), length);
+    entry.check = journalCheck(&entry);
+
+    portENTER_CRITICAL(&journalLock);
+    if ((journal.head - journal.flushed) >= LOG_JOURNAL_SLOTS) // The oldest unflushed entry is about to be overwritten
+    {
+        journal.flushed++;
+        journal.lost++;
+    }
+
+    journal.entries[journal.head & (LOG_JOURNAL_SLOTS - 1)] = entry;
+    journal.head++; // Moved only after the copy, so a crash in the middle leaves a slot that fails its check
+    portEXIT_CRITICAL(&journalLock);
+}
@@ -0,0 +1,230 @@
+#include "logging/logging_latency.hpp"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include <algorithm>
+#include <cinttypes>
+
+//
+// Latency histograms for the paths between our tasks.  Bucket i below 4 holds exactly i us.  Above that, each power of two is
+// split into four buckets, so 80 buckets reach from 1 us to beyond a second at a resolution of 25% or better.  Recording a
+// sample is a short search of LOG_LATENCY_CHANNELS under a spinlock, with no heap and no logging.
+//
+LOG_LatencyHistogram LOG_Latency::latencyHistograms[LOG_LATENCY_CHANNELS] = {};
+portMUX_TYPE LOG_Latency::latencyLock = portMUX_INITIALIZER_UNLOCKED;
+std::atomic<uint32_t> LOG_Latency::latencyNotifyStamps[(int)LOG_LAT_SOURCE::Count][LOG_LATENCY_NOTIFY_CODES] = {};
+
+static inline uint32_t latencyNowUs(void)
+{
+    return (uint32_t)esp_timer_get_time() | 0x01; // Never zero, which marks "not stamped".  1 us doesn't matter here.
+}
+
+static uint8_t latencyBucket(uint32_t us)
+{
+    if (us < 4)
+        return us;
+
+    uint32_t msb = 31 - __builtin_clz(us);
+    uint32_t index = ((msb - 1) * 4) + ((us >> (msb - 2)) & 0x03);
+    return (index < LOG_LATENCY_BUCKETS) ? index : (LOG_LATENCY_BUCKETS - 1);
+}
+
+static uint32_t latencyBucketTop(uint8_t index) // Largest value which falls in the bucket
+{
+    if (index < 4)
+        return index;
+
+    uint32_t msb = (index / 4) + 1;
+    return ((4 + (index % 4) + 1) << (msb - 2)) - 1;
+}
+
+static const char *latencySourceName(LOG_LAT_SOURCE source)
+{
+    switch (source)
+    {
+    case LOG_LAT_SOURCE::System:
+        return "System";
+    case LOG_LAT_SOURCE::Wifi:
+        return "Wifi";
+    case LOG_LAT_SOURCE::Display:
+        return "Display";
+    case LOG_LAT_SOURCE::I2C:
+        return "I2C";
+    case LOG_LAT_SOURCE::SPI:
+        return "SPI";
+    default:
+        return "?";
+    }
+}
+
+static const char *latencyPathName(LOG_LAT_PATH path)
+{
+    switch (path)
+    {
+    case LOG_LAT_PATH::Queued:
+        return "queued";
+    case LOG_LAT_PATH::Service:
+        return "service";
+    case LOG_LAT_PATH::Notify:
+        return "notify";
+    default:
+        return "?";
+    }
+}
+
+void LOG_Latency::stampEnqueue(LOG_LatencyStamp *stamp)
+{
+    stamp->enqueuedUs = latencyNowUs();
+    stamp->dequeuedUs = 0;
+}
+
+void LOG_Latency::latencyDequeued(LOG_LAT_SOURCE source, uint8_t code, LOG_LatencyStamp *stamp)
+{
+    stamp->dequeuedUs = latencyNowUs();
+
+    if (stamp->enqueuedUs != 0)
+        recordLatency(source, LOG_LAT_PATH::Queued, code, stamp->dequeuedUs - stamp->enqueuedUs);
+}
+
+void LOG_Latency::latencyServiced(LOG_LAT_SOURCE source, uint8_t code, LOG_LatencyStamp *stamp)
+{
+    if (stamp->dequeuedUs != 0)
+        recordLatency(source, LOG_LAT_PATH::Service, code, latencyNowUs() - stamp->dequeuedUs);
+
+    *stamp = {}; // A sender which reuses the request without stamping it again doesn't produce a bogus sample
+}
+
+//
+// Notifications are bits sent with eSetBits, so each bit has its own stamp.  A bit sent again before the target woke keeps its
+// first stamp: the wait we measure is that of the oldest request, which is the one the coalesced wake serves.
+//
+void LOG_Latency::stampNotify(LOG_LAT_SOURCE target, uint32_t bit)
+{
+    uint32_t expected = 0;
+
+    if (bit != 0)
+        latencyNotifyStamps[(int)target][__builtin_ctz(bit)].compare_exchange_strong(expected, latencyNowUs(), std::memory_order_relaxed);
+}
+
+void LOG_Latency::latencyNotified(LOG_LAT_SOURCE target, uint32_t bits)
+{
+    uint32_t nowUs = latencyNowUs();
+    uint32_t sentUs = 0;
+
+    for (; bits != 0; bits &= (bits - 1)) // One sample for every bit which was stamped
+    {
+        uint8_t index = __builtin_ctz(bits);
+
+        sentUs = latencyNotifyStamps[(int)target][index].exchange(0, std::memory_order_relaxed);
+        if (sentUs != 0)
+            recordLatency(target, LOG_LAT_PATH::Notify, (uint8_t)(1 << index), nowUs - sentUs);
+    }
+}
+
+void LOG_Latency::recordLatency(LOG_LAT_SOURCE source, LOG_LAT_PATH path, uint8_t code, uint32_t us)
+{
+    LOG_LatencyHistogram *histogram = nullptr;
+    uint8_t bucket = latencyBucket(us);
+
+    portENTER_CRITICAL(&latencyLock);
+    for (int i = 0; i < LOG_LATENCY_CHANNELS; i++) // Find the channel, or claim the first unused one
+    {
+        if (!latencyHistograms[i].used)
+        {
+            histogram = &latencyHistograms[i];
+            histogram->used = true;
+            histogram->source = source;
+            histogram->path = path;
+            histogram->code = code;
+            break;
+        }
+
+        if ((latencyHistograms[i].source == source) && (latencyHistograms[i].path == path) && (latencyHistograms[i].code == code))
+        {
+            histogram = &latencyHistograms[i];
+            break;
+        }
+    }
+
+    if (histogram != nullptr)
+    {
+        if (histogram->buckets[bucket] == UINT16_MAX)
+        {
+            histogram->count = 0;
+            for (int j = 0; j < LOG_LATENCY_BUCKETS; j++)
+            {
+                histogram->buckets[j] /= 2;
+                histogram->count += histogram->buckets[j];
+            }
+        }
+
+        histogram->buckets[bucket]++;
+        histogram->count++;
+        if (us > histogram->maxUs)
+            histogram->maxUs = us;
+    }
+    portEXIT_CRITICAL(&latencyLock);
+}
+
+bool LOG_Latency::getLatencySummary(uint8_t index, LOG_LatencySummary *summary)
+{
+    LOG_LatencyHistogram histogram = {};
+    uint32_t running = 0;
+
+    if (index >= LOG_LATENCY_CHANNELS)
+        return false;
+
+    portENTER_CRITICAL(&latencyLock);
+    histogram = latencyHistograms[index];
+    portEXIT_CRITICAL(&latencyLock);
+
+    if (!histogram.used || (histogram.count == 0))
+        return false;
+
+    *summary = {};
+    summary->source = histogram.source;
+    summary->path = histogram.path;
+    summary->code = histogram.code;
+    summary->count = histogram.count;
+    summary->maxUs = histogram.maxUs;
+
+    for (uint8_t j = 0; j < LOG_LATENCY_BUCKETS; j++)
+    {
+        running += histogram.buckets[j];
+
+        if ((summary->p50Us == 0) && ((running * 100) >= (histogram.count * 50)))
+            summary->p50Us = std::min(latencyBucketTop(j), histogram.maxUs);
+
+        if ((running * 100) >= (histogram.count * 99))
+        {
+            summary->p99Us = std::min(latencyBucketTop(j), histogram.maxUs);
+            break;
+        }
+    }
+    return true;
+}
+
+void LOG_Latency::resetLatency(void)
+{
+    portENTER_CRITICAL(&latencyLock);
+    for (int i = 0; i < LOG_LATENCY_CHANNELS; i++)
+        latencyHistograms[i] = {};
+    portEXIT_CRITICAL(&latencyLock);
+}
+
+void LOG_Latency::printLatency(void)
+{
+    LOG_LatencySummary summary = {};
+
+    ESP_LOGW("_log ", "Latency       path     code  count       p50 us     p99 us     max us");
+
+    for (uint8_t i = 0; i < LOG_LATENCY_CHANNELS; i++)
+    {
+        if (!getLatencySummary(i, &summary))
+            continue;
+
+        ESP_LOGW("_log ", "%-12s  %-7s  %4d  %-10" PRIu32 "  %-9" PRIu32 "  %-9" PRIu32 "  %" PRIu32, latencySourceName(summary.source), latencyPathName(summary.path),
+                 summary.code, summary.count, summary.p50Us, summary.p99Us, summary.maxUs);
+    }
+}
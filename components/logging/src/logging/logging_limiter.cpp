@@ -0,0 +1,97 @@
+#include "logging/logging_limiter.hpp"
+
+#include <cinttypes>
+
+#include "esp_log.h"
+
+//
+// Each LOG_LIMITED() site owns a LOG_Limiter (a function local static), so a chatty site can never use up another site's
+// budget.  The decision is made under a spinlock because one site may be reached from more than one task.  The counters are
+// kept per site and as a running total so they can be shown to an operator.
+//
+std::atomic<LOG_Limiter *> LOG_RateLimit::logLimiters = nullptr;
+std::atomic<uint32_t> LOG_RateLimit::logSuppressed = 0;
+portMUX_TYPE LOG_RateLimit::logLimiterLock = portMUX_INITIALIZER_UNLOCKED;
+
+uint32_t LOG_RateLimit::getLogSuppressedCount(void)
+{
+    return logSuppressed.load(std::memory_order_relaxed);
+}
+
+void LOG_RateLimit::printLogSuppression(void)
+{
+    for (LOG_Limiter *site = logLimiters.load(std::memory_order_acquire); site != nullptr; site = site->next)
+    {
+        if ((site->totalRepeats + site->totalDropped) > 0)
+            ESP_LOGW("_log ", "repeated %6" PRIu32 "  rate limited %6" PRIu32 "  \"%s\"", site->totalRepeats, site->totalDropped, site->format);
+    }
+
+    ESP_LOGW("_log ", "%" PRIu32 " log messages suppressed in total", getLogSuppressedCount());
+}
+
+bool LOG_RateLimit::limitAllow(LOG_Limiter *site, uint32_t hash, uint32_t *repeats, uint32_t *dropped)
+{
+    uint32_t now = esp_log_timestamp();
+    bool allow = false;
+    bool registerSite = false;
+
+    portENTER_CRITICAL(&logLimiterLock);
+
+    if (!site->primed)
+    {
+        site->primed = true;
+        site->milliTokens = LOG_LIMIT_BURST * 1000;
+        site->lastRefillMs = now;
+        site->lastHash = ~hash;
+        registerSite = true;
+    }
+
+    uint32_t refill = (now - site->lastRefillMs) * LOG_LIMIT_PER_MINUTE / 60; // (ms * per minute / 60) is milli-tokens
+    if (refill > 0)                                                          // Don't move the clock on for nothing or fast callers never refill
+    {
+        site->milliTokens += refill;
+        site->lastRefillMs = now;
+        if (site->milliTokens > (LOG_LIMIT_BURST * 1000))
+            site->milliTokens = LOG_LIMIT_BURST * 1000;
+    }
+
+    if ((hash == site->lastHash) && ((now - site->lastSentMs) < LOG_LIMIT_REPEAT_REPORT_MS))
+    {
+        site->repeats++;
+        site->totalRepeats++;
+    }
+    else if (site->milliTokens >= 1000)
+    {
+        site->milliTokens -= 1000;
+        allow = true;
+    }
+    else
+    {
+        site->dropped++;
+        site->totalDropped++;
+    }
+
+    if (allow)
+    {
+        *repeats = site->repeats;
+        *dropped = site->dropped;
+        site->repeats = 0;
+        site->dropped = 0;
+        site->lastHash = hash;
+        site->lastSentMs = now;
+    }
+
+    portEXIT_CRITICAL(&logLimiterLock);
+
+    if (registerSite) // Only the first caller gets here for each site
+    {
+        site->next = logLimiters.load(std::memory_order_relaxed);
+        while (!logLimiters.compare_exchange_weak(site->next, site, std::memory_order_release, std::memory_order_relaxed))
+            ;
+    }
+
+    if (!allow)
+        logSuppressed.fetch_add(1, std::memory_order_relaxed);
+
+    return allow;
+}
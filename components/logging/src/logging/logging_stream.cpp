@@ -0,0 +1,173 @@
+#include "logging/logging_stream.hpp"
+#include "logging/logging_.hpp" // The metrics line gathers counts from the other modules
+#include "logging/logging_limiter.hpp"
+#include "logging/logging_heap.hpp"
+#include "logging/logging_telemetry.hpp"
+
+#include <cinttypes>
+#include <cstring>
+
+#include "lwip/sockets.h"
+
+//
+// Once the network is up, the System object calls startLogStream() and every record the drainer prints is also packed into a
+// UDP frame for a collector (see tools/log_collector.py).  Frames are sent when they are full, or when the oldest record in
+// them is LOG_STREAM_FLUSH_MS old.
+//
+// Only the drainer task touches the socket, and it never waits on it.  The socket is non-blocking, so if the link is down or
+// busy the frame is thrown away and counted.  The next frame that gets through starts with a "#D" line saying how many
+// records were lost.  Producers never see any of this.  They only ever write into the rings.
+//
+std::atomic<uint32_t> LOG_Stream::logStreamAddress = 0;
+std::atomic<uint16_t> LOG_Stream::logStreamPort = 0;
+std::atomic<uint32_t> LOG_Stream::logStreamSent = 0;
+std::atomic<uint32_t> LOG_Stream::logStreamLost = 0;
+int LOG_Stream::logStreamSocket = -1;
+uint32_t LOG_Stream::logStreamOpenAddress = 0;
+uint16_t LOG_Stream::logStreamOpenPort = 0;
+char LOG_Stream::logStreamFrame[LOG_STREAM_FRAME_SIZE] = {};
+uint16_t LOG_Stream::logStreamLength = 0;
+uint16_t LOG_Stream::logStreamRecords = 0;
+uint32_t LOG_Stream::logStreamFrameMs = 0;
+uint32_t LOG_Stream::logStreamMetricsMs = 0;
+uint32_t LOG_Stream::logStreamLostReported = 0;
+
+bool LOG_Stream::startLogStream(const char *collector, uint16_t port)
+{
+    struct in_addr address = {};
+
+    if ((collector == nullptr) || (inet_pton(AF_INET, collector, &address) != 1) || (port == 0))
+        return false;
+
+    logStreamPort.store(port, std::memory_order_relaxed);
+    logStreamAddress.store(address.s_addr, std::memory_order_release); // The drainer opens the socket on its next pass
+    return true;
+}
+
+void LOG_Stream::stopLogStream(void)
+{
+    logStreamAddress.store(0, std::memory_order_release);
+}
+
+uint32_t LOG_Stream::getLogStreamSentCount(void)
+{
+    return logStreamSent.load(std::memory_order_relaxed);
+}
+
+uint32_t LOG_Stream::getLogStreamLostCount(void)
+{
+    return logStreamLost.load(std::memory_order_relaxed);
+}
+
+bool LOG_Stream::logStreamOpen(void)
+{
+    return logStreamSocket >= 0;
+}
+
+void LOG_Stream::logStreamAppend(const char *line, int length, bool isRecord)
+{
+    char summary[40];
+    int summaryLength = 0;
+    uint32_t lost = 0;
+
+    if ((logStreamSocket < 0) || (length <= 0))
+        return;
+
+    if (length > (LOG_STREAM_FRAME_SIZE - 1)) // snprintf() reports the length it wanted, not what it wrote
+        length = LOG_STREAM_FRAME_SIZE - 1;
+
+    if ((logStreamLength + length + 1) > LOG_STREAM_FRAME_SIZE)
+        logStreamFlush();
+
+    if (logStreamLength == 0)
+    {
+        logStreamFrameMs = esp_log_timestamp();
+
+        lost = logStreamLost.load(std::memory_order_relaxed);
+        if (lost != logStreamLostReported) // Summarize what the collector missed since the last frame got through
+        {
+            summaryLength = snprintf(summary, sizeof(summary), "#D %" PRIu32 " records lost\n", lost - logStreamLostReported);
+            if ((summaryLength > 0) && ((summaryLength + length + 1) <= LOG_STREAM_FRAME_SIZE))
+            {
+                memcpy(logStreamFrame, summary, summaryLength);
+                logStreamLength = summaryLength;
+            }
+            logStreamLostReported = lost;
+        }
+    }
+
+    memcpy(&logStreamFrame[logStreamLength], line, length);
+    logStreamLength += length;
+    logStreamFrame[logStreamLength++] = '\n';
+
+    if (isRecord)
+        logStreamRecords++;
+}
+
+void LOG_Stream::logStreamFlush(void)
+{
+    struct sockaddr_in collector = {};
+
+    if (logStreamLength == 0)
+        return;
+
+    collector.sin_family = AF_INET;
+    collector.sin_port = htons(logStreamOpenPort);
+    collector.sin_addr.s_addr = logStreamOpenAddress;
+
+    if ((logStreamSocket >= 0) && (sendto(logStreamSocket, logStreamFrame, logStreamLength, MSG_DONTWAIT, (struct sockaddr *)&collector, sizeof(collector)) == logStreamLength))
+        logStreamSent.fetch_add(logStreamRecords, std::memory_order_relaxed);
+    else
+        logStreamLost.fetch_add(logStreamRecords, std::memory_order_relaxed); // Drop, never wait
+
+    logStreamLength = 0;
+    logStreamRecords = 0;
+}
+
+void LOG_Stream::logStreamService(void)
+{
+    char metrics[96];
+    int length = 0;
+    uint32_t address = logStreamAddress.load(std::memory_order_acquire);
+    uint16_t port = logStreamPort.load(std::memory_order_relaxed);
+    uint32_t now = esp_log_timestamp();
+
+    if ((address != logStreamOpenAddress) || (port != logStreamOpenPort)) // Started, stopped, or moved to another collector
+    {
+        if (logStreamSocket >= 0)
+        {
+            logStreamFlush(); // Send what we have.  If the network has already gone, it is counted as lost.
+            close(logStreamSocket);
+            logStreamSocket = -1;
+        }
+
+        logStreamOpenAddress = address;
+        logStreamOpenPort = port;
+
+        if (address != 0)
+        {
+            logStreamSocket = socket(AF_INET, SOCK_DGRAM, IPPROTO_IP);
+            if (logStreamSocket >= 0)
+                fcntl(logStreamSocket, F_SETFL, fcntl(logStreamSocket, F_GETFL, 0) | O_NONBLOCK);
+            else
+                ESP_LOGE("_log ", "logStreamService(): Unable to create the log stream socket.  errno %d", errno);
+        }
+        logStreamMetricsMs = now;
+    }
+
+    if (logStreamSocket < 0)
+        return;
+
+    if ((now - logStreamMetricsMs) >= LOG_STREAM_METRICS_MS)
+    {
+        logStreamMetricsMs = now;
+
+        // #M <timeStamp> <ring dropped> <suppressed> <stream lost> <log heap allocs> <transitions>  -- all numbers in decimal
+        length = snprintf(metrics, sizeof(metrics), "#M %" PRIu32 " %" PRIu32 " %" PRIu32 " %" PRIu32 " %" PRIu32 " %" PRIu32, now, Logging::getLogDroppedCount(),
+                          LOG_RateLimit::getLogSuppressedCount(), getLogStreamLostCount(), LOG_Heap::getLogHeapAllocs(), LOG_Telemetry::getTransitionHead());
+        logStreamAppend(metrics, length, false);
+    }
+
+    if ((logStreamLength > 0) && ((now - logStreamFrameMs) >= LOG_STREAM_FLUSH_MS))
+        logStreamFlush();
+}
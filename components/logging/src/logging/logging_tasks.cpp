@@ -0,0 +1,219 @@
+#include "logging/logging_tasks.hpp"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include <cstdio>
+#include <cinttypes>
+#include <cstring>
+
+//
+// The task registry replaces the hand written list of xTaskGetHandle() blocks we used for stack reports.  Sampling takes the
+// registry lock so a task can't unregister (and be deleted) while we are reading its stack.  ESP-IDF reports high water
+// marks in bytes.
+//
+LOG_TaskEntry LOG_Tasks::taskRegistry[LOG_TASK_SLOTS] = {};
+portMUX_TYPE LOG_Tasks::taskRegistryLock = portMUX_INITIALIZER_UNLOCKED;
+
+void LOG_Tasks::registerTask(TaskHandle_t handle, uint32_t stackBytes, uint8_t *stackSizeK, const char *nvsNamespace, const char *nvsKey)
+{
+    bool registered = false;
+
+    if (handle == nullptr)
+        return;
+
+    portENTER_CRITICAL(&taskRegistryLock);
+    for (int i = 0; i < LOG_TASK_SLOTS; i++)
+    {
+        if (taskRegistry[i].handle == nullptr)
+        {
+            taskRegistry[i].handle = handle;
+            strlcpy(taskRegistry[i].name, pcTaskGetName(handle), sizeof(taskRegistry[i].name));
+            taskRegistry[i].nvsNamespace = nvsNamespace;
+            taskRegistry[i].nvsKey = nvsKey;
+            taskRegistry[i].stackSizeK = stackSizeK;
+            taskRegistry[i].stackBytes = stackBytes;
+            taskRegistry[i].minFreeBytes = stackBytes;
+            taskRegistry[i].samples = 0;
+            taskRegistry[i].priority = uxTaskPriorityGet(handle);
+            registered = true;
+            break;
+        }
+    }
+    portEXIT_CRITICAL(&taskRegistryLock);
+
+    if (!registered)
+        ESP_LOGE("_log ", "registerTask(): No free slot for %s.  Increase LOG_TASK_SLOTS.", pcTaskGetName(handle));
+}
+
+void LOG_Tasks::unregisterTask(TaskHandle_t handle)
+{
+    if (handle == nullptr)
+        handle = xTaskGetCurrentTaskHandle();
+
+    portENTER_CRITICAL(&taskRegistryLock);
+    for (int i = 0; i < LOG_TASK_SLOTS; i++)
+    {
+        if (taskRegistry[i].handle == handle)
+            taskRegistry[i] = {};
+    }
+    portEXIT_CRITICAL(&taskRegistryLock);
+}
+
+void LOG_Tasks::sampleTaskStacks(void)
+{
+    uint32_t freeBytes = 0;
+
+    portENTER_CRITICAL(&taskRegistryLock);
+    for (int i = 0; i < LOG_TASK_SLOTS; i++)
+    {
+        if (taskRegistry[i].handle == nullptr)
+            continue;
+
+        freeBytes = uxTaskGetStackHighWaterMark(taskRegistry[i].handle);
+        if (freeBytes < taskRegistry[i].minFreeBytes)
+            taskRegistry[i].minFreeBytes = freeBytes;
+        taskRegistry[i].samples++;
+        taskRegistry[i].priority = uxTaskPriorityGet(taskRegistry[i].handle);
+    }
+    portEXIT_CRITICAL(&taskRegistryLock);
+}
+
+bool LOG_Tasks::getTaskEntry(uint8_t index, LOG_TaskEntry *entry)
+{
+    bool valid = false;
+
+    if (index >= LOG_TASK_SLOTS)
+        return false;
+
+    portENTER_CRITICAL(&taskRegistryLock);
+    if (taskRegistry[index].handle != nullptr)
+    {
+        *entry = taskRegistry[index];
+        valid = true;
+    }
+    portEXIT_CRITICAL(&taskRegistryLock);
+    return valid;
+}
+
+uint8_t LOG_Tasks::getTunedStackSizeK(const LOG_TaskEntry *entry)
+{
+    if ((entry->stackSizeK == nullptr) || (entry->nvsNamespace == nullptr) || (entry->samples == 0))
+        return 0;
+
+    uint32_t usedBytes = entry->stackBytes - entry->minFreeBytes;
+    uint32_t tunedK = (usedBytes + LOG_STACK_MARGIN_BYTES + 1023) / 1024; // Round up to a whole K
+
+    if (tunedK < LOG_STACK_MIN_K)
+        tunedK = LOG_STACK_MIN_K;
+
+    if (tunedK > LOG_STACK_MAX_K)
+        tunedK = LOG_STACK_MAX_K;
+
+    if (tunedK == *entry->stackSizeK)
+        return 0;
+
+    if ((tunedK < *entry->stackSizeK) && ((LOG_STACK_SHRINK == 0) || (entry->samples < LOG_STACK_TUNE_SAMPLES))) // Grow at once, shrink only after a long look
+        return 0;
+
+    return (uint8_t)tunedK;
+}
+
+//
+// An owner restores its stack size before it creates its task, so its own copy still holds the compiled default.  Unless
+// shrinking is turned on, a stored size smaller than that is ignored, and so is anything too large to be a real stack size.
+//
+bool LOG_Tasks::stackSizeKValid(uint8_t sizeK, uint8_t defaultK)
+{
+    uint8_t smallestK = (LOG_STACK_SHRINK == 0) ? defaultK : LOG_STACK_MIN_K;
+
+    return (sizeK >= smallestK) && (sizeK <= LOG_STACK_MAX_K);
+}
+
+void LOG_Tasks::printTaskRegistry(void)
+{
+    LOG_TaskEntry entry = {};
+
+    sampleTaskStacks(); // The table shows the lowest free stack ever seen, which includes this moment
+
+    for (uint8_t i = 0; i < LOG_TASK_SLOTS; i++)
+    {
+        if (!getTaskEntry(i, &entry))
+            continue;
+
+        printf("  %-10s   %02d           %-6" PRIu32 "  of %-6" PRIu32 " tuned %dK\n", entry.name, (int)entry.priority, entry.minFreeBytes, entry.stackBytes, getTunedStackSizeK(&entry));
+    }
+}
+
+//
+// Every run loop beats once a pass and says how long the next pass may take in its present state.  The System timer task
+// checks the beats once a second.  A loop which misses its beat is reported once, with the state it was in, and counted
+// until it beats again.
+//
+void LOG_Tasks::heartbeat(uint8_t state, uint32_t maxPeriodMs)
+{
+    TaskHandle_t handle = xTaskGetCurrentTaskHandle();
+    int64_t nowUs = esp_timer_get_time();
+    uint32_t gapMs = 0;
+
+    portENTER_CRITICAL(&taskRegistryLock);
+    for (int i = 0; i < LOG_TASK_SLOTS; i++)
+    {
+        if (taskRegistry[i].handle != handle)
+            continue;
+
+        if (taskRegistry[i].beats > 0)
+        {
+            gapMs = (uint32_t)((nowUs - taskRegistry[i].lastBeatUs) / 1000);
+            if (gapMs > taskRegistry[i].longestGapMs)
+                taskRegistry[i].longestGapMs = gapMs;
+        }
+
+        taskRegistry[i].beats++;
+        taskRegistry[i].lastBeatUs = nowUs;
+        taskRegistry[i].maxPeriodMs = maxPeriodMs;
+        taskRegistry[i].state = state;
+        taskRegistry[i].stalled = false;
+        break;
+    }
+    portEXIT_CRITICAL(&taskRegistryLock);
+}
+
+bool LOG_Tasks::checkHeartbeat(uint8_t index, int64_t nowUs, LOG_TaskEntry *entry)
+{
+    bool newStall = false;
+
+    if (index >= LOG_TASK_SLOTS)
+        return false;
+
+    portENTER_CRITICAL(&taskRegistryLock);
+    if ((taskRegistry[index].handle != nullptr) && (taskRegistry[index].beats > 0))
+    {
+        if (!taskRegistry[index].stalled && ((nowUs - taskRegistry[index].lastBeatUs) > ((int64_t)taskRegistry[index].maxPeriodMs * 1000)))
+        {
+            taskRegistry[index].stalled = true;
+            taskRegistry[index].stalls++;
+            newStall = true;
+        }
+        *entry = taskRegistry[index];
+    }
+    portEXIT_CRITICAL(&taskRegistryLock);
+    return newStall;
+}
+
+void LOG_Tasks::printHeartbeats(void)
+{
+    LOG_TaskEntry entry = {};
+    int64_t nowUs = esp_timer_get_time();
+
+    printf("  run loop     beats      state  last ms ago  allowed ms  longest ms  stalls\n");
+
+    for (uint8_t i = 0; i < LOG_TASK_SLOTS; i++)
+    {
+        if (!getTaskEntry(i, &entry) || (entry.beats == 0))
+            continue;
+
+        printf("  %-10s   %-9" PRIu32 "  %5d  %-11" PRId64 "  %-10" PRIu32 "  %-10" PRIu32 "  %" PRIu32 "%s\n", entry.name, entry.beats, entry.state,
+               (nowUs - entry.lastBeatUs) / 1000, entry.maxPeriodMs, entry.longestGapMs, entry.stalls, entry.stalled ? "  STALLED" : "");
+    }
+}
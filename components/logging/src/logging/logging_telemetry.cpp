@@ -0,0 +1,119 @@
+#include "logging/logging_telemetry.hpp"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include <cinttypes>
+
+//
+// State transitions from every LOG_StateStep<> go into one small ring.  A record is 16 bytes and is written under a spinlock,
+// so it is cheap enough to leave on in production.  Old records are simply overwritten.
+//
+LOG_Transition LOG_Telemetry::transitions[LOG_TRANSITION_SLOTS] = {};
+uint32_t LOG_Telemetry::transitionHead = 0;
+portMUX_TYPE LOG_Telemetry::transitionLock = portMUX_INITIALIZER_UNLOCKED;
+
+const char *LOG_Telemetry::getMachineName(LOG_MACHINE machine)
+{
+    switch (machine)
+    {
+    case LOG_MACHINE::Sys_Init:
+        return "SYS_INIT";
+    case LOG_MACHINE::Wifi_Conn:
+        return "WIFI_CONN";
+    case LOG_MACHINE::Wifi_Disc:
+        return "WIFI_DISC";
+    case LOG_MACHINE::Prov_Run:
+        return "PROV_RUN";
+    case LOG_MACHINE::SNTP_Conn:
+        return "SNTP_CONN";
+    case LOG_MACHINE::I2C_Init:
+        return "I2C_INIT";
+    default:
+        return "?";
+    }
+}
+
+void LOG_Telemetry::logTransition(LOG_MACHINE machine, uint8_t from, uint8_t to)
+{
+    int64_t timeUs = esp_timer_get_time();
+
+    portENTER_CRITICAL(&transitionLock);
+    LOG_Transition *record = &transitions[transitionHead & (LOG_TRANSITION_SLOTS - 1)];
+    record->timeUs = timeUs;
+    record->machine = machine;
+    record->from = from;
+    record->to = to;
+    transitionHead++;
+    portEXIT_CRITICAL(&transitionLock);
+}
+
+uint32_t LOG_Telemetry::getTransitionHead(void)
+{
+    uint32_t head = 0;
+
+    portENTER_CRITICAL(&transitionLock);
+    head = transitionHead;
+    portEXIT_CRITICAL(&transitionLock);
+    return head;
+}
+
+bool LOG_Telemetry::getTransition(uint32_t position, LOG_Transition *transition)
+{
+    bool valid = false;
+
+    portENTER_CRITICAL(&transitionLock);
+    if ((((transitionHead - position) - 1) < LOG_TRANSITION_SLOTS) && ((transitionHead - position) <= transitionHead)) // Written and not yet overwritten
+    {
+        *transition = transitions[position & (LOG_TRANSITION_SLOTS - 1)];
+        valid = true;
+    }
+    portEXIT_CRITICAL(&transitionLock);
+    return valid;
+}
+
+//
+// A stay in a step runs from the transition into it until the next transition of the same machine.  We walk back from the
+// newest record and return either the most recent completed stay or the longest one still held in the ring.
+//
+int64_t LOG_Telemetry::getStateDuration(LOG_MACHINE machine, uint8_t step, bool latest)
+{
+    LOG_Transition transition = {};
+    uint32_t head = getTransitionHead();
+    int64_t leftUs = -1; // Time the machine left the step we are looking at.  Unknown until we meet a later transition.
+    int64_t result = -1;
+
+    for (uint32_t position = head - 1; getTransition(position, &transition); position--)
+    {
+        if (transition.machine != machine)
+            continue;
+
+        if ((transition.to == step) && (leftUs >= 0))
+        {
+            if (latest)
+                return leftUs - transition.timeUs;
+
+            if ((leftUs - transition.timeUs) > result)
+                result = leftUs - transition.timeUs;
+        }
+
+        leftUs = transition.timeUs;
+    }
+    return result;
+}
+
+void LOG_Telemetry::printTransitions(LOG_MACHINE machine, uint8_t count)
+{
+    LOG_Transition transition = {};
+    uint32_t head = getTransitionHead();
+    uint8_t shown = 0;
+
+    for (uint32_t position = head - 1; (shown < count) && getTransition(position, &transition); position--)
+    {
+        if ((machine != LOG_MACHINE::Count) && (transition.machine != machine)) // LOG_MACHINE::Count shows every machine
+            continue;
+
+        ESP_LOGW("_log ", "%12" PRId64 " us  %-9s %3d -> %3d", transition.timeUs, getMachineName(transition.machine), transition.from, transition.to);
+        shown++;
+    }
+}
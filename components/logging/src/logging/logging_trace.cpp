@@ -0,0 +1,154 @@
+#include "logging/logging_trace.hpp"
+#include "logging/logging_tasks.hpp"     // Row names
+#include "logging/logging_telemetry.hpp" // A row for every state machine
+
+#include "sdkconfig.h"
+#include "esp_timer.h"
+
+#include <cstdio>
+#include <cinttypes>
+
+//
+// Trace spans go into a small ring next to the state transition ring.  exportTrace() prints both as one Chrome trace
+// (the JSON "traceEvents" format), which chrome://tracing and ui.perfetto.dev both open.  Spans show on the row of the task
+// that ran them.  Each state machine gets a row of its own, with one span for every stay in a step.
+//
+// Nothing here depends on the chip, so the same spans work in the Linux host build.
+//
+LOG_TraceEvent LOG_Trace::traceEvents[LOG_TRACE_SLOTS] = {};
+uint32_t LOG_Trace::traceHead = 0;
+portMUX_TYPE LOG_Trace::traceLock = portMUX_INITIALIZER_UNLOCKED;
+
+#define TRACE_BEGIN_MARKER "#TRACE-BEGIN" // tools/trace_extract.py copies out what lies between these
+#define TRACE_END_MARKER "#TRACE-END"
+#define TRACE_TID_OTHER 99    // Spans from tasks which are not in the task registry
+#define TRACE_TID_MACHINE 100 // Plus the LOG_MACHINE value
+
+LOG_TraceSpan::LOG_TraceSpan(const char *name, uint16_t arg) : name(name), arg(arg), startUs(esp_timer_get_time())
+{
+}
+
+LOG_TraceSpan::~LOG_TraceSpan()
+{
+    LOG_Trace::traceRecord(name, arg, startUs, esp_timer_get_time());
+}
+
+void LOG_Trace::traceRecord(const char *name, uint16_t arg, int64_t startUs, int64_t endUs)
+{
+    TaskHandle_t task = xTaskGetCurrentTaskHandle();
+#if CONFIG_IDF_TARGET_LINUX
+    uint8_t core = 0;
+#else
+    uint8_t core = (uint8_t)xPortGetCoreID();
+#endif
+
+    portENTER_CRITICAL(&traceLock);
+    LOG_TraceEvent *event = &traceEvents[traceHead & (LOG_TRACE_SLOTS - 1)];
+    event->startUs = startUs;
+    event->durationUs = (uint32_t)(endUs - startUs);
+    event->name = name;
+    event->task = task;
+    event->arg = arg;
+    event->core = core;
+    traceHead++;
+    portEXIT_CRITICAL(&traceLock);
+}
+
+void LOG_Trace::clearTrace(void)
+{
+    portENTER_CRITICAL(&traceLock);
+    traceHead = 0;
+    portEXIT_CRITICAL(&traceLock);
+}
+
+static void traceSeparator(bool *first)
+{
+    printf("%s\n", *first ? "" : ",");
+    *first = false;
+}
+
+void LOG_Trace::exportTrace(void)
+{
+    LOG_TraceEvent event = {};
+    LOG_TaskEntry entry = {};
+    LOG_Transition transition = {};
+    LOG_Transition last[(int)LOG_MACHINE::Count] = {};
+    bool haveLast[(int)LOG_MACHINE::Count] = {};
+    uint32_t head = 0;
+    uint32_t tid = 0;
+    bool valid = false;
+    bool first = true;
+
+    printf(TRACE_BEGIN_MARKER "\n{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+    for (uint8_t i = 0; i < LOG_TASK_SLOTS; i++) // Row names
+    {
+        if (LOG_Tasks::getTaskEntry(i, &entry))
+        {
+            traceSeparator(&first);
+            printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}", i + 1, entry.name);
+        }
+    }
+
+    traceSeparator(&first);
+    printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"other tasks\"}}", TRACE_TID_OTHER);
+
+    for (int machine = 0; machine < (int)LOG_MACHINE::Count; machine++)
+    {
+        traceSeparator(&first);
+        printf("{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%d,\"args\":{\"name\":\"%s\"}}", TRACE_TID_MACHINE + machine, LOG_Telemetry::getMachineName((LOG_MACHINE)machine));
+    }
+
+    portENTER_CRITICAL(&traceLock);
+    head = traceHead;
+    portEXIT_CRITICAL(&traceLock);
+
+    for (uint32_t position = (head > LOG_TRACE_SLOTS) ? (head - LOG_TRACE_SLOTS) : 0; position < head; position++) // Spans, oldest first
+    {
+        portENTER_CRITICAL(&traceLock);
+        valid = ((traceHead - position) <= LOG_TRACE_SLOTS); // Not overwritten since we read the head
+        event = traceEvents[position & (LOG_TRACE_SLOTS - 1)];
+        portEXIT_CRITICAL(&traceLock);
+
+        if (!valid)
+            continue;
+
+        tid = TRACE_TID_OTHER;
+        for (uint8_t i = 0; i < LOG_TASK_SLOTS; i++)
+        {
+            if (LOG_Tasks::getTaskEntry(i, &entry) && (entry.handle == event.task))
+            {
+                tid = i + 1;
+                break;
+            }
+        }
+
+        traceSeparator(&first);
+        printf("{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":%" PRIu32 ",\"ts\":%" PRId64 ",\"dur\":%" PRIu32 ",\"args\":{\"arg\":%d,\"core\":%d}}", event.name, tid,
+               event.startUs, event.durationUs, event.arg, event.core);
+    }
+
+    //
+    // A stay in a step runs from the transition into it until the next transition of the same machine.  The step a machine
+    // is in now has no end yet, so it isn't shown.
+    //
+    head = LOG_Telemetry::getTransitionHead();
+    for (uint32_t position = (head > LOG_TRANSITION_SLOTS) ? (head - LOG_TRANSITION_SLOTS) : 0; position < head; position++)
+    {
+        if (!LOG_Telemetry::getTransition(position, &transition))
+            continue;
+
+        int machine = (int)transition.machine;
+        if (haveLast[machine])
+        {
+            traceSeparator(&first);
+            printf("{\"name\":\"%s %d\",\"ph\":\"X\",\"pid\":1,\"tid\":%d,\"ts\":%" PRId64 ",\"dur\":%" PRId64 ",\"args\":{\"step\":%d}}", LOG_Telemetry::getMachineName(transition.machine),
+                   last[machine].to, TRACE_TID_MACHINE + machine, last[machine].timeUs, transition.timeUs - last[machine].timeUs, last[machine].to);
+        }
+
+        last[machine] = transition;
+        haveLast[machine] = true;
+    }
+
+    printf("\n]}\n" TRACE_END_MARKER "\n");
+}
@@ -18,6 +18,11 @@
 #include "logging/logging_.hpp"
 #include "diagnostics/diagnostics_.hpp"
 
+/* Compile Time Log Level */
+#ifndef NVS_LOG_LEVEL_COMPILED
+#define NVS_LOG_LEVEL_COMPILED ESP_LOG_INFO // Log sites above this level are left out of the build
+#endif
+
 /* Forward Declarations */
 class System;
 class Logging;
@@ -33,6 +38,8 @@ extern "C"
             return &nvsInstance;
         }
 
+        void setShowFlags(uint8_t); // Only log sites built under NVS_LOG_LEVEL_COMPILED can be shown.
+
         /* NVS */
         void eraseNVSPartition(const char str[] = NVS_DEFAULT_PART_NAME);
         void eraseNVSNamespace(char str[]);
@@ -55,6 +62,11 @@ extern "C"
         esp_err_t readU32IntegerFromNVS(const char *, uint32_t *);
         esp_err_t writeU32IntegerToNVS(const char *, uint32_t);
 
+        esp_err_t readBlobFromNVS(const char *, void *, size_t *); // Does not create a missing key.  Returns ESP_ERR_NVS_NOT_FOUND.
+        esp_err_t writeBlobToNVS(const char *, const void *, size_t);
+
+        esp_err_t getNVSStats(nvs_stats_t *); // Entry counts of the default partition.  No need to open a namespace.
+
         /* Error storage and retreival routines (currently not used inside this project) */
         // uint8_t getErrorCount(void);
         // esp_err_t readErrorStringFromNVS(std::string *strValue);
@@ -69,6 +81,7 @@ extern "C"
         NVS(const NVS &) = delete;            // Disable copy constructor
         void operator=(NVS const &) = delete; // Disable assignment operator
 
+        static constexpr esp_log_level_t logLevelCompiled = NVS_LOG_LEVEL_COMPILED;
         char TAG[6] = "_nvs ";
 
         /* Object References */
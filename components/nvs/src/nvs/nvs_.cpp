@@ -43,6 +43,12 @@ void NVS::setFlags()
     // show |= _showPayload;
 }
 
+void NVS::setShowFlags(uint8_t showFlags)
+{
+    show = showFlags;
+    setLogLevels();
+}
+
 void NVS::setLogLevels()
 {
     if (show > 0)                             // Normally, we are interested in the variables inside our object.
@@ -71,7 +77,7 @@ void NVS::initializeNVS()
 
     if ((ret == ESP_ERR_NVS_NO_FREE_PAGES) || (ret == ESP_ERR_NOT_FOUND) || (ret == ESP_ERR_NVS_NEW_VERSION_FOUND))
     {
-        logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): ********** Erasing NVS for use. **********");
+        LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): ********** Erasing NVS for use. **********");
         ESP_ERROR_CHECK(nvs_flash_erase()); // NVS partition was truncated and needs to be erased
         ESP_ERROR_CHECK(nvs_flash_init());  // Retry nvs_flash_init
     }
@@ -83,7 +89,7 @@ void NVS::initializeNVS()
 void NVS::eraseNVSPartition(const char str[])
 {
     ESP_ERROR_CHECK(nvs_flash_erase_partition(str));
-    logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): NVS Erased partition " + std::string(str));
+    LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): NVS Erased partition " + std::string(str));
 }
 
 void NVS::eraseNVSNamespace(char str[])
@@ -91,7 +97,7 @@ void NVS::eraseNVSNamespace(char str[])
     ESP_ERROR_CHECK(openNVSStorage(str));
     ESP_ERROR_CHECK(nvs_erase_all(nvsHandle));
     ESP_ERROR_CHECK(closeNVStorage());
-    logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): NVS Erased namespace " + std::string(str));
+    LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): NVS Erased namespace " + std::string(str));
 }
 
 esp_err_t NVS::openNVSStorage(const char *name_space)
@@ -104,7 +110,7 @@ esp_err_t NVS::closeNVStorage()
 {
     if (nvsHandle == 0)
     {
-        logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
         return ESP_FAIL;
     }
 
@@ -119,12 +125,12 @@ esp_err_t NVS::readBooleanFromNVS(const char *key, bool *value)
 {
     if (nvsHandle == 0)
     {
-        logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
         return ESP_ERR_NVS_INVALID_HANDLE;
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in a key of: " + std::string(key));
+        LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in a key of: " + std::string(key));
 
     esp_err_t ret = ESP_OK;
     uint8_t intValue = (int)*value; // Copy value converting boolean to integer.
@@ -135,7 +141,7 @@ esp_err_t NVS::readBooleanFromNVS(const char *key, bool *value)
     {
         if (intValue > 1)
         {
-            logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): Improper value of " + std::to_string(intValue) + "stored");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): Improper value of " + std::to_string(intValue) + "stored");
             return ESP_FAIL;
         }
 
@@ -144,11 +150,11 @@ esp_err_t NVS::readBooleanFromNVS(const char *key, bool *value)
     else if (ret == ESP_ERR_NVS_NOT_FOUND)
     {
         // If the call to nvs_get_u8 fails, the default value passed in by reference is unchanged.  We use that value for a first time save.
-        logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): New Bool value stored as u8int with key of " + std::string(key) + " = " + std::to_string(intValue));
+        LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): New Bool value stored as u8int with key of " + std::string(key) + " = " + std::to_string(intValue));
         return nvs_set_u8(nvsHandle, key, intValue);
     }
     else // Unexpected Error
-        logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): nvs_get_u8(nvsHandle, key, &val) failed, code = " + esp_err_to_name(ret));
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): nvs_get_u8(nvsHandle, key, &val) failed, code = " + esp_err_to_name(ret));
 
     return ret;
 }
@@ -157,12 +163,12 @@ esp_err_t NVS::writeBooleanToNVS(const char *key, bool newValue)
 {
     if (nvsHandle == 0)
     {
-        logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
         return ESP_ERR_NVS_INVALID_HANDLE;
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in key " + std::string(key) + " with value of: " + std::to_string(newValue));
+        LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in key " + std::string(key) + " with value of: " + std::to_string(newValue));
 
     uint8_t storedValue = 0;
 
@@ -176,7 +182,7 @@ esp_err_t NVS::writeBooleanToNVS(const char *key, bool newValue)
         if (newValue != storedValue) // If the value has changed or empty, then update with new value
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): writeU8IntegerToNVS is key " + std::string(key) + " with value of: " + std::to_string(newValue));
+                LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): writeU8IntegerToNVS is key " + std::string(key) + " with value of: " + std::to_string(newValue));
 
             ret = nvs_set_u8(nvsHandle, key, (uint8_t)newValue); // Casts the boolean to an integer
         }
@@ -184,7 +190,7 @@ esp_err_t NVS::writeBooleanToNVS(const char *key, bool newValue)
     else
     {
         if (show & _showNVS) // Unexpected Error
-            logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): writeU8IntegerToNVS failed esp_err_t code = " + esp_err_to_name(ret));
+            LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): writeU8IntegerToNVS failed esp_err_t code = " + esp_err_to_name(ret));
     }
 
     if (show & _showNVS)
@@ -196,7 +202,7 @@ esp_err_t NVS::writeBooleanToNVS(const char *key, bool newValue)
         else
             trueFalse = "false";
 
-        logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): saveBooleanAsString key " + std::string(key) + " with value of: " + std::to_string(newValue));
+        LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): saveBooleanAsString key " + std::string(key) + " with value of: " + std::to_string(newValue));
     }
 
     return ret;
@@ -206,12 +212,12 @@ esp_err_t NVS::readStringFromNVS(const char *key, std::string *strValue)
 {
     if (nvsHandle == 0)
     {
-        logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
         return ESP_ERR_NVS_INVALID_HANDLE;
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in a key of: " + std::string(key));
+        LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in a key of: " + std::string(key));
 
     esp_err_t ret;
     std::string storedValue = "";
@@ -235,7 +241,7 @@ esp_err_t NVS::readStringFromNVS(const char *key, std::string *strValue)
             *strValue = storedValue;
 
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Retrieved " + std::string(key) + " from NVS of: " + std::string(storedValue)); // Debug print statements
+                LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Retrieved " + std::string(key) + " from NVS of: " + std::string(storedValue)); // Debug print statements
 
             return ret;
         }
@@ -243,7 +249,7 @@ esp_err_t NVS::readStringFromNVS(const char *key, std::string *strValue)
     else if ((ret == ESP_ERR_NVS_NOT_FOUND) || (ret < ESP_ERR_NVS_BASE)) // Stored value doesn't exist OR stored value DOES exist is empty (no error)
         return nvs_set_str(nvsHandle, key, strValue->c_str());           // Save the value which was passed to our function by reference.
 
-    logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): readStringFromNVS() failed for some reason, code = " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): readStringFromNVS() failed for some reason, code = " + esp_err_to_name(ret));
     return ret;
 }
 
@@ -251,12 +257,12 @@ esp_err_t NVS::writeStringToNVS(const char *key, std::string *newValue)
 {
     if (nvsHandle == 0)
     {
-        logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
         return ESP_ERR_NVS_INVALID_HANDLE;
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in key " + std::string(key) + " with value of: " + *newValue);
+        LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in key " + std::string(key) + " with value of: " + *newValue);
 
     esp_err_t ret = ESP_OK;
     char *tempChars;
@@ -284,7 +290,7 @@ esp_err_t NVS::writeStringToNVS(const char *key, std::string *newValue)
     else if (ret == ESP_ERR_NVS_NOT_FOUND)
         return nvs_set_str(nvsHandle, key, newValue->c_str()); // Save the new value which was passed to our function by reference.  We are done.
 
-    logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): writeStringToNVS() failed for some reason, code = " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): writeStringToNVS() failed for some reason, code = " + esp_err_to_name(ret));
     return ret;
 }
 
@@ -292,23 +298,23 @@ esp_err_t NVS::readU8IntegerFromNVS(const char *key, uint8_t *intValue)
 {
     if (nvsHandle == 0)
     {
-        logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
         return ESP_ERR_NVS_INVALID_HANDLE;
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in a key of: " + std::string(key));
+        LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in a key of: " + std::string(key));
 
     esp_err_t ret = nvs_get_u8(nvsHandle, key, intValue);
 
     if (ret == ESP_ERR_NVS_NOT_FOUND)
     {
         // If the call to nvs_get_u32 fails, the default value passed in by reference is unchanged.  We use that value to save for the first time.
-        logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): New value stored as u8int with key of " + std::string(key) + " = " + std::to_string(*intValue));
+        LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): New value stored as u8int with key of " + std::string(key) + " = " + std::to_string(*intValue));
         return nvs_set_u8(nvsHandle, key, *intValue);
     }
     else if (ret != ESP_OK) // Unexpected Error
-        logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): read failed esp_err_t code = " + esp_err_to_name(ret));
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): read failed esp_err_t code = " + esp_err_to_name(ret));
     return ret;
 }
 
@@ -316,12 +322,12 @@ esp_err_t NVS::writeU8IntegerToNVS(const char *key, uint8_t newValue)
 {
     if (nvsHandle == 0)
     {
-        logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
         return ESP_ERR_NVS_INVALID_HANDLE;
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in key " + std::string(key) + " with value of: " + std::to_string(newValue));
+        LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in key " + std::string(key) + " with value of: " + std::to_string(newValue));
 
     uint8_t storedValue = 0;
 
@@ -335,7 +341,7 @@ esp_err_t NVS::writeU8IntegerToNVS(const char *key, uint8_t newValue)
         if (newValue != storedValue) // If the value has changed or empty, then update with new value
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): writeU8IntegerToNVS is key " + std::string(key) + " with value of: " + std::to_string(newValue));
+                LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): writeU8IntegerToNVS is key " + std::string(key) + " with value of: " + std::to_string(newValue));
 
             ret = nvs_set_u8(nvsHandle, key, newValue);
         }
@@ -343,7 +349,7 @@ esp_err_t NVS::writeU8IntegerToNVS(const char *key, uint8_t newValue)
     else
     {
         if (show & _showNVS) // Unexpected Error
-            logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): writeU8IntegerToNVS failed esp_err_t code = " + esp_err_to_name(ret));
+            LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): writeU8IntegerToNVS failed esp_err_t code = " + esp_err_to_name(ret));
     }
     return ret;
 }
@@ -352,23 +358,23 @@ esp_err_t NVS::readI32IntegerFromNVS(const char *key, int32_t *intValue)
 {
     if (nvsHandle == 0)
     {
-        logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
         return ESP_ERR_NVS_INVALID_HANDLE;
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in a key of: " + std::string(key));
+        LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in a key of: " + std::string(key));
 
     esp_err_t ret = nvs_get_i32(nvsHandle, key, intValue);
 
     if (ret == ESP_ERR_NVS_NOT_FOUND)
     {
         // If the call to nvs_get_i32 fails, the default value passed in by reference is unchanged.  We use that value to save for the first time.
-        logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): New value stored as i32int with key of " + std::string(key));
+        LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): New value stored as i32int with key of " + std::string(key));
         return nvs_set_i32(nvsHandle, key, *intValue);
     }
     else if (ret != ESP_OK) // Unexpected Error
-        logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): read failed esp_err_t code = " + esp_err_to_name(ret));
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): read failed esp_err_t code = " + esp_err_to_name(ret));
     return ret;
 }
 
@@ -376,12 +382,12 @@ esp_err_t NVS::writeI32IntegerToNVS(const char *key, int32_t newValue)
 {
     if (nvsHandle == 0)
     {
-        logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
         return ESP_ERR_NVS_INVALID_HANDLE;
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in key " + std::string(key) + " with value of: " + std::to_string(newValue));
+        LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in key " + std::string(key) + " with value of: " + std::to_string(newValue));
 
     int32_t storedValue = 0;
 
@@ -394,7 +400,7 @@ esp_err_t NVS::writeI32IntegerToNVS(const char *key, int32_t newValue)
         if (newValue != storedValue) // If the value has changed or empty, then update with new value
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): writeI32IntegerToNVS is key " + std::string(key) + " with value of: " + std::to_string(newValue));
+                LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): writeI32IntegerToNVS is key " + std::string(key) + " with value of: " + std::to_string(newValue));
 
             ret = nvs_set_i32(nvsHandle, key, newValue);
         }
@@ -403,7 +409,7 @@ esp_err_t NVS::writeI32IntegerToNVS(const char *key, int32_t newValue)
     if (ret != ESP_OK)
     {
         if (show & _showNVS) // Unexpected Error
-            logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): writeI32IntegerToNVS failed esp_err_t code = " + esp_err_to_name(ret));
+            LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): writeI32IntegerToNVS failed esp_err_t code = " + esp_err_to_name(ret));
     }
     return ret;
 }
@@ -412,23 +418,23 @@ esp_err_t NVS::readU32IntegerFromNVS(const char *key, uint32_t *intValue)
 {
     if (nvsHandle == 0)
     {
-        logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
         return ESP_ERR_NVS_INVALID_HANDLE;
     }
 
     if (show & _showNVS)
-       logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in a key of: " + std::string(key));
+       LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in a key of: " + std::string(key));
 
     esp_err_t ret = nvs_get_u32(nvsHandle, key, intValue);
 
     if (ret == ESP_ERR_NVS_NOT_FOUND)
     {
         // If the call to nvs_get_u32 fails, the default value passed in by reference is unchanged.  We use that value to save for the first time.
-        logByValue(ESP_LOG_WARN, semNVSRouteLock, TAG, std::string(__func__) + "(): New value stored as u32int with key of " + std::string(key));
+        LOG_BY_VALUE(ESP_LOG_WARN, semNVSRouteLock, TAG, std::string(__func__) + "(): New value stored as u32int with key of " + std::string(key));
         return nvs_set_u32(nvsHandle, key, *intValue);
     }
     else if (ret != ESP_OK) // Unexpected Error
-        logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): Read failed esp_err_t code = " + esp_err_to_name(ret));
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): Read failed esp_err_t code = " + esp_err_to_name(ret));
     return ret;
 }
 
@@ -436,12 +442,12 @@ esp_err_t NVS::writeU32IntegerToNVS(const char *key, uint32_t newValue)
 {
     if (nvsHandle == 0)
     {
-        logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
         return ESP_ERR_NVS_INVALID_HANDLE;
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in key " + std::string(key) + " with value of: " + std::to_string(newValue));
+        LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in key " + std::string(key) + " with value of: " + std::to_string(newValue));
 
     uint32_t storedValue = 0;
 
@@ -454,7 +460,7 @@ esp_err_t NVS::writeU32IntegerToNVS(const char *key, uint32_t newValue)
         if (newValue != storedValue) // If the value has changed, then update with new value
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in key " + std::string(key) + " with value of: " + std::to_string(newValue));
+                LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in key " + std::string(key) + " with value of: " + std::to_string(newValue));
 
             ret = nvs_set_u32(nvsHandle, key, newValue);
         }
@@ -462,7 +468,56 @@ esp_err_t NVS::writeU32IntegerToNVS(const char *key, uint32_t newValue)
     else
     {
         if (show & _showNVS) // Unexpected Error
-            logByValue(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): writeU32IntegerToNVS failed esp_err_t code = " + esp_err_to_name(ret));
+            LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): writeU32IntegerToNVS failed esp_err_t code = " + esp_err_to_name(ret));
     }
     return ret;
-}
\ No newline at end of file
+}
+esp_err_t NVS::readBlobFromNVS(const char *key, void *blob, size_t *length)
+{
+    if (nvsHandle == 0)
+    {
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+
+    if (show & _showNVS)
+        LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in a key of: " + std::string(key));
+
+    // Unlike the other reads, a missing blob is not created.  There is no sensible default to store, so the caller sees
+    // ESP_ERR_NVS_NOT_FOUND and keeps what it has.  On success, length holds the number of bytes read.
+    esp_err_t ret = nvs_get_blob(nvsHandle, key, blob, length);
+
+    if ((ret != ESP_OK) && (ret != ESP_ERR_NVS_NOT_FOUND)) // Unexpected Error (ESP_ERR_NVS_INVALID_LENGTH if the buffer is too small)
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): Read failed esp_err_t code = " + esp_err_to_name(ret));
+    return ret;
+}
+
+esp_err_t NVS::writeBlobToNVS(const char *key, const void *blob, size_t length)
+{
+    if (nvsHandle == 0)
+    {
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): You must openNVSStorage() first!");
+        return ESP_ERR_NVS_INVALID_HANDLE;
+    }
+
+    if (show & _showNVS)
+        LOG_BY_VALUE(ESP_LOG_INFO, semNVSRouteLock, TAG, std::string(__func__) + "(): Passed in key " + std::string(key) + " with length of: " + std::to_string(length));
+
+    esp_err_t ret = nvs_set_blob(nvsHandle, key, blob, length);
+
+    if (ret != ESP_OK)
+    {
+        if (show & _showNVS) // Unexpected Error
+            LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): writeBlobToNVS failed esp_err_t code = " + esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+esp_err_t NVS::getNVSStats(nvs_stats_t *stats)
+{
+    esp_err_t ret = nvs_get_stats(NULL, stats);
+
+    if (ret != ESP_OK)
+        LOG_BY_VALUE(ESP_LOG_ERROR, semNVSRouteLock, TAG, std::string(__func__) + "(): nvs_get_stats() failed esp_err_t code = " + esp_err_to_name(ret));
+    return ret;
+}
@@ -25,6 +25,9 @@
 #include "system_.hpp"
 #include "nvs/nvs_.hpp"
 #include "logging/logging_.hpp"
+#include "logging/logging_heap.hpp"
+#include "logging/logging_tasks.hpp"
+#include "logging/logging_latency.hpp"
 #include "diagnostics/diagnostics_.hpp"
 
 /* Forward Declarations */
@@ -63,6 +66,7 @@ extern "C"
         //
         // Private variables
         //
+        static constexpr esp_log_level_t logLevelCompiled = SPI_LOG_LEVEL_COMPILED;
         char TAG[6] = "_spi ";
 
         /* Object References */
@@ -90,7 +94,7 @@ extern "C"
         //
         // RTOS Related variables/functions
         //
-        uint8_t runStackSizeK = 8;           // Default/Minimum stacksize
+        uint8_t runStackSizeK = 3;           // Default/Minimum stacksize
         TaskHandle_t taskHandleRun = nullptr;
         QueueHandle_t xQueueSPICmdRequests;
         SPI_CmdRequest *ptrSPICmdReq;
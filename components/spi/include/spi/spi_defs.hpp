@@ -1,5 +1,10 @@
 #pragma once
 #include "spi_enums.hpp"
 
+/* Compile Time Log Level */
+#ifndef SPI_LOG_LEVEL_COMPILED
+#define SPI_LOG_LEVEL_COMPILED ESP_LOG_INFO // Log sites above this level are left out of the build
+#endif
+
 #define _showSPI_SomeItem 0x01 // LSB
 #define _showSPIShdnSteps 0x02
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include "freertos/FreeRTOS.h" // RTOS Libraries
 #include "freertos/queue.h"
 
+#include "logging/logging_latency.hpp" // LOG_LatencyStamp
+
 //
 // System values
 //
@@ -31,6 +33,7 @@ struct SPI_CmdRequest
     uint8_t dataLength;
     uint8_t data[32];
     bool debug = false;
+    LOG_LatencyStamp stamp; // Set by LOG_Latency::stampEnqueue() just before sending
 };
 
 struct SPI_CmdResponse
@@ -46,6 +49,7 @@ struct SPI_CmdResponse
 enum class SPI_COMMAND : uint8_t
 {
     Trans,
+    Set_Show_Flags, // data[0] = show, data[1] = showSPI.  Only log sites built under SPI_LOG_LEVEL_COMPILED can be shown.
 };
 
 enum class SPI_RESPONSE : uint8_t
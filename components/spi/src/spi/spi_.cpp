@@ -50,14 +50,16 @@ SPI::SPI(spi_host_device_t spiMyHost, int spiMyMOSIPin, int spiMyMISOPin, int sp
     spiOP = SPI_OP::Init;
     initSPIStep = SPI_INIT::Start;
 
-    logByValue(ESP_LOG_INFO, semSPIRouteLock, TAG, std::string(__func__) + "(): runStackSizeK: " + std::to_string(runStackSizeK));
-    xTaskCreate(runMarshaller, "SPI::Run", 1024 * 3, this, runStackSizeK, &taskHandleRun);
+    LOG_BY_VALUE(ESP_LOG_INFO, semSPIRouteLock, TAG, std::string(__func__) + "(): runStackSizeK: " + std::to_string(runStackSizeK));
+    System::createTask(SYS_TASK::SPI_Run, runMarshaller, "SPI::Run", &runStackSizeK, this, &taskHandleRun);
+    LOG_Tasks::registerTask(taskHandleRun, 1024 * runStackSizeK);
 }
 
 SPI::~SPI()
 {
     TaskHandle_t temp = this->taskHandleRun;
     this->taskHandleRun = nullptr;
+    LOG_Tasks::unregisterTask(temp); // Before the delete, so the registry never samples a dead task
     vTaskDelete(temp);
 
     if (xQueueSPICmdRequests != nullptr)
@@ -149,7 +151,7 @@ void SPI::createQueues()
     return;
 
 spi_createQueues_err:
-    logByValue(ESP_LOG_ERROR, semSPIRouteLock, TAG, std::string(__func__) + "(): error: " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semSPIRouteLock, TAG, std::string(__func__) + "(): error: " + esp_err_to_name(ret));
 }
 
 void SPI::destroyQueues()
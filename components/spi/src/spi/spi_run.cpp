@@ -6,10 +6,14 @@ extern SemaphoreHandle_t semSPIEntry;
 void SPI::runMarshaller(void *arg)
 {
     auto obj = (SPI *)arg;
+    LOG_Heap::setTaskHeapTag(LOG_HEAP_TAG::SPI);
     obj->run();
 
     if (obj->taskHandleRun != nullptr)
+    {
+        LOG_Tasks::unregisterTask(nullptr);
         vTaskDelete(NULL);
+    }
 }
 
 void SPI::run(void) // I2C processing lives here for the lifetime of the object
@@ -18,12 +22,34 @@ void SPI::run(void) // I2C processing lives here for the lifetime of the object
 
     while (true) // Process all incomeing I2C requests and return any results
     {
+        LOG_Tasks::heartbeat((uint8_t)spiOP); // The Run state waits up to 1.5 seconds for a request
+
         switch (spiOP)
         {
         case SPI_OP::Run:
         {
             if (xQueueReceive(xQueueSPICmdRequests, &ptrSPICmdReq, pdMS_TO_TICKS(1500))) // We wait here for each message
             {
+                LOG_Latency::latencyDequeued(LOG_LAT_SOURCE::SPI, (uint8_t)ptrSPICmdReq->command, &ptrSPICmdReq->stamp);
+
+                switch (ptrSPICmdReq->command)
+                {
+                case SPI_COMMAND::Trans:
+                {
+                    break;
+                }
+
+                case SPI_COMMAND::Set_Show_Flags:
+                {
+                    show = ptrSPICmdReq->data[0];
+                    showSPI = ptrSPICmdReq->data[1];
+                    showRun = ((show & _showRun) > 0);
+                    showInitSteps = ((show & _showInit) > 0);
+                    setLogLevels();
+                    break;
+                }
+                }
+                LOG_Latency::latencyServiced(LOG_LAT_SOURCE::SPI, (uint8_t)ptrSPICmdReq->command, &ptrSPICmdReq->stamp);
             }
 
             if (showRun)
@@ -41,7 +67,7 @@ void SPI::run(void) // I2C processing lives here for the lifetime of the object
                     ESP_LOGI(TAG, "Step 1  - Start");
 
                 //if (show & _showInit)
-                    //logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SPI_INIT::Start");
+                    //LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SPI_INIT::Start");
                 initSPIStep = SPI_INIT::Load_NVS_Settings;
                 [[fallthrough]];
             }
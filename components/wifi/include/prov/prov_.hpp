@@ -8,6 +8,9 @@
 #include <wifi_provisioning/scheme_softap.h>
 
 #include "logging/logging_.hpp"
+#include "logging/logging_heap.hpp"
+#include "logging/logging_tasks.hpp"
+#include "logging/logging_telemetry.hpp"
 #include "diagnostics/diagnostics_.hpp"
 
 ESP_EVENT_DECLARE_BASE(PROTOCOMM_SECURITY_SESSION_EVENT);
@@ -15,21 +18,25 @@ ESP_EVENT_DECLARE_BASE(PROTOCOMM_SECURITY_SESSION_EVENT);
 /* Forward Declarations */
 class System;
 class NVS;
+class Wifi;
 
 extern "C"
 {
     class PROV : private Logging, private Diagnostics // The "IS-A" relationship
     {
     public:
-        PROV(QueueHandle_t);
+        PROV(Wifi *);
         ~PROV();
 
         TaskHandle_t taskHandleRun = nullptr; // We reach into this object to copy the task handle. (NOT task safe)
 
+        void setShowFlags(uint8_t, uint8_t); // Wifi forwards its SET_SHOW_FLAGS command here
+
     private:
         PROV(const PROV &) = delete;           // Disable copy constructor
         void operator=(PROV const &) = delete; // Disable assignment operator
 
+        static constexpr esp_log_level_t logLevelCompiled = PROV_LOG_LEVEL_COMPILED;
         char TAG[6] = "_prov";
 
         System *sys = nullptr; // Object References
@@ -38,9 +45,11 @@ extern "C"
         uint8_t show = 0;
         uint8_t showPROV = 0;
 
-        QueueHandle_t wifiQueCmdRequests;
+        Wifi *wifi = nullptr; // Our owner.  Credentials go back to it as a command request.
         QueueHandle_t queueEvents = nullptr;
 
+        uint8_t runStackSizeK = 6; // Default/Minimum stacksize
+
         void setFlags(void);
         void setLogLevels(void);
         void setConditionalCompVariables(void);
@@ -92,7 +101,7 @@ extern "C"
 
         /* PROV_Run */
         PROV_OP provOP = PROV_OP::Idle;        // Object States
-        PROV_RUN provRunStep = PROV_RUN::Idle; //
+        LOG_StateStep<PROV_RUN, LOG_MACHINE::Prov_Run> provRunStep = PROV_RUN::Idle; //
 
         static void runMarshaller(void *); // Run functions
         void run(void);                    //
@@ -3,6 +3,11 @@
 
 #include "esp_bit_defs.h"
 
+/* Compile Time Log Level */
+#ifndef PROV_LOG_LEVEL_COMPILED
+#define PROV_LOG_LEVEL_COMPILED ESP_LOG_INFO // Log sites above this level are left out of the build
+#endif
+
 /* showPROV */
 #define _showProvRun 0x01 // LSB
 
@@ -6,10 +6,10 @@
 
 /* Run Notifications and Commands */
 // Task Notifications should be used for notifications or commands which need no input and return no data.
-enum class PROV_NOTIFY : uint8_t
+enum class PROV_NOTIFY : uint8_t // Bits, sent with eSetBits
 {
-    CMD_PRINT_TASK_INFO = 1,
-    CMD_LOG_TASK_INFO,
+    CMD_PRINT_TASK_INFO = 0x01,
+    CMD_LOG_TASK_INFO = 0x02,
 };
 
 /* Class Operations */
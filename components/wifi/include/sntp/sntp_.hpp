@@ -11,6 +11,9 @@
 #include "esp_netif_sntp.h"
 
 #include "logging/logging_.hpp"
+#include "logging/logging_heap.hpp"
+#include "logging/logging_telemetry.hpp"
+#include "logging/logging_trace.hpp"
 #include "diagnostics/diagnostics_.hpp"
 
 /* Forward Declarations */
@@ -35,17 +38,22 @@ extern "C"
 
         /* SNTP_Run */
         SNTP_OP sntpOP = SNTP_OP::Idle;           // Object States
-        SNTP_CONN connStep = SNTP_CONN::Idle;     //
+        LOG_StateStep<SNTP_CONN, LOG_MACHINE::SNTP_Conn> connStep = SNTP_CONN::Idle; //
         SNTP_DISC discStep = SNTP_DISC::Finished; //
 
         /* SNTP_Run */
         void run(void);
         void runEvents(void);
 
+        void setShowFlags(uint8_t, uint8_t); // Wifi forwards its SET_SHOW_FLAGS command here
+
+        LOG_HeapAllocStats runHeapAllocs = {}; // Counted on every run() call that changes no state
+
     private:
         SNTP(const SNTP &) = delete;           // Disable copy constructor
         void operator=(SNTP const &) = delete; // Disable assignment operator
 
+        static constexpr esp_log_level_t logLevelCompiled = SNTP_LOG_LEVEL_COMPILED;
         char TAG[6] = "_sntp";
 
         /* Object References */
@@ -1,5 +1,10 @@
 #pragma once
 #include "sntp/sntp_enums.hpp" // Local definitions, structs, and enumerations
 
+/* Compile Time Log Level */
+#ifndef SNTP_LOG_LEVEL_COMPILED
+#define SNTP_LOG_LEVEL_COMPILED ESP_LOG_INFO // Log sites above this level are left out of the build
+#endif
+
 /* showSNTP */
 #define _showSNTPConnSteps 0x01 // LSB
\ No newline at end of file
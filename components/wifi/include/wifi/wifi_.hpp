@@ -15,8 +15,15 @@
 #include "esp_wifi_types.h"
 
 #include "system_.hpp"
+#include "system_slab.hpp"
+#include "system_async.hpp"
 #include "nvs/nvs_.hpp"
 #include "logging/logging_.hpp"
+#include "logging/logging_heap.hpp"
+#include "logging/logging_tasks.hpp"
+#include "logging/logging_latency.hpp"
+#include "logging/logging_telemetry.hpp"
+#include "logging/logging_trace.hpp"
 #include "diagnostics/diagnostics_.hpp"
 #include "sntp/sntp_.hpp"
 #include "prov/prov_.hpp"
@@ -39,15 +46,23 @@ extern "C"
         TaskHandle_t &getRunTaskHandle(void);
         QueueHandle_t &getCmdRequestQueue(void); // Outside objects must ask for the CmdQueue
 
+        WIFI_CmdRequest *claimCmdRequest(void);             // A request slot, released by us once serviced.  nullptr if all are in flight.
+        bool sendCmdRequest(WIFI_CmdRequest *, TickType_t); // Stamps and queues a request
+
+        LOG_HeapAllocStats getRunHeapAllocs(void);     // Not task safe, for diagnostics only
+        LOG_HeapAllocStats getSNTPRunHeapAllocs(void); //
+
     private:
         Wifi(const Wifi &) = delete;           // Disable copy constructor
         void operator=(Wifi const &) = delete; // Disable assignment operator
 
+        static constexpr esp_log_level_t logLevelCompiled = WIFI_LOG_LEVEL_COMPILED;
         char TAG[6] = "_wifi";
 
         /* Object References */
         System *sys = nullptr;
         NVS *nvs = nullptr;
+        Bus *bus = nullptr;
 
         TaskHandle_t taskHandleSystemRun = nullptr;
         TaskHandle_t taskHandleProvisionRun = nullptr;
@@ -106,20 +121,27 @@ extern "C"
         uint8_t noIPAddressSecToRestartMax = 15;
         uint8_t noValidTimeSecToRestartMax = 30; // We allow 1 full rotation through all 4 SNTP servers before resetting connection
 
-        QueueHandle_t queueCmdRequests = nullptr; // WIFI <-- ?? (Request Queue is here)
-        WIFI_CmdRequest *ptrWifiCmdRequest = nullptr;
+        QueueHandle_t queueCmdRequests = nullptr;                  // WIFI <-- ?? (Request Queue is here)
+        SYS_Slab<WIFI_CmdRequest, WIFI_REQUEST_SLOTS> cmdRequests; // Lent to our callers
+        WIFI_CmdRequest *ptrWifiCmdRequest = nullptr;              // The request being serviced
         std::string strCmdPayload = "";
 
         static void runMarshaller(void *);
         void run(void);
         void runEvents();
 
+        SYS_Executor executor{WIFI_NOTIFY_EXECUTOR}; // Resumes our coroutines on the run task
+        SYS_Async connectTask;                       // Declared after the executor, so it is cancelled before the executor goes
+        SYS_Async connectHost(void);
+
+        LOG_HeapAllocStats runHeapAllocs = {};
+
         WIFI_OP wifiOP = WIFI_OP::Idle;                                 // Object States
         WIFI_CONN_STATE wifiConnState = WIFI_CONN_STATE::NONE;          //
         WIFI_INIT wifiInitStep = WIFI_INIT::Finished;                   //
         WIFI_DIRECTIVES wifiDirectivesStep = WIFI_DIRECTIVES::Finished; //
-        WIFI_CONN wifiConnStep = WIFI_CONN::Finished;                   //
-        WIFI_DISC wifiDiscStep = WIFI_DISC::Finished;                   //
+        LOG_StateStep<WIFI_CONN, LOG_MACHINE::Wifi_Conn> wifiConnStep = WIFI_CONN::Finished; //
+        LOG_StateStep<WIFI_DISC, LOG_MACHINE::Wifi_Disc> wifiDiscStep = WIFI_DISC::Finished; //
         WIFI_PROV wifiProvStep = WIFI_PROV::Finished; //
         WIFI_SHUTDOWN wifiShdnStep = WIFI_SHUTDOWN::Finished;           //
     };
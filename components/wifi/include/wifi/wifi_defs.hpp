@@ -1,6 +1,17 @@
 #pragma once
 #include "wifi/wifi_enums.hpp" // Local definitions, structs, and enumerations
 
+/* Command Requests */
+#define WIFI_REQUEST_SLOTS 2 // Requests which may be in flight at once.  The request queue is this deep.
+
+/* Coroutines */
+#define WIFI_NOTIFY_EXECUTOR 0x100 // Our executor's wake bit.  Above all of the WIFI_NOTIFY bits.
+
+/* Compile Time Log Level */
+#ifndef WIFI_LOG_LEVEL_COMPILED
+#define WIFI_LOG_LEVEL_COMPILED ESP_LOG_INFO // Log sites above this level are left out of the build
+#endif
+
 /* showWifi */
 #define _showWifiDirectiveSteps 0x01 // LSB
 #define _showWifiConnSteps 0x02
@@ -3,18 +3,20 @@
 #include <stdint.h> // Standard libraries
 #include <string>
 
+#include "logging/logging_latency.hpp" // LOG_LatencyStamp
+
 /* Run Notifications and Commands */
 // Task Notifications should be used for notifications or commands which need no input and return no data.
-enum class WIFI_NOTIFY : uint8_t
+enum class WIFI_NOTIFY : uint8_t // Each is a bit (sent with eSetBits) so several may be pending at once.  Lowest bit is handled first.
 {
-    CMD_CLEAR_PRI_HOST = 1, // (Directive) Sets bit to clear SSID and PWD data for the Pri host
-    CMD_DISC_HOST,          // (Directive) Sets bit to disconnect any host that may be currently connected
-    CMD_CONN_PRI_HOST,      // (Directive) Sets bit to connects to the Pri host
-    CMD_PROV_HOST,
-    CMD_RUN_DIRECTIVES,    // Runs all commands set in the Directives byte
-    CMD_SET_AUTOCONNECT,   // Sets flag to autoconnect
-    CMD_CLEAR_AUTOCONNECT, // Clears flag to autoconnect
-    CMD_SHUT_DOWN,         // Shuts down the wifi connection completely and calls for deletion.
+    CMD_CLEAR_PRI_HOST = 0x01,    // (Directive) Sets bit to clear SSID and PWD data for the Pri host
+    CMD_DISC_HOST = 0x02,         // (Directive) Sets bit to disconnect any host that may be currently connected
+    CMD_CONN_PRI_HOST = 0x04,     // (Directive) Sets bit to connects to the Pri host
+    CMD_PROV_HOST = 0x08,         //
+    CMD_RUN_DIRECTIVES = 0x10,    // Runs all commands set in the Directives byte
+    CMD_SET_AUTOCONNECT = 0x20,   // Sets flag to autoconnect
+    CMD_CLEAR_AUTOCONNECT = 0x40, // Clears flag to autoconnect
+    CMD_SHUT_DOWN = 0x80,         // Shuts down the wifi connection completely and calls for deletion.
 };
 
 // Queue based commands should be used for commands which may provide input and perhaps return data.
@@ -22,16 +24,18 @@ enum class WIFI_COMMAND : uint8_t
 {
     SET_SSID_PRI = 1,    // Sets primary host SSID and Password
     SET_WIFI_CONN_STATE, //
-    SET_SHOW_FLAGS,      // Enables and disables logging from a distance
+    SET_SHOW_FLAGS,      // Enables and disables logging from a distance.  data1: show, showWifi, [showSNTP], [showPROV]
 };
 
 struct WIFI_CmdRequest
 {
+    uint32_t correlationId;    // Set by Wifi::claimCmdRequest()
     WIFI_COMMAND requestedCmd; //
     uint8_t data1[32];         // Can hold an ssid, connection state, or show flags
     uint8_t data1Length;       //
     uint8_t data2[64];         // Can hold a password
     uint8_t data2Length;       //
+    LOG_LatencyStamp stamp;    // Set by LOG_Latency::stampEnqueue() just before sending
 };
 
 struct WIFI_Event
@@ -10,11 +10,11 @@ SemaphoreHandle_t semProvEntry;
 SemaphoreHandle_t semProvRouteLock;
 
 /* Construction / Destruction */
-PROV::PROV(QueueHandle_t queueCmdRequests)
+PROV::PROV(Wifi *owner)
 {
     ptrPROVInternal = this; // We plan on removing this someday when all ESP event handlers can be passed a 'this' pointer during registration.
 
-    wifiQueCmdRequests = queueCmdRequests; // Received a wifi Command Request Queue handle
+    wifi = owner; // Wifi lends us its command requests
 
     setFlags();                    // Enable logging statements for any area of concern.
     setLogLevels();                // Manually sets log levels for other tasks down the call stack.
@@ -28,7 +28,8 @@ PROV::PROV(QueueHandle_t queueCmdRequests)
     provRunStep = PROV_RUN::Start; // By default, we immediately enter into a provision action.
     provOP = PROV_OP::Run;
 
-    xTaskCreate(runMarshaller, "prov_run", 1024 * 6, this, TASK_PRIORITY_MID, &taskHandleRun);
+    System::createTask(SYS_TASK::Prov_Run, runMarshaller, "prov_run", &runStackSizeK, this, &taskHandleRun);
+    LOG_Tasks::registerTask(taskHandleRun, 1024 * runStackSizeK);
 }
 
 PROV::~PROV()
@@ -72,6 +73,13 @@ void PROV::setFlags()
     showPROV |= _showProvRun;
 }
 
+void PROV::setShowFlags(uint8_t showFlags, uint8_t showPROVFlags)
+{
+    show = showFlags;
+    showPROV = showPROVFlags;
+    setLogLevels();
+}
+
 void PROV::setLogLevels()
 {
     if ((show + showPROV) > 0)                // Normally, we are interested in the variables inside our object.
@@ -164,7 +172,7 @@ void PROV::createQueues()
     return;
 
 prov_createQueues_err:
-    logByValue(ESP_LOG_ERROR, semProvRouteLock, TAG, std::string(__func__) + "(): error: " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semProvRouteLock, TAG, std::string(__func__) + "(): error: " + esp_err_to_name(ret));
 }
 
 void PROV::destroyQueues()
@@ -11,8 +11,10 @@ extern SemaphoreHandle_t semProvRouteLock;
 
 void PROV::runMarshaller(void *arg)
 {
+    LOG_Heap::setTaskHeapTag(LOG_HEAP_TAG::Prov);
     ((PROV *)arg)->run();
     ((PROV *)arg)->taskHandleRun = nullptr; // This doesn't happen automatically but we look at this variable for validity, so set it manually.
+    LOG_Tasks::unregisterTask(nullptr);
     vTaskDelete(NULL);
 }
 
@@ -22,34 +24,45 @@ void PROV::run(void)
     std::string serverName = "";
 
     PROV_NOTIFY provTaskNotifyValue = static_cast<PROV_NOTIFY>(0);
+    uint32_t provNotifyBits = 0;
 
     while (true)
     {
+        if (provRunStep == PROV_RUN::Idle) // Sleeps for 5000 ticks a pass
+            LOG_Tasks::heartbeat((uint8_t)provOP, pdTICKS_TO_MS(5000) + LOG_HEARTBEAT_MS);
+        else
+            LOG_Tasks::heartbeat((uint8_t)provOP, (provOP == PROV_OP::Idle) ? LOG_HEARTBEAT_IDLE_MS : LOG_HEARTBEAT_MS);
+
         if (uxQueueMessagesWaiting(queueEvents)) // We always give top priorty to handling events
             runEvents();
 
-        provTaskNotifyValue = static_cast<PROV_NOTIFY>(ulTaskNotifyTake(pdTRUE, 20));
+        xTaskNotifyWait(0, UINT32_MAX, &provNotifyBits, 20); // Notifications are bits.  We take all of them at once.
 
-        if (provTaskNotifyValue > static_cast<PROV_NOTIFY>(0)) // Looking for Task Notifications
+        if (provNotifyBits != 0) // Looking for Task Notifications
         {
             // Task Notifications should be used for notifications (NFY_NOTIFICATION) or commands (CMD_COMMAND) both of which need no input and return no data.
-            switch (provTaskNotifyValue)
-            {
-            case PROV_NOTIFY::CMD_PRINT_TASK_INFO: // Some of these notifications set Directive bits - a follow up CMD_RUN_DIRECTIVES task notification starts the action.
+            for (uint32_t pending = provNotifyBits; pending != 0; pending &= (pending - 1)) // Lowest bit first
             {
-                if (show & _showRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): Received PROV_NOTIFY::CMD_PRINT_TASK_INFO");
-                printTaskInfoByColumns(NULL);
-                break;
-            }
+                provTaskNotifyValue = static_cast<PROV_NOTIFY>(pending & (~pending + 1));
 
-            case PROV_NOTIFY::CMD_LOG_TASK_INFO:
-            {
-                if (show & _showRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): Received PROV_NOTIFY::CMD_LOG_TASK_INFO");
-                logTaskInfo(semProvRouteLock, TAG);
-                break;
-            }
+                switch (provTaskNotifyValue)
+                {
+                case PROV_NOTIFY::CMD_PRINT_TASK_INFO: // Some of these notifications set Directive bits - a follow up CMD_RUN_DIRECTIVES task notification starts the action.
+                {
+                    if (show & _showRun)
+                        LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): Received PROV_NOTIFY::CMD_PRINT_TASK_INFO");
+                    printTaskInfoByColumns(NULL);
+                    break;
+                }
+
+                case PROV_NOTIFY::CMD_LOG_TASK_INFO:
+                {
+                    if (show & _showRun)
+                        LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): Received PROV_NOTIFY::CMD_LOG_TASK_INFO");
+                    logTaskInfo(semProvRouteLock, TAG);
+                    break;
+                }
+                }
             }
         }
 
@@ -90,7 +103,7 @@ void PROV::run(void)
             case PROV_RUN::Start:
             {
                 if (showPROV & _showProvRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Start");
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Start");
 
                 blnCancelProvisioning = false;
                 provRunStep = PROV_RUN::Register_Event_Handlers;
@@ -100,7 +113,7 @@ void PROV::run(void)
             case PROV_RUN::Register_Event_Handlers:
             {
                 if (showPROV & _showProvRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Register_Event_Handlers - Step " + std::to_string((int)PROV_RUN::Register_Event_Handlers));
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Register_Event_Handlers - Step " + std::to_string((int)PROV_RUN::Register_Event_Handlers));
 
                 ESP_GOTO_ON_ERROR(esp_event_handler_instance_register(WIFI_PROV_EVENT, ESP_EVENT_ANY_ID, eventHandlerProvisionMarshaller, this, &instanceHndProvEvents), prov_Run_err, TAG, "Register WIFI_PROV_EVENT:ESP_EVENT_ANY_ID  failed");
                 ESP_GOTO_ON_ERROR(esp_event_handler_instance_register(PROTOCOMM_SECURITY_SESSION_EVENT, ESP_EVENT_ANY_ID, eventHandlerProvisionMarshaller, this, &instanceHndSessionEvents), prov_Run_err, TAG, "Register PROTOCOMM_SECURITY_SESSION_EVENT::ESP_EVENT_ANY_ID failed");
@@ -111,7 +124,7 @@ void PROV::run(void)
             case PROV_RUN::Create_Netif_Objects:
             {
                 if (showPROV & _showProvRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Create_Netif_Objects - Step " + std::to_string((int)PROV_RUN::Create_Netif_Objects));
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Create_Netif_Objects - Step " + std::to_string((int)PROV_RUN::Create_Netif_Objects));
 
                 defaultSTANetif = esp_netif_create_default_wifi_sta();
 
@@ -138,7 +151,7 @@ void PROV::run(void)
             case PROV_RUN::Wifi_Init:
             {
                 if (showPROV & _showProvRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Wifi_Init - Step " + std::to_string((int)PROV_RUN::Wifi_Init));
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Wifi_Init - Step " + std::to_string((int)PROV_RUN::Wifi_Init));
 
                 wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
                 ESP_GOTO_ON_ERROR(esp_wifi_init(&cfg), prov_Run_err, TAG, "PROV_RUN::Wifi_Init: esp_wifi_init() failure.");
@@ -149,7 +162,7 @@ void PROV::run(void)
             case PROV_RUN::Set_Mode:
             {
                 if (showPROV & _showProvRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Set_Mode - Step " + std::to_string((int)PROV_RUN::Set_Mode));
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Set_Mode - Step " + std::to_string((int)PROV_RUN::Set_Mode));
 
                 ESP_GOTO_ON_ERROR(esp_wifi_set_mode(WIFI_MODE_APSTA), prov_Run_err, TAG, "PROV_RUN::Set_Mode: esp_wifi_set_mode() failure.");
                 ESP_GOTO_ON_ERROR(esp_wifi_start(), prov_Run_err, TAG, "PROV_RUN::Set_Mode: esp_wifi_start() failure.");
@@ -160,7 +173,7 @@ void PROV::run(void)
             case PROV_RUN::Init_Provisioning_Manager:
             {
                 if (showPROV & _showProvRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Init_Provisioning_Manager - Step " + std::to_string((int)PROV_RUN::Init_Provisioning_Manager));
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Init_Provisioning_Manager - Step " + std::to_string((int)PROV_RUN::Init_Provisioning_Manager));
                 //
                 // I tried to discover how to re-route events to another event loop, but could not figure that out.  By default all
                 // events route to the default event loop, but it might be wiser in the future to create a custom event loop and route
@@ -183,7 +196,7 @@ void PROV::run(void)
             case PROV_RUN::Start_Provisioning:
             {
                 if (showPROV & _showProvRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Start_Provisioning - Step " + std::to_string((int)PROV_RUN::Start_Provisioning));
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Start_Provisioning - Step " + std::to_string((int)PROV_RUN::Start_Provisioning));
 
                 // The service_key is the Wifi password when scheme is wifi_prov_scheme_softap.  (Minimum expected length: 8, maximum 64 for WPA2-PSK)
                 // Ignored when scheme is wifi_prov_scheme_ble
@@ -195,11 +208,11 @@ void PROV::run(void)
                 char service_name[12];
                 getDeviceServiceName(service_name, sizeof(service_name));
 
-                logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Start_Provisioning: Service name is " + std::string(service_name));
+                LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Start_Provisioning: Service name is " + std::string(service_name));
 
                 if (blnSecurityVersion1)
                 {
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Start_Provisioning: Security Version 1");
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Start_Provisioning: Security Version 1");
                     security = WIFI_PROV_SECURITY_1;
 
                     userName = "";
@@ -207,7 +220,7 @@ void PROV::run(void)
                 }
                 else if (blnSecurityVersion2)
                 {
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Start_Provisioning: Security Version 2");
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Start_Provisioning: Security Version 2");
                     security = WIFI_PROV_SECURITY_2;
 
                     if (blnSec2ProductionMode)
@@ -230,19 +243,19 @@ void PROV::run(void)
                 if (blnAllowReprovisioning)
                     ESP_GOTO_ON_ERROR(wifi_prov_mgr_disable_auto_stop(100), prov_Run_err, TAG, "wifi_prov_mgr_disable_auto_stop() failed");
 
-                logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Start_Provisioning: Ready to wifi_prov_mgr_start_provisioning...");
+                LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Start_Provisioning: Ready to wifi_prov_mgr_start_provisioning...");
 
                 ESP_GOTO_ON_ERROR(wifi_prov_mgr_start_provisioning(security, (const void *)sec_params, service_name, service_key), prov_Run_err, TAG, "wifi_prov_mgr_start_provisioning() failed");
 
                 // The handler for the optional endpoint created above.  This call must be made after starting the provisioning, and only if the endpoint has already been created above.
                 ESP_GOTO_ON_ERROR(wifi_prov_mgr_endpoint_register("custom-data", eventHandlerCustomMarshaller, this), prov_Run_err, TAG, "wifi_prov_mgr_endpoint_register() failed");
 
-                // logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Start_Provisioning : Ready to generate QR code...");
+                // LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Start_Provisioning : Ready to generate QR code...");
                 // printQRCode(service_name, userName.c_str(), pop.c_str(), PROV_TRANSPORT_SOFTAP); // Print QR code for provisioning
 
                 provRunStep = PROV_RUN::Process_Wait; // Let event handling take the next action.
                 if (showPROV & _showProvRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Process_Wait - Step " + std::to_string((int)PROV_RUN::Process_Wait));
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Process_Wait - Step " + std::to_string((int)PROV_RUN::Process_Wait));
                 break;
             }
 
@@ -258,7 +271,7 @@ void PROV::run(void)
             case PROV_RUN::Unregister_Endpoints:
             {
                 if (showPROV & _showProvRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Unregister_Endpoints - Step " + std::to_string((int)PROV_RUN::Unregister_Endpoints));
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Unregister_Endpoints - Step " + std::to_string((int)PROV_RUN::Unregister_Endpoints));
 
                 wifi_prov_mgr_endpoint_unregister("custom-data");
                 provRunStep = PROV_RUN::Stop;
@@ -268,13 +281,13 @@ void PROV::run(void)
             case PROV_RUN::Stop:
             {
                 if (showPROV & _showProvRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Stop - Step " + std::to_string((int)PROV_RUN::Stop));
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Stop - Step " + std::to_string((int)PROV_RUN::Stop));
 
                 wifi_prov_mgr_stop_provisioning();
 
                 provRunStep = PROV_RUN::Deinitialize;
                 if (showPROV & _showProvRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Stop_Wait - Step " + std::to_string((int)PROV_RUN::Stop_Wait));
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Stop_Wait - Step " + std::to_string((int)PROV_RUN::Stop_Wait));
                 break;
             }
 
@@ -290,13 +303,13 @@ void PROV::run(void)
             case PROV_RUN::Deinitialize:
             {
                 if (showPROV & _showProvRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Deinitialize - Step " + std::to_string((int)PROV_RUN::Deinitialize));
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Deinitialize - Step " + std::to_string((int)PROV_RUN::Deinitialize));
 
                 wifi_prov_mgr_deinit();
 
                 provRunStep = PROV_RUN::Deinitalization_Wait;
                 if (showPROV & _showProvRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Deinitalization_Wait - Step " + std::to_string((int)PROV_RUN::Deinitalization_Wait));
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Deinitalization_Wait - Step " + std::to_string((int)PROV_RUN::Deinitalization_Wait));
                 break;
             }
 
@@ -312,7 +325,7 @@ void PROV::run(void)
             case PROV_RUN::Stop_Destroy_Unregister:
             {
                 if (showPROV & _showProvRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Stop_Destroy_Unregister - Step " + std::to_string((int)PROV_RUN::Stop_Destroy_Unregister));
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Stop_Destroy_Unregister - Step " + std::to_string((int)PROV_RUN::Stop_Destroy_Unregister));
 
                 ESP_GOTO_ON_ERROR(esp_wifi_restore(), prov_Run_err, TAG, "PROV_RUN::prov_Stop_Destroy_Unregister_err: esp_wifi_restore() error");
                 ESP_GOTO_ON_ERROR(esp_wifi_stop(), prov_Run_err, TAG, "PROV_RUN::prov_Stop_Destroy_Unregister_err: esp_wifi_stop() failed");
@@ -340,7 +353,7 @@ void PROV::run(void)
             case PROV_RUN::Finished:
             {
                 if (showPROV & _showProvRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Finished");
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Finished");
 
                 // printTaskInfoByColumns();
 
@@ -353,7 +366,7 @@ void PROV::run(void)
             case PROV_RUN::Error:
             {
                 if (showPROV & _showProvRun)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Error");
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROV_RUN::Error");
 
                 provOP = PROV_OP::Error;
                 provRunStep = PROV_RUN::Finished;
@@ -387,7 +400,7 @@ void PROV::run(void)
 
         case PROV_OP::Error:
         {
-            logByValue(ESP_LOG_ERROR, semProvRouteLock, TAG, errMsg);
+            LOG_BY_VALUE(ESP_LOG_ERROR, semProvRouteLock, TAG, errMsg);
             provOP = PROV_OP::Idle;
             break;
         }
@@ -411,7 +424,7 @@ void PROV::runEvents()
     while (xQueueReceive(queueEvents, &evt, 0)) // Process all events in the queue
     {
         if (show & _showEvents)
-            logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): evt.event_base is " + std::string(evt.event_base) + " evt.event_id is " + std::to_string(evt.event_id));
+            LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): evt.event_base is " + std::string(evt.event_base) + " evt.event_id is " + std::to_string(evt.event_id));
 
         // ESP_LOGW(TAG, "queueEvents size is %d", uxQueueMessagesWaiting(queueEvents));
 
@@ -422,21 +435,21 @@ void PROV::runEvents()
             case WIFI_PROV_INIT:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_INIT:");
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_INIT:");
                 break;
             }
 
             case WIFI_PROV_START:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_START:");
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_START:");
                 break;
             }
 
             case WIFI_PROV_CRED_RECV:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_CRED_RECV:");
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_CRED_RECV:");
 
                 wifi_sta_config_t *wifi_sta_cfg = (wifi_sta_config_t *)evt.data; // Copy the data
                 ssidUnderTest = std::string((const char *)wifi_sta_cfg->ssid);
@@ -447,16 +460,16 @@ void PROV::runEvents()
             case WIFI_PROV_CRED_FAIL:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_WARN, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_CRED_FAIL");
+                    LOG_BY_VALUE(ESP_LOG_WARN, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_CRED_FAIL");
 
-                ESP_LOGW(TAG, "WIFI_PROV_CRED_FAIL provOP/provRunStep %d/%d", (int)provOP, (int)provRunStep);
+                ESP_LOGW(TAG, "WIFI_PROV_CRED_FAIL provOP/provRunStep %d/%d", (int)provOP, (int)(PROV_RUN)provRunStep);
 
                 wifi_prov_sta_fail_reason_t *reason = (wifi_prov_sta_fail_reason_t *)evt.data;
 
                 if (*reason == WIFI_PROV_STA_AUTH_ERROR)
-                    logByValue(ESP_LOG_WARN, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_CRED_FAIL: Station Authentication failed.");
+                    LOG_BY_VALUE(ESP_LOG_WARN, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_CRED_FAIL: Station Authentication failed.");
                 else
-                    logByValue(ESP_LOG_WARN, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_CRED_FAIL: Wi-Fi Access-Point not found.");
+                    LOG_BY_VALUE(ESP_LOG_WARN, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_CRED_FAIL: Wi-Fi Access-Point not found.");
 
                 if (blnResetProvMgrOnFailure)
                 {
@@ -470,16 +483,22 @@ void PROV::runEvents()
                 break;
 
             prov_WIFI_PROV_CRED_FAIL_err:
-                logByValue(ESP_LOG_ERROR, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_CRED_FAIL:Error " + std::to_string(ret) + " " + esp_err_to_name(ret));
+                LOG_BY_VALUE(ESP_LOG_ERROR, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_CRED_FAIL:Error " + std::to_string(ret) + " " + esp_err_to_name(ret));
                 break;
             }
 
             case WIFI_PROV_CRED_SUCCESS:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_CRED_SUCCESS");
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_CRED_SUCCESS");
+
+                WIFI_CmdRequest *wifiCmdRequest = wifi->claimCmdRequest(); // Wifi frees the slot once it has the credentials
+                if (wifiCmdRequest == nullptr)
+                {
+                    LOG_BY_VALUE(ESP_LOG_ERROR, semProvRouteLock, TAG, std::string(__func__) + "(): No free Wifi command request.  Credentials not saved.");
+                    break;
+                }
 
-                WIFI_CmdRequest *wifiCmdRequest = new WIFI_CmdRequest; // This is local and we hand over its address like a pointer
                 wifiCmdRequest->requestedCmd = WIFI_COMMAND::SET_SSID_PRI;
                 memset(&wifiCmdRequest->data1, 0, 32);
                 memcpy(&wifiCmdRequest->data1, ssidUnderTest.c_str(), ssidUnderTest.size());
@@ -489,22 +508,14 @@ void PROV::runEvents()
                 memcpy(&wifiCmdRequest->data2, ssidPwdUnderTest.c_str(), ssidPwdUnderTest.size());
                 wifiCmdRequest->data2Length = ssidPwdUnderTest.size();
 
-                while (uxQueueMessagesWaiting(wifiQueCmdRequests) > 0) // Wait here until we are sure the Mailbox Queue is clear
-                    vTaskDelay(pdMS_TO_TICKS(10));
-
-                xQueueSend(wifiQueCmdRequests, (void *)&wifiCmdRequest, portMAX_DELAY); // Send the Request
-
-                while (uxQueueMessagesWaiting(wifiQueCmdRequests) > 0) // Wait must here until we are sure the Mailbox Queue is clear If we don't wait,
-                    vTaskDelay(pdMS_TO_TICKS(100));                    // this side destroys the Request before other side has a chance to read it.
-
-                delete wifiCmdRequest;
+                wifi->sendCmdRequest(wifiCmdRequest, portMAX_DELAY); // The queue holds every slot, so this never waits
                 break;
             }
 
             case WIFI_PROV_END:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_END");
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_END");
 
                 provRunStep = PROV_RUN::Unregister_Endpoints;
                 provOP = PROV_OP::Run;
@@ -514,7 +525,7 @@ void PROV::runEvents()
             case WIFI_PROV_DEINIT:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_DEINIT");
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:WIFI_PROV_DEINIT");
 
                 provRunStep = PROV_RUN::Stop_Destroy_Unregister;
                 provOP = PROV_OP::Run;
@@ -523,7 +534,7 @@ void PROV::runEvents()
 
             default:
             {
-                logByValue(ESP_LOG_WARN, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:<default> event_id = " + std::to_string(evt.event_id));
+                LOG_BY_VALUE(ESP_LOG_WARN, semProvRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV_EVENT:<default> event_id = " + std::to_string(evt.event_id));
                 break;
             }
             }
@@ -535,27 +546,27 @@ void PROV::runEvents()
             case PROTOCOMM_SECURITY_SESSION_SETUP_OK:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROTOCOMM_SECURITY_SESSION_EVENT:PROTOCOMM_SECURITY_SESSION_SETUP_OK");
+                    LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): PROTOCOMM_SECURITY_SESSION_EVENT:PROTOCOMM_SECURITY_SESSION_SETUP_OK");
                 break;
             }
 
             case PROTOCOMM_SECURITY_SESSION_INVALID_SECURITY_PARAMS:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_ERROR, semProvRouteLock, TAG, std::string(__func__) + "(): PROTOCOMM_SECURITY_SESSION_EVENT:PROTOCOMM_SECURITY_SESSION_INVALID_SECURITY_PARAMS");
+                    LOG_BY_VALUE(ESP_LOG_ERROR, semProvRouteLock, TAG, std::string(__func__) + "(): PROTOCOMM_SECURITY_SESSION_EVENT:PROTOCOMM_SECURITY_SESSION_INVALID_SECURITY_PARAMS");
                 break;
             }
 
             case PROTOCOMM_SECURITY_SESSION_CREDENTIALS_MISMATCH:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_ERROR, semProvRouteLock, TAG, std::string(__func__) + "(): PROTOCOMM_SECURITY_SESSION_EVENT:PROTOCOMM_SECURITY_SESSION_CREDENTIALS_MISMATCH");
+                    LOG_BY_VALUE(ESP_LOG_ERROR, semProvRouteLock, TAG, std::string(__func__) + "(): PROTOCOMM_SECURITY_SESSION_EVENT:PROTOCOMM_SECURITY_SESSION_CREDENTIALS_MISMATCH");
                 break;
             }
 
             default:
             {
-                logByValue(ESP_LOG_WARN, semProvRouteLock, TAG, std::string(__func__) + "(): PROTOCOMM_TRANSPORT_BLE_EVENT:default event_id is " + std::to_string(evt.event_id));
+                LOG_BY_VALUE(ESP_LOG_WARN, semProvRouteLock, TAG, std::string(__func__) + "(): PROTOCOMM_TRANSPORT_BLE_EVENT:default event_id is " + std::to_string(evt.event_id));
                 break;
             }
             }
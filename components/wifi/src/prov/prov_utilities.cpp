@@ -16,18 +16,18 @@ esp_err_t PROV::example_get_sec2_salt(const char **salt, uint16_t *salt_len)
 {
     if (blnSec2DevelopmentMode)
     {
-        logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): Development mode: using hard coded salt");
+        LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): Development mode: using hard coded salt");
 
         *salt = sec2_salt;
         *salt_len = sizeof(sec2_salt);
 
         esp_log_buffer_hexdump_internal(TAG, *salt, *salt_len, ESP_LOG_WARN);
-        logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): salt length is " + std::to_string(*salt_len));
+        LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): salt length is " + std::to_string(*salt_len));
     }
     else if (blnSec2ProductionMode)
     {
         // errMsg = std::string(__func__) + "(): blnSec2ProductionMode Not implemented!";
-        logByValue(ESP_LOG_ERROR, semProvRouteLock, TAG, std::string(__func__) + "(): blnSec2ProductionMode Not implemented!");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semProvRouteLock, TAG, std::string(__func__) + "(): blnSec2ProductionMode Not implemented!");
         return ESP_FAIL;
     }
     return ESP_OK;
@@ -37,18 +37,18 @@ esp_err_t PROV::example_get_sec2_verifier(const char **verifier, uint16_t *verif
 {
     if (blnSec2DevelopmentMode)
     {
-        logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): Development mode: using hard coded verifier");
+        LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): Development mode: using hard coded verifier");
 
         *verifier = sec2_verifier;
         *verifier_len = sizeof(sec2_verifier);
 
         esp_log_buffer_hexdump_internal(TAG, *verifier, *verifier_len, ESP_LOG_WARN);
-        logByValue(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): verifier length is " + std::to_string(*verifier_len));
+        LOG_BY_VALUE(ESP_LOG_INFO, semProvRouteLock, TAG, std::string(__func__) + "(): verifier length is " + std::to_string(*verifier_len));
     }
     else if (blnSec2ProductionMode)
     {
         errMsg = std::string(__func__) + "(): blnSec2ProductionMode Not implemented!"; // This code needs to be updated with appropriate implementation to provide verifier
-        logByValue(ESP_LOG_ERROR, semProvRouteLock, TAG, errMsg);
+        LOG_BY_VALUE(ESP_LOG_ERROR, semProvRouteLock, TAG, errMsg);
         return ESP_FAIL;
     }
     return ESP_OK;
@@ -43,6 +43,13 @@ void SNTP::setFlags()
     // showSNTP |= _showSNTPConnSteps;
 }
 
+void SNTP::setShowFlags(uint8_t showFlags, uint8_t showSNTPFlags)
+{
+    show = showFlags;
+    showSNTP = showSNTPFlags;
+    setLogLevels();
+}
+
 void SNTP::setLogLevels()
 {
     if ((show + showSNTP) > 0)                // Normally, we are interested in the variables inside our object.
@@ -69,7 +76,7 @@ void SNTP::createQueues()
     return;
 
 wifi_createQueues_err:
-    logByValue(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): error: " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): error: " + esp_err_to_name(ret));
 }
 
 void SNTP::destroySemaphores()
@@ -21,11 +21,11 @@ void SNTP::eventHandlerSNTP(struct timeval *tv)
     evt.blnTimeArrived = true;
 
     if (show & _showEvents)
-        logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): Called by the task named: " + std::string(pcTaskGetName(NULL)));
+        LOG_BY_VALUE(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): Called by the task named: " + std::string(pcTaskGetName(NULL)));
 
     if (show & _showEvents)
-        logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): evt.blnTimeArrived is " + std::to_string(evt.blnTimeArrived));
+        LOG_BY_VALUE(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): evt.blnTimeArrived is " + std::to_string(evt.blnTimeArrived));
 
     if (xQueueSendToBack(queueEvents, &evt, 0) == pdFALSE)
-        logByValue(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): SNTP Event queue over-flowed!");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): SNTP Event queue over-flowed!");
 }
\ No newline at end of file
@@ -11,6 +11,8 @@ extern SemaphoreHandle_t semSNTPRouteLock;
 /* NVS */
 void SNTP::restoreVariablesFromNVS()
 {
+    LOG_TraceSpan span("SNTP::restoreVariablesFromNVS");
+
     esp_err_t ret = ESP_OK;
     bool successFlag = true;
 
@@ -21,7 +23,7 @@ void SNTP::restoreVariablesFromNVS()
         ESP_GOTO_ON_ERROR(nvs->openNVSStorage("sntp"), sntp_restoreVariablesFromNVS_err, TAG, "nvs->openNVSStorage('sntp') failed");
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): sntp namespace start");
+        LOG_BY_VALUE(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): sntp namespace start");
 
     if (successFlag) // Restore serverIndex
     {
@@ -30,12 +32,12 @@ void SNTP::restoreVariablesFromNVS()
         if (ret == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): serverIndex         is " + std::to_string(serverIndex));
+                LOG_BY_VALUE(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): serverIndex         is " + std::to_string(serverIndex));
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore serverIndex");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore serverIndex");
         }
     }
 
@@ -53,33 +55,33 @@ void SNTP::restoreVariablesFromNVS()
             }
 
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): timeZone            is " + timeZone); // Confirm our restored value
+                LOG_BY_VALUE(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): timeZone            is " + timeZone); // Confirm our restored value
         }
 
         if (ret != ESP_OK)
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore timeZone");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore timeZone");
         }
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): sntp namespace end");
+        LOG_BY_VALUE(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): sntp namespace end");
 
     if (successFlag)
     {
         if (show & _showNVS)
-            logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): Success");
+            LOG_BY_VALUE(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): Success");
     }
     else
-        logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): Failed");
+        LOG_BY_VALUE(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): Failed");
 
     nvs->closeNVStorage();
     xSemaphoreGive(semNVSEntry);
     return;
 
 sntp_restoreVariablesFromNVS_err:
-    logByValue(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
     xSemaphoreGive(semNVSEntry);
 }
 
@@ -100,19 +102,19 @@ void SNTP::saveVariablesToNVS()
         ESP_GOTO_ON_ERROR(nvs->openNVSStorage("sntp"), sntp_saveVariablesToNVS_err, TAG, "nvs->openNVSStorage('sntp') failed");
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): sntp namespace start");
+        LOG_BY_VALUE(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): sntp namespace start");
 
     if (successFlag) // Save serverIndex
     {
         if (nvs->writeU8IntegerToNVS("serverIndex", serverIndex) == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): serverIndex         = " + std::to_string(serverIndex));
+                LOG_BY_VALUE(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): serverIndex         = " + std::to_string(serverIndex));
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): Unable to save serverIndex");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): Unable to save serverIndex");
         }
     }
 
@@ -121,31 +123,31 @@ void SNTP::saveVariablesToNVS()
         if (nvs->writeStringToNVS("timeZone", &timeZone) == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): timeZone            = " + timeZone);
+                LOG_BY_VALUE(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): timeZone            = " + timeZone);
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): Unable to save timeZone");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): Unable to save timeZone");
         }
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): sntp namespace end");
+        LOG_BY_VALUE(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): sntp namespace end");
 
     if (successFlag)
     {
         if (show & _showNVS)
-            logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): Success");
+            LOG_BY_VALUE(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): Success");
     }
     else
-        logByValue(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): Failed");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): Failed");
 
     nvs->closeNVStorage();
     xSemaphoreGive(semNVSEntry);
     return;
 
 sntp_saveVariablesToNVS_err:
-    logByValue(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semSNTPRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
     xSemaphoreGive(semNVSEntry);
 }
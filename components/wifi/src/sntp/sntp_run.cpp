@@ -14,8 +14,16 @@ void SNTP::run(void)
 {
     esp_err_t ret = ESP_OK;
 
+    uint32_t heapAllocsAtEntry = LOG_Heap::getTaskHeapAllocs(); // A quiet call (no events, no state change) must not allocate.
+    SNTP_OP sntpOPAtEntry = sntpOP;                             //
+    SNTP_CONN connStepAtEntry = connStep;                       //
+    bool quietPass = true;                                      //
+
     if (uxQueueMessagesWaiting(queueEvents)) // We always give top priorty to handling events
+    {
+        quietPass = false;
         runEvents();
+    }
 
     // NOTE:  There is no RTOS processing done here.  NO Task Notification, NO Command Queue.  This is because the Wifi parent can control all the variables without
     //        Marshalling between tasks - as SNTP has NO task.
@@ -31,7 +39,7 @@ void SNTP::run(void)
         case SNTP_CONN::Start:
         {
             if (showSNTP & _showSNTPConnSteps)
-                logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): SNTP_CONN::Start");
+                LOG_DEFERRED(ESP_LOG_INFO, semSNTPRouteLock, TAG, "SNTP_CONN::Start");
 
             connStep = SNTP_CONN::Set_Time_Zone;
             [[fallthrough]];
@@ -40,7 +48,7 @@ void SNTP::run(void)
         case SNTP_CONN::Set_Time_Zone:
         {
             if (showSNTP & _showSNTPConnSteps)
-                logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): SNTP_CONN::Set_Time_Zone - Step " + std::to_string((int)SNTP_CONN::Set_Time_Zone));
+                LOG_DEFERRED(ESP_LOG_INFO, semSNTPRouteLock, TAG, "SNTP_CONN::Set_Time_Zone - Step %d", (int)SNTP_CONN::Set_Time_Zone);
 
             // https://sites.google.com/a/usapiens.com/opnode/time-zones
             // setenv("TZ", "CEST-2", 1);  // This is the time zone for Europe/Berlin
@@ -53,19 +61,19 @@ void SNTP::run(void)
             {
                 timeZone = CONFIG_SNTP_TIME_ZONE; // Right now, favor the Config setting over value in nvs
                 if (showSNTP & _showSNTPConnSteps)
-                    logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): SNTP_CONN::Set_Time_Zone: New time zone setting is " + timeZone);
+                    LOG_PRINTF(ESP_LOG_INFO, semSNTPRouteLock, TAG, "SNTP_CONN::Set_Time_Zone: New time zone setting is %s", timeZone.c_str());
                 saveVariablesToNVS();
             }
 
             if (showSNTP & _showSNTPConnSteps)
-                logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): timeZone            is " + timeZone);
+                LOG_PRINTF(ESP_LOG_INFO, semSNTPRouteLock, TAG, "timeZone            is %s", timeZone.c_str());
 
             // On start-up, the time zone variable is always empty.
             // NOTE: You can not read the Time Zone unless one has been commited to memory first.
             setenv("TZ", timeZone.c_str(), 1);
 
             if (showSNTP & _showSNTPConnSteps)
-                logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): SNTP_CONN::Set_Time_Zone: Setting time zone to " + timeZone);
+                LOG_PRINTF(ESP_LOG_INFO, semSNTPRouteLock, TAG, "SNTP_CONN::Set_Time_Zone: Setting time zone to %s", timeZone.c_str());
 
             tzset();
             connStep = SNTP_CONN::Configure;
@@ -75,7 +83,7 @@ void SNTP::run(void)
         case SNTP_CONN::Configure:
         {
             if (showSNTP & _showSNTPConnSteps)
-                logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): SNTP_CONN::Configure - Step " + std::to_string((int)SNTP_CONN::Configure));
+                LOG_DEFERRED(ESP_LOG_INFO, semSNTPRouteLock, TAG, "SNTP_CONN::Configure - Step %d", (int)SNTP_CONN::Configure);
 
             esp_sntp_stop(); // We can crash of we try to set an operating mode while the client is running.... stop first to be sure all will be ok.
             esp_sntp_setoperatingmode(SNTP_OPMODE_POLL);
@@ -83,7 +91,7 @@ void SNTP::run(void)
             serverName = "time" + std::to_string(serverIndex) + ".google.com";
 
             if (showSNTP & _showSNTPConnSteps)
-                logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): SNTP_CONN::Configure: SNTP Server set to " + serverName);
+                LOG_PRINTF(ESP_LOG_INFO, semSNTPRouteLock, TAG, "SNTP_CONN::Configure: SNTP Server set to %s", serverName.c_str());
 
             config = {
                 false,                      // smooth_sync
@@ -108,7 +116,7 @@ void SNTP::run(void)
         case SNTP_CONN::Init:
         {
             if (showSNTP & _showSNTPConnSteps)
-                logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): SNTP_CONN::Init - Step " + std::to_string((int)SNTP_CONN::Init));
+                LOG_DEFERRED(ESP_LOG_INFO, semSNTPRouteLock, TAG, "SNTP_CONN::Init - Step %d", (int)SNTP_CONN::Init);
 
             timeValid = false; // At every new Wifi connection to a host, we consider SNTP to be invalid.
 
@@ -120,7 +128,7 @@ void SNTP::run(void)
             connStep = SNTP_CONN::Waiting_For_Response;
 
             if (showSNTP & _showSNTPConnSteps)
-                logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): SNTP_CONN::Waiting_For_Response - Step " + std::to_string((int)SNTP_CONN::Waiting_For_Response));
+                LOG_DEFERRED(ESP_LOG_INFO, semSNTPRouteLock, TAG, "SNTP_CONN::Waiting_For_Response - Step %d", (int)SNTP_CONN::Waiting_For_Response);
             break;
 
         sntp_Init_err:
@@ -134,7 +142,7 @@ void SNTP::run(void)
             if (timeValid) // Did our time synchronization arrive?
             {
                 if (showSNTP & _showSNTPConnSteps)
-                    logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): SNTP_CONN::Waiting_For_Response: EPOCH TIME RECEIVED");
+                    LOG_DEFERRED(ESP_LOG_INFO, semSNTPRouteLock, TAG, "SNTP_CONN::Waiting_For_Response: EPOCH TIME RECEIVED");
 
                 saveVariablesToNVS();       // There is a possibility that SNTP server index changed during our process -- call on save.
                 connStep = SNTP_CONN::Idle; // Our SNTP process is over, go to an idle state.
@@ -148,7 +156,7 @@ void SNTP::run(void)
                 if ((waitingOnEpochTimeSecMax - waitingOnEpochTimeSec) < 4) // Show a count down just before the time out.
                 {
                     if (showSNTP & _showSNTPConnSteps)
-                        logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): Waiting response from " + serverName + ": " + std::to_string(waitingOnEpochTimeSecMax - waitingOnEpochTimeSec) + " Secs remain before server rotation...");
+                        LOG_LIMITED(ESP_LOG_INFO, semSNTPRouteLock, TAG, "Waiting response from server %d: %d Secs remain before server rotation...", (int)serverIndex, (int)(waitingOnEpochTimeSecMax - waitingOnEpochTimeSec));
                 }
 
                 if (waitingOnEpochTimeSec > waitingOnEpochTimeSecMax)
@@ -157,7 +165,7 @@ void SNTP::run(void)
                         serverIndex = 1;
 
                     if (showSNTP & _showSNTPConnSteps)
-                        logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): Changing server to " + std::to_string(serverIndex));
+                        LOG_DEFERRED(ESP_LOG_INFO, semSNTPRouteLock, TAG, "Changing server to %d", (int)serverIndex);
 
                     connStep = SNTP_CONN::Configure;
                     break;
@@ -183,7 +191,7 @@ void SNTP::run(void)
 
     case SNTP_OP::Error:
     {
-        logByValue(ESP_LOG_ERROR, semSNTPRouteLock, TAG, errMsg);
+        LOG_BY_VALUE(ESP_LOG_ERROR, semSNTPRouteLock, TAG, errMsg);
         sntpOP = SNTP_OP::Idle;
         break;
     }
@@ -193,6 +201,12 @@ void SNTP::run(void)
         break;
     }
     }
+
+    if (quietPass && (sntpOP == sntpOPAtEntry) && (connStep == connStepAtEntry))
+    {
+        runHeapAllocs.quietPasses++;
+        runHeapAllocs.quietAllocs += LOG_Heap::getTaskHeapAllocs() - heapAllocsAtEntry;
+    }
     // We return to the parent object until the next run() call.
 }
 
@@ -207,12 +221,12 @@ void SNTP::runEvents()
     while (xQueueReceive(queueEvents, &evt, 0))
     {
         if (show & _showEvents)
-            logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): evt.blnTimeArrived is " + std::to_string(evt.blnTimeArrived));
+            LOG_DEFERRED(ESP_LOG_INFO, semSNTPRouteLock, TAG, "evt.blnTimeArrived is %d", (int)evt.blnTimeArrived);
 
         if (evt.blnTimeArrived == true)
         {
             if (show & _showEvents)
-                logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): Printing Time...");
+                LOG_DEFERRED(ESP_LOG_INFO, semSNTPRouteLock, TAG, "Printing Time...");
 
             timeValid = true; // Mark SNTP Time valid.  This will declare our System Time value and stop any waiting processes.
 
@@ -226,7 +240,7 @@ void SNTP::runEvents()
             strftime(strftimeBuf, sizeof(currentTime_info), "%c", &currentTime_info);
 
             if (show & _showEvents)
-                logByValue(ESP_LOG_INFO, semSNTPRouteLock, TAG, std::string(__func__) + "(): Notification of a time synchronization event.  " + std::string(strftimeBuf));
+                LOG_PRINTF(ESP_LOG_INFO, semSNTPRouteLock, TAG, "Notification of a time synchronization event.  %s", strftimeBuf);
         }
     }
 }
\ No newline at end of file
@@ -34,6 +34,9 @@ Wifi::Wifi()
         xSemaphoreGive(semSysEntry);
     }
 
+    if (bus == nullptr)
+        bus = Bus::getInstance();
+
     // The SNTP services are required all the time when WIFI is connected.  For that reason, we don't spin a new task for SNTP.  Instead
     // we increase the task memory in the Wifi to accommodate SNTP.  In contrast to Provision where we will allow the Provision object to create
     // its own task because we don't want to inflate the Wifi task memory to include Provision when that object is only used occasionally.
@@ -52,8 +55,9 @@ Wifi::Wifi()
     wifiInitStep = WIFI_INIT::Start; // Allow the object to initialize.  This takes some time.
     wifiOP = WIFI_OP::Init;
 
-    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): runStackSizeK: " + std::to_string(runStackSizeK));
-    xTaskCreate(runMarshaller, "wifi_run", 1024 * runStackSizeK, this, TASK_PRIORITY_MID, &taskHandleWIFIRun);
+    LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): runStackSizeK: " + std::to_string(runStackSizeK));
+    System::createTask(SYS_TASK::Wifi_Run, runMarshaller, "wifi_run", &runStackSizeK, this, &taskHandleWIFIRun);
+    LOG_Tasks::registerTask(taskHandleWIFIRun, 1024 * runStackSizeK, &runStackSizeK, "wifi"); // SNTP runs on this stack too
 }
 
 Wifi::~Wifi()
@@ -69,13 +73,13 @@ Wifi::~Wifi()
     // 8) Done.
 
     // NOTE: The calling task can still send taskNotifications to the wifi task!
-    while (!xTaskNotify(taskHandleWIFIRun, static_cast<uint32_t>(WIFI_NOTIFY::CMD_SHUT_DOWN), eSetValueWithoutOverwrite))
-        vTaskDelay(pdMS_TO_TICKS(50)); // Wait for the notification to be received.
-    taskYIELD();                       // One last yield to make sure Idle task can run.
+    LOG_Latency::stampNotify(LOG_LAT_SOURCE::Wifi, static_cast<uint32_t>(WIFI_NOTIFY::CMD_SHUT_DOWN));
+    xTaskNotify(taskHandleWIFIRun, static_cast<uint32_t>(WIFI_NOTIFY::CMD_SHUT_DOWN), eSetBits);
+    taskYIELD(); // One last yield to make sure Idle task can run.
 
     while (taskHandleWIFIRun != nullptr)
         vTaskDelay(pdMS_TO_TICKS(50)); // Wait for the wifi task handle to become null.
-    taskYIELD();                       // One last yield to make sure Idle task can run.
+    taskYIELD(); // One last yield to make sure Idle task can run.
 
     if (sntp != nullptr) // Destroy sntp
         delete sntp;     // Has no active tasks so it is simple to destroy
@@ -167,19 +171,13 @@ void Wifi::createQueues()
 
     if (queueCmdRequests == nullptr)
     {
-        queueCmdRequests = xQueueCreate(1, sizeof(WIFI_CmdRequest *)); // Initialize our Incoming Command Request Queue -- element is of size pointer
+        queueCmdRequests = xQueueCreate(WIFI_REQUEST_SLOTS, sizeof(WIFI_CmdRequest *)); // Deep enough for every slot we lend out -- element is of size pointer
         ESP_GOTO_ON_FALSE(queueCmdRequests, ESP_ERR_NO_MEM, wifi_createQueues_err, TAG, "IDF did not allocate memory for the command request queue.");
     }
-
-    if (ptrWifiCmdRequest == nullptr)
-    {
-        ptrWifiCmdRequest = new WIFI_CmdRequest();
-        ESP_GOTO_ON_FALSE(ptrWifiCmdRequest, ESP_ERR_NO_MEM, wifi_createQueues_err, TAG, "IDF did not allocate memory for the ptrWifiCmdRequest structure.");
-    }
     return;
 
 wifi_createQueues_err:
-    logByValue(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): error: " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): error: " + esp_err_to_name(ret));
 }
 
 void Wifi::destroyQueues()
@@ -196,11 +194,7 @@ void Wifi::destroyQueues()
         queueCmdRequests = nullptr;
     }
 
-    if (ptrWifiCmdRequest != nullptr)
-    {
-        delete ptrWifiCmdRequest;
-        ptrWifiCmdRequest = nullptr;
-    }
+    ptrWifiCmdRequest = nullptr; // Requests belong to cmdRequests or to the caller
 }
 
 /* Public Member Functions */
@@ -213,3 +207,27 @@ QueueHandle_t &Wifi::getCmdRequestQueue()
 {
     return queueCmdRequests;
 }
+
+WIFI_CmdRequest *Wifi::claimCmdRequest(void)
+{
+    return cmdRequests.claim();
+}
+
+bool Wifi::sendCmdRequest(WIFI_CmdRequest *request, TickType_t ticksToWait)
+{
+    LOG_Latency::stampEnqueue(&request->stamp);
+    return xQueueSendToBack(queueCmdRequests, &request, ticksToWait);
+}
+
+LOG_HeapAllocStats Wifi::getRunHeapAllocs(void)
+{
+    return runHeapAllocs;
+}
+
+LOG_HeapAllocStats Wifi::getSNTPRunHeapAllocs(void)
+{
+    if (sntp == nullptr)
+        return LOG_HeapAllocStats();
+
+    return sntp->runHeapAllocs;
+}
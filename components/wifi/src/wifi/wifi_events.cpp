@@ -16,11 +16,11 @@ void Wifi::eventHandlerWifi(esp_event_base_t event_base, int32_t event_id, void
     evt.event_id = event_id;
 
     if (show & _showEvents)
-        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Called by the task named: " + std::string(pcTaskGetName(NULL)));
+        LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Called by the task named: " + std::string(pcTaskGetName(NULL)));
 
     if (show & _showEvents)
-        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): evt.event_base is " + std::string(evt.event_base) + " evt.event_id is " + std::to_string(evt.event_id));
+        LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): evt.event_base is " + std::string(evt.event_base) + " evt.event_id is " + std::to_string(evt.event_id));
 
     if (xQueueSendToBack(queueEvents, &evt, 0) == pdFALSE)
-        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Wifi Event queue over-flowed!");
+        LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Wifi Event queue over-flowed!");
 }
\ No newline at end of file
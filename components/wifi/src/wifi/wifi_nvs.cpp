@@ -11,6 +11,8 @@ extern SemaphoreHandle_t semWifiRouteLock;
 /* NVS */
 void Wifi::restoreVariablesFromNVS()
 {
+    LOG_TraceSpan span("Wifi::restoreVariablesFromNVS");
+
     esp_err_t ret = ESP_OK;
     bool successFlag = true;
     uint8_t temp = 0;
@@ -22,7 +24,7 @@ void Wifi::restoreVariablesFromNVS()
         ESP_GOTO_ON_ERROR(nvs->openNVSStorage("wifi"), wifi_restoreVariablesFromNVS_err, TAG, "nvs->openNVSStorage('wifi') failed");
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): wifi namespace start");
+        LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): wifi namespace start");
 
     if (successFlag) // Restore runStackSizeK
     {
@@ -31,19 +33,19 @@ void Wifi::restoreVariablesFromNVS()
 
         if (ret == ESP_OK)
         {
-            if (temp > runStackSizeK) // Ok to use any value greater than the default size.
+            if ((temp != runStackSizeK) && LOG_Tasks::stackSizeKValid(temp, runStackSizeK)) // Written by the System stack tuner.  See LOG_Tasks::stackSizeKValid().
             {
                 runStackSizeK = temp;
                 ret = nvs->writeU8IntegerToNVS("runStackSizeK", runStackSizeK); // Over-write the value with the default minumum value.
             }
 
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): runStackSizeK       is " + std::to_string(runStackSizeK));
+                LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): runStackSizeK       is " + std::to_string(runStackSizeK));
         }
 
         if (ret != ESP_OK)
         {
-            logByValue(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore runStackSizeK");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore runStackSizeK");
             successFlag = false;
         }
     }
@@ -55,12 +57,12 @@ void Wifi::restoreVariablesFromNVS()
         if (ret == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): autoConnect         is " + std::to_string(autoConnect));
+                LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): autoConnect         is " + std::to_string(autoConnect));
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore autoConnect. Error = " + esp_err_to_name(ret));
+            LOG_BY_VALUE(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore autoConnect. Error = " + esp_err_to_name(ret));
         }
     }
 
@@ -69,12 +71,12 @@ void Wifi::restoreVariablesFromNVS()
         if (nvs->readU8IntegerFromNVS("hostStatus", &hostStatus) == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): hostStatus          is " + std::to_string(hostStatus));
+                LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): hostStatus          is " + std::to_string(hostStatus));
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore hostStatus");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore hostStatus");
         }
     }
 
@@ -83,12 +85,12 @@ void Wifi::restoreVariablesFromNVS()
         if (nvs->readStringFromNVS("ssidPri", &ssidPri) == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): ssidPri             is " + ssidPri);
+                LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): ssidPri             is " + ssidPri);
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore ssidPri");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore ssidPri");
         }
     }
 
@@ -97,32 +99,32 @@ void Wifi::restoreVariablesFromNVS()
         if (nvs->readStringFromNVS("ssidPwdPri", &ssidPwdPri) == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): ssidPwdPri          is " + ssidPwdPri);
+                LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): ssidPwdPri          is " + ssidPwdPri);
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore ssidPwdPri");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore ssidPwdPri");
         }
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): wifi namespace end");
+        LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): wifi namespace end");
 
     if (successFlag)
     {
         if (show & _showNVS)
-            logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Success");
+            LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Success");
     }
     else
-        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Failed");
+        LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Failed");
 
     nvs->closeNVStorage();
     xSemaphoreGive(semNVSEntry);
     return;
 
 wifi_restoreVariablesFromNVS_err:
-    logByValue(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
     xSemaphoreGive(semNVSEntry);
 }
 
@@ -143,19 +145,19 @@ void Wifi::saveVariablesToNVS()
         ESP_GOTO_ON_ERROR(nvs->openNVSStorage("wifi"), wifi_saveVariablesToNVS_err, TAG, "nvs->openNVSStorage('wifi') failed");
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): wifi namespace start");
+        LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): wifi namespace start");
 
     if (successFlag) // Save runStackSizeK
     {
         if (nvs->writeU8IntegerToNVS("runStackSizeK", runStackSizeK) == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): runStackSizeK       = " + std::to_string(runStackSizeK));
+                LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): runStackSizeK       = " + std::to_string(runStackSizeK));
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Unable to writeU8IntegerToNVS runStackSizeK");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Unable to writeU8IntegerToNVS runStackSizeK");
         }
     }
 
@@ -164,12 +166,12 @@ void Wifi::saveVariablesToNVS()
         if (nvs->writeBooleanToNVS("autoConnect", autoConnect) == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): autoConnect         = " + std::to_string(autoConnect));
+                LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): autoConnect         = " + std::to_string(autoConnect));
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Unable to save autoConnect");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Unable to save autoConnect");
         }
     }
 
@@ -178,12 +180,12 @@ void Wifi::saveVariablesToNVS()
         if (nvs->writeU8IntegerToNVS("hostStatus", hostStatus) == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): hostStatus          = " + std::to_string(hostStatus));
+                LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): hostStatus          = " + std::to_string(hostStatus));
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Unable to save hostStatus");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Unable to save hostStatus");
         }
     }
 
@@ -192,12 +194,12 @@ void Wifi::saveVariablesToNVS()
         if (nvs->writeStringToNVS("ssidPri", &ssidPri) == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): ssidPri             = " + ssidPri);
+                LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): ssidPri             = " + ssidPri);
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Unable to save ssidPri");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Unable to save ssidPri");
         }
     }
 
@@ -206,31 +208,31 @@ void Wifi::saveVariablesToNVS()
         if (nvs->writeStringToNVS("ssidPwdPri", &ssidPwdPri) == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): ssidPwdPri          = " + ssidPwdPri);
+                LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): ssidPwdPri          = " + ssidPwdPri);
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Unable to save ssidPwdPri");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Unable to save ssidPwdPri");
         }
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): wifi namespace end");
+        LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): wifi namespace end");
 
     if (successFlag)
     {
         if (show & _showNVS)
-            logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Success");
+            LOG_BY_VALUE(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Success");
     }
     else
-        logByValue(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Failed");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Failed");
 
     nvs->closeNVStorage();
     xSemaphoreGive(semNVSEntry);
     return;
 
 wifi_saveVariablesToNVS_err:
-    logByValue(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semWifiRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
     xSemaphoreGive(semNVSEntry);
 }
@@ -12,9 +12,11 @@ extern SemaphoreHandle_t semWifiRouteLock;
 
 void Wifi::runMarshaller(void *arg)
 {
+    LOG_Heap::setTaskHeapTag(LOG_HEAP_TAG::Wifi);
     ((Wifi *)arg)->run();
-    vTaskDelete(NULL);
     ((Wifi *)arg)->taskHandleWIFIRun = nullptr; // This doesn't happen automatically but we look at this variable for validity, so set it manually.
+    LOG_Tasks::unregisterTask(nullptr);
+    vTaskDelete(NULL);
 }
 
 void Wifi::run(void)
@@ -25,16 +27,27 @@ void Wifi::run(void)
     bool cmdRunDirectives = false;
 
     uint32_t wifiConnStartTicks = 0;     // Starting point for..
-    uint8_t waitingOnHostConnSec = 0;    //
-    uint8_t waitingOnIPAddressSec = 0;   // Single second counters
-    uint8_t noValidTimeSecToRestart = 0; //
+    uint8_t noValidTimeSecToRestart = 0; // Single second counter
 
     WIFI_NOTIFY wifiTaskNotifyValue = static_cast<WIFI_NOTIFY>(0);
+    uint32_t wifiNotifyBits = 0;
+
+    uint32_t heapAllocsAtPass = 0; // A quiet Run pass (nothing received, no state change) must not allocate.
+    uint32_t sntpQuietPasses = 0;  //
+    bool quietPass = false;        //
 
     while (true)
     {
+        LOG_Tasks::heartbeat((uint8_t)wifiOP, (wifiOP == WIFI_OP::Idle) ? LOG_HEARTBEAT_IDLE_MS : LOG_HEARTBEAT_MS);
+
+        heapAllocsAtPass = LOG_Heap::getTaskHeapAllocs();
+        quietPass = true;
+
         if (uxQueueMessagesWaiting(queueEvents)) // We always give top priorty to handling events
+        {
+            quietPass = false;
             runEvents();
+        }
         //
         // In every pass, we examine Task Notifications and/or the Command Request Queue.  The extra bonus we get here is that this is our yield
         // time back to the scheduler.  We don't need to perform another yield anywhere else to cooperatively yield to the OS.
@@ -42,82 +55,103 @@ void Wifi::run(void)
         // cadenceTimeDelay for a Task Notification wait.  This permits us to reduce power consumption when we are not busy without sacrificing latentcy
         // when we are busy.  Relaxed schduling with 250mSec equates to about a 4Hz run() loop cadence.
         //
-        wifiTaskNotifyValue = static_cast<WIFI_NOTIFY>(ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(cadenceTimeDelay)));
+        // Notifications arrive as bits, so senders never wait on us and nothing sent while we were busy is lost.  All of the
+        // bits pending are taken in this pass, lowest first.  That way the Directive bits are in place before CMD_RUN_DIRECTIVES.
+        // While a coroutine waits with a timeout, we wake no later than the moment it falls due.
+        //
+        xTaskNotifyWait(0, UINT32_MAX, &wifiNotifyBits, executor.waitTicks(pdMS_TO_TICKS(cadenceTimeDelay)));
+
+        if (wifiNotifyBits & WIFI_NOTIFY_EXECUTOR) // An event one of our coroutines is waiting on
+        {
+            quietPass = false;
+            wifiNotifyBits &= ~WIFI_NOTIFY_EXECUTOR;
+        }
+
+        if (executor.busy())
+            executor.resume(wifiNotifyBits);
 
-        if (wifiTaskNotifyValue > static_cast<WIFI_NOTIFY>(0)) // Looking for Task Notifications
+        if (wifiNotifyBits != 0) // Looking for Task Notifications
         {
+            quietPass = false;
+            LOG_Latency::latencyNotified(LOG_LAT_SOURCE::Wifi, wifiNotifyBits);
+
             // Task Notifications should be used for notifications (NFY_NOTIFICATION) or commands (CMD_COMMAND) both of which need no input and return no data.
-            switch (wifiTaskNotifyValue)
-            {
-            case WIFI_NOTIFY::CMD_CLEAR_PRI_HOST: // Some of these notifications set Directive bits - a follow up CMD_RUN_DIRECTIVES task notification starts the action.
+            for (uint32_t pending = wifiNotifyBits; pending != 0; pending &= (pending - 1))
             {
-                if (show & _showRun)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Received WIFI_NOTIFY::CMD_CLEAR_PRI_HOST");
-                wifiDirectives |= _wifiClearPriHostInfo;
-                break;
-            }
+                wifiTaskNotifyValue = static_cast<WIFI_NOTIFY>(pending & (~pending + 1)); // The lowest bit still pending
 
-            case WIFI_NOTIFY::CMD_DISC_HOST:
-            {
-                if (show & _showRun)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Received WIFI_NOTIFY::CMD_DISC_HOST");
-                wifiDirectives |= _wifiDisconnectHost;
-                break;
-            }
+                switch (wifiTaskNotifyValue)
+                {
+                case WIFI_NOTIFY::CMD_CLEAR_PRI_HOST: // Some of these notifications set Directive bits - a follow up CMD_RUN_DIRECTIVES task notification starts the action.
+                {
+                    if (show & _showRun)
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "Received WIFI_NOTIFY::CMD_CLEAR_PRI_HOST");
+                    wifiDirectives |= _wifiClearPriHostInfo;
+                    break;
+                }
 
-            case WIFI_NOTIFY::CMD_CONN_PRI_HOST:
-            {
-                if (show & _showRun)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Received WIFI_NOTIFY::CMD_CONN_PRI_HOST");
-                wifiDirectives |= _wifiConnectPriHost;
-                break;
-            }
+                case WIFI_NOTIFY::CMD_DISC_HOST:
+                {
+                    if (show & _showRun)
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "Received WIFI_NOTIFY::CMD_DISC_HOST");
+                    wifiDirectives |= _wifiDisconnectHost;
+                    break;
+                }
 
-            case WIFI_NOTIFY::CMD_PROV_HOST:
-            {
-                if (show & _showRun)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Received WIFI_NOTIFY::CMD_CONN_PRI_HOST");
-                wifiDirectives |= _wifiProvisionPriHost;
-                break;
-            }
+                case WIFI_NOTIFY::CMD_CONN_PRI_HOST:
+                {
+                    if (show & _showRun)
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "Received WIFI_NOTIFY::CMD_CONN_PRI_HOST");
+                    wifiDirectives |= _wifiConnectPriHost;
+                    break;
+                }
 
-            case WIFI_NOTIFY::CMD_RUN_DIRECTIVES:
-            {
-                if (show & _showRun)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Received WIFI_NOTIFY::CMD_RUN_DIRECTIVES");
-                cmdRunDirectives = true;
-                break;
-            }
+                case WIFI_NOTIFY::CMD_PROV_HOST:
+                {
+                    if (show & _showRun)
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "Received WIFI_NOTIFY::CMD_CONN_PRI_HOST");
+                    wifiDirectives |= _wifiProvisionPriHost;
+                    break;
+                }
 
-            case WIFI_NOTIFY::CMD_SET_AUTOCONNECT:
-            {
-                if (show & _showRun)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Received WIFI_NOTIFY::CMD_SET_AUTOCONNECT");
+                case WIFI_NOTIFY::CMD_RUN_DIRECTIVES:
+                {
+                    if (show & _showRun)
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "Received WIFI_NOTIFY::CMD_RUN_DIRECTIVES");
+                    cmdRunDirectives = true;
+                    break;
+                }
 
-                autoConnect = true;
-                saveVariablesToNVS();
-                break;
-            }
+                case WIFI_NOTIFY::CMD_SET_AUTOCONNECT:
+                {
+                    if (show & _showRun)
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "Received WIFI_NOTIFY::CMD_SET_AUTOCONNECT");
 
-            case WIFI_NOTIFY::CMD_CLEAR_AUTOCONNECT:
-            {
-                if (show & _showRun)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Received WIFI_NOTIFY::CMD_CLEAR_AUTOCONNECT");
+                    autoConnect = true;
+                    saveVariablesToNVS();
+                    break;
+                }
 
-                autoConnect = false;
-                saveVariablesToNVS();
-                break;
-            }
+                case WIFI_NOTIFY::CMD_CLEAR_AUTOCONNECT:
+                {
+                    if (show & _showRun)
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "Received WIFI_NOTIFY::CMD_CLEAR_AUTOCONNECT");
 
-            case WIFI_NOTIFY::CMD_SHUT_DOWN:
-            {
-                if (show & _showRun)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Received WIFI_NOTIFY::CMD_SHUT_DOWN");
+                    autoConnect = false;
+                    saveVariablesToNVS();
+                    break;
+                }
 
-                wifiShdnStep = WIFI_SHUTDOWN::Start;
-                wifiOP = WIFI_OP::Shutdown;
-                break;
-            }
+                case WIFI_NOTIFY::CMD_SHUT_DOWN:
+                {
+                    if (show & _showRun)
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "Received WIFI_NOTIFY::CMD_SHUT_DOWN");
+
+                    wifiShdnStep = WIFI_SHUTDOWN::Start;
+                    wifiOP = WIFI_OP::Shutdown;
+                    break;
+                }
+                }
             }
         }
         else // If we don't have a Notification, then look for any Command Requests (thereby handling only one upon each run() loop entry)
@@ -125,15 +159,18 @@ void Wifi::run(void)
             // Queue based commands should be used for commands which provide input and optioanlly return data.   Use a notification if NO data is passed either way.
             if (xQueuePeek(queueCmdRequests, (void *)&ptrWifiCmdRequest, 0)) // Do I have a command request in the queue?
             {
+                quietPass = false;
+                LOG_Latency::latencyDequeued(LOG_LAT_SOURCE::Wifi, (uint8_t)ptrWifiCmdRequest->requestedCmd, &ptrWifiCmdRequest->stamp);
+
                 if (ptrWifiCmdRequest != nullptr)
                 {
                     if (show & _showPayload)
                     {
-                        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): cmd is  " + std::to_string((int)ptrWifiCmdRequest->requestedCmd));
-                        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): data is " + std::string((char *)(ptrWifiCmdRequest->data1)));
-                        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): len  is " + std::to_string(ptrWifiCmdRequest->data1Length));
-                        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): data is " + std::string((char *)(ptrWifiCmdRequest->data2)));
-                        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): len  is " + std::to_string(ptrWifiCmdRequest->data2Length));
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "cmd is  %d", (int)ptrWifiCmdRequest->requestedCmd);
+                        LOG_PRINTF(ESP_LOG_INFO, semWifiRouteLock, TAG, "data is %s", (char *)(ptrWifiCmdRequest->data1));
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "len  is %d", (int)ptrWifiCmdRequest->data1Length);
+                        LOG_PRINTF(ESP_LOG_INFO, semWifiRouteLock, TAG, "data is %s", (char *)(ptrWifiCmdRequest->data2));
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "len  is %d", (int)ptrWifiCmdRequest->data2Length);
                     }
                 }
 
@@ -142,7 +179,7 @@ void Wifi::run(void)
                 case WIFI_COMMAND::SET_SSID_PRI:
                 {
                     if (show & _showRun)
-                        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Received the command WIFI_COMMAND::SET_SSID_PRI");
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "Received the command WIFI_COMMAND::SET_SSID_PRI");
 
                     ssidPri = std::string((char *)ptrWifiCmdRequest->data1, (size_t)ptrWifiCmdRequest->data1Length);
                     ssidPwdPri = std::string((char *)ptrWifiCmdRequest->data2, (size_t)ptrWifiCmdRequest->data2Length);
@@ -160,15 +197,23 @@ void Wifi::run(void)
                 case WIFI_COMMAND::SET_SHOW_FLAGS:
                 {
                     if (show & _showRun)
-                        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Received the command WIFI_COMMAND::SET_SHOW_FLAGS");
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "Received the command WIFI_COMMAND::SET_SHOW_FLAGS");
 
                     show = ptrWifiCmdRequest->data1[0];
                     showWifi = ptrWifiCmdRequest->data1[1];
                     setLogLevels();
+
+                    if ((ptrWifiCmdRequest->data1Length > 2) && (sntp != nullptr)) // Optional 3rd and 4th bytes reach our sub-objects
+                        sntp->setShowFlags(show, ptrWifiCmdRequest->data1[2]);
+
+                    if ((ptrWifiCmdRequest->data1Length > 3) && (prov != nullptr))
+                        prov->setShowFlags(show, ptrWifiCmdRequest->data1[3]);
                     break;
                 }
                 }
+                LOG_Latency::latencyServiced(LOG_LAT_SOURCE::Wifi, (uint8_t)ptrWifiCmdRequest->requestedCmd, &ptrWifiCmdRequest->stamp);
                 xQueueReceive(queueCmdRequests, (void *)&ptrWifiCmdRequest, pdMS_TO_TICKS(0)); // Remove the item from the queue
+                cmdRequests.release(ptrWifiCmdRequest);                                         // No response, so the slot is free again
             }
         }
 
@@ -190,7 +235,11 @@ void Wifi::run(void)
                 }
             }
 
+            sntpQuietPasses = sntp->runHeapAllocs.quietPasses;
             sntp->run(); // We still need to enter SNTP can it process server events.
+
+            if (sntp->runHeapAllocs.quietPasses == sntpQuietPasses) // SNTP had work to do, so this pass is not quiet.
+                quietPass = false;
             break;
         }
 
@@ -207,7 +256,7 @@ void Wifi::run(void)
             case WIFI_SHUTDOWN::Start:
             {
                 if (showWifi & _showWifiShdnSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_SHUTDOWN::Start");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_SHUTDOWN::Start");
 
                 cadenceTimeDelay = 10; // Always allow a bit of delay in Run processing.
                 wifiShdnStep = WIFI_SHUTDOWN::Cancel_Directives;
@@ -217,7 +266,7 @@ void Wifi::run(void)
             case WIFI_SHUTDOWN::Cancel_Directives:
             {
                 if (showWifi & _showWifiShdnSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_SHUTDOWN::Cancel_Directives - Step " + std::to_string((int)WIFI_SHUTDOWN::Cancel_Directives));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_SHUTDOWN::Cancel_Directives - Step %d", (int)WIFI_SHUTDOWN::Cancel_Directives);
 
                 wifiDirectivesStep = WIFI_DIRECTIVES::Finished; // Immediately cancel out all Directives...
                 wifiDirectives = 0;
@@ -230,7 +279,7 @@ void Wifi::run(void)
             case WIFI_SHUTDOWN::Disconnect_Wifi:
             {
                 if (showWifi & _showWifiShdnSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_SHUTDOWN::Disconnect_Wifi - Step " + std::to_string((int)WIFI_SHUTDOWN::Disconnect_Wifi));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_SHUTDOWN::Disconnect_Wifi - Step %d", (int)WIFI_SHUTDOWN::Disconnect_Wifi);
 
                 wifiDiscStep = WIFI_DISC::Start;
                 wifiOP = WIFI_OP::Disconnect;
@@ -242,7 +291,7 @@ void Wifi::run(void)
             case WIFI_SHUTDOWN::Wait_For_Disconnection:
             {
                 if (showWifi & _showWifiShdnSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_SHUTDOWN::Wait_For_Disconnection - Step " + std::to_string((int)WIFI_SHUTDOWN::Wait_For_Disconnection));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_SHUTDOWN::Wait_For_Disconnection - Step %d", (int)WIFI_SHUTDOWN::Wait_For_Disconnection);
 
                 if (wifiConnState != WIFI_CONN_STATE::WIFI_DISCONNECTED) //
                     break;                                               // Not disconnected yet
@@ -254,7 +303,7 @@ void Wifi::run(void)
             case WIFI_SHUTDOWN::Finished:
             {
                 if (showWifi & _showWifiShdnSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_SHUTDOWN::Finished");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_SHUTDOWN::Finished");
                 // This exits the run function. (notice how the compiler doesn't complain about a missing break statement)
                 // In the runMarshaller, the task is deleted and the task handler set to nullptr.
                 return;
@@ -270,7 +319,7 @@ void Wifi::run(void)
             case WIFI_INIT::Start:
             {
                 if (show & _showInit)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_INIT::Start");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_INIT::Start");
 
                 cadenceTimeDelay = 10;                              // Don't permit scheduler delays in Run processing.
                 wifiConnState = WIFI_CONN_STATE::WIFI_DISCONNECTED; // Reset the connection state.
@@ -282,7 +331,7 @@ void Wifi::run(void)
             case WIFI_INIT::Checks:
             {
                 if (show & _showInit)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_INIT::Checks - Step " + std::to_string((int)WIFI_INIT::Checks));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_INIT::Checks - Step %d", (int)WIFI_INIT::Checks);
 
                 // NOTE: Checking for all the required variables here helps us reduce complexity in the remainder of the code.
 
@@ -307,7 +356,7 @@ void Wifi::run(void)
             case WIFI_INIT::Set_Variables_From_Config:
             {
                 if (show & _showInit)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_INIT::Set_Variables_From_Config - Step " + std::to_string((int)WIFI_INIT::Set_Variables_From_Config));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_INIT::Set_Variables_From_Config - Step %d", (int)WIFI_INIT::Set_Variables_From_Config);
                 //
                 // Any value held in Config will over-write any value stored in the system.  Make sure Config values are clear before sending product to the field.
                 //
@@ -317,22 +366,22 @@ void Wifi::run(void)
                 if ((ssidPri.compare(configValue) != 0) && (configValue.compare("empty") != 0))
                 {
                     ssidPri = CONFIG_ESP_WIFI_STA_SSID_PRI;
-                    logByValue(ESP_LOG_WARN, semWifiRouteLock, TAG, std::string(__func__) + "(): Using ssidPri    from Configuration with a value of " + ssidPri);
+                    LOG_PRINTF(ESP_LOG_WARN, semWifiRouteLock, TAG, "Using ssidPri    from Configuration with a value of %s", ssidPri.c_str());
                     saveVariablesToNVS();
                 }
                 else
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Using ssidPri    from nvs with a value of " + ssidPri);
+                    LOG_PRINTF(ESP_LOG_INFO, semWifiRouteLock, TAG, "Using ssidPri    from nvs with a value of %s", ssidPri.c_str());
 
                 configValue = CONFIG_ESP_WIFI_STA_PASSWORD_PRI;
 
                 if ((ssidPwdPri.compare(configValue) != 0) && (configValue.compare("empty") != 0))
                 {
                     ssidPwdPri = CONFIG_ESP_WIFI_STA_PASSWORD_PRI;
-                    logByValue(ESP_LOG_WARN, semWifiRouteLock, TAG, std::string(__func__) + "(): Using ssidPwdPri from Configuration with a value of " + ssidPwdPri);
+                    LOG_PRINTF(ESP_LOG_WARN, semWifiRouteLock, TAG, "Using ssidPwdPri from Configuration with a value of %s", ssidPwdPri.c_str());
                     saveVariablesToNVS();
                 }
                 else
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Using ssidPwdPri from nvs with a value of " + ssidPwdPri);
+                    LOG_PRINTF(ESP_LOG_INFO, semWifiRouteLock, TAG, "Using ssidPwdPri from nvs with a value of %s", ssidPwdPri.c_str());
 
                 wifiInitStep = WIFI_INIT::Auto_Connect;
                 [[fallthrough]];
@@ -341,7 +390,7 @@ void Wifi::run(void)
             case WIFI_INIT::Auto_Connect:
             {
                 if (show & _showInit)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_INIT::Auto_Connect - Step " + std::to_string((int)WIFI_INIT::Auto_Connect));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_INIT::Auto_Connect - Step %d", (int)WIFI_INIT::Auto_Connect);
 
                 if (autoConnect) // If autoConnect is set, then set a directive bit to connect to the active host.
                 {
@@ -356,7 +405,7 @@ void Wifi::run(void)
             case WIFI_INIT::Finished:
             {
                 if (show & _showInit)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_INIT::Finished");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_INIT::Finished");
 
                 cadenceTimeDelay = 250;       // Return to relaxed scheduling.
                 xSemaphoreGive(semWifiEntry); // Allow entry from any other calling tasks
@@ -367,7 +416,7 @@ void Wifi::run(void)
             case WIFI_INIT::Error:
             {
                 if (show & _showInit)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_INIT::Error");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_INIT::Error");
 
                 wifiOP = WIFI_OP::Error;
                 wifiInitStep = WIFI_INIT::Finished;
@@ -384,7 +433,7 @@ void Wifi::run(void)
             case WIFI_DIRECTIVES::Start:
             {
                 if (showWifi & _showWifiDirectiveSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_DIRECTIVES::Start");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_DIRECTIVES::Start");
                 //
                 // Directives are stored and executed in a logical order.
                 // All directives are cleared once executed.
@@ -396,7 +445,7 @@ void Wifi::run(void)
                 // wifiDirectives |= _wifiConnectPriHost;
                 //
                 if (showWifi & _showWifiDirectiveSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): wifiDirectives = " + std::to_string(wifiDirectives));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "wifiDirectives = %d", (int)wifiDirectives);
 
                 if (wifiDirectives > 0)
                     wifiDirectivesStep = WIFI_DIRECTIVES::Clear_Data;
@@ -409,7 +458,7 @@ void Wifi::run(void)
             case WIFI_DIRECTIVES::Clear_Data:
             {
                 if (showWifi & _showWifiDirectiveSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_DIRECTIVES::Clear_Data - Step " + std::to_string((int)WIFI_DIRECTIVES::Clear_Data));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_DIRECTIVES::Clear_Data - Step %d", (int)WIFI_DIRECTIVES::Clear_Data);
 
                 //
                 // Clear any data as required.  This is a one type action that is cleared from the Directives.
@@ -431,7 +480,7 @@ void Wifi::run(void)
             case WIFI_DIRECTIVES::Disconnect_Host:
             {
                 if (showWifi & _showWifiDirectiveSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_DIRECTIVES::Disconnect_Host - Step " + std::to_string((int)WIFI_DIRECTIVES::Disconnect_Host));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_DIRECTIVES::Disconnect_Host - Step %d", (int)WIFI_DIRECTIVES::Disconnect_Host);
                 //
                 // Disconnect any host that is active. This a one action that is cleared from the Directives.
                 // We might call to Disconnect a Host than is in service, but this is rare and typically be used when
@@ -458,7 +507,7 @@ void Wifi::run(void)
             case WIFI_DIRECTIVES::Provision_Host:
             {
                 if (showWifi & _showWifiDirectiveSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_DIRECTIVES::Provision_Host - Step " + std::to_string((int)WIFI_DIRECTIVES::Provision_Host));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_DIRECTIVES::Provision_Host - Step %d", (int)WIFI_DIRECTIVES::Provision_Host);
 
                 if (wifiDirectives & _wifiProvisionPriHost)
                 {
@@ -481,7 +530,7 @@ void Wifi::run(void)
             case WIFI_DIRECTIVES::Connect_Host:
             {
                 if (showWifi & _showWifiDirectiveSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_DIRECTIVES::Connect_Host - Step " + std::to_string((int)WIFI_DIRECTIVES::Connect_Host));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_DIRECTIVES::Connect_Host - Step %d", (int)WIFI_DIRECTIVES::Connect_Host);
 
                 if (wifiDirectives & _wifiConnectPriHost)
                 {
@@ -496,10 +545,10 @@ void Wifi::run(void)
                     if (wifiConnState != WIFI_CONN_STATE::WIFI_CONNECTED_STA) // Only consider connecting if not connected...
                     {
                         if (showWifi & _showWifiDirectiveSteps)
-                            logByValue(ESP_LOG_WARN, semWifiRouteLock, TAG, std::string(__func__) + "(): connectPriHost");
+                            LOG_DEFERRED(ESP_LOG_WARN, semWifiRouteLock, TAG, "connectPriHost");
 
                         if (showWifi & _showWifiDirectiveSteps)
-                            logByValue(ESP_LOG_WARN, semWifiRouteLock, TAG, std::string(__func__) + "(): primary Host Valid");
+                            LOG_DEFERRED(ESP_LOG_WARN, semWifiRouteLock, TAG, "primary Host Valid");
 
                         hostStatus |= _hostPriActive; // Indicate that Primary is active
                         saveVariablesToNVS();         // Can't afford a delay here.
@@ -517,7 +566,7 @@ void Wifi::run(void)
             case WIFI_DIRECTIVES::Finished:
             {
                 if (showWifi & _showWifiDirectiveSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_DIRECTIVES::Finished");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_DIRECTIVES::Finished");
 
                 if (wifiDirectives > 0) // If another directive has come in, restart our directives process
                     wifiDirectivesStep = WIFI_DIRECTIVES::Start;
@@ -536,7 +585,7 @@ void Wifi::run(void)
             case WIFI_CONN::Start:
             {
                 if (showWifi & _showWifiConnSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_CONN::Start");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_CONN::Start");
 
                 cadenceTimeDelay = 10; // Don't permit scheduler delays in Run processing.
                 wifiConnStep = WIFI_CONN::Create_Netif_Objects;
@@ -546,7 +595,7 @@ void Wifi::run(void)
             case WIFI_CONN::Create_Netif_Objects:
             {
                 if (showWifi & _showWifiConnSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_CONN::Create_Netif_Objects - Step " + std::to_string((int)WIFI_CONN::Create_Netif_Objects));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_CONN::Create_Netif_Objects - Step %d", (int)WIFI_CONN::Create_Netif_Objects);
 
                 if (defaultSTANetif == nullptr)
                 {
@@ -554,7 +603,7 @@ void Wifi::run(void)
                     ESP_GOTO_ON_FALSE(defaultSTANetif, ESP_FAIL, wifi_Create_Netif_STA_Object_err, TAG, "esp_netif_create_default_wifi_sta() returned nullptr.");
                 }
                 else
-                    logByValue(ESP_LOG_WARN, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_CONN::Create_Netif_Objects: defaultSTANetif NOT NULL at the start of the Connection, what happened?");
+                    LOG_DEFERRED(ESP_LOG_WARN, semWifiRouteLock, TAG, "WIFI_CONN::Create_Netif_Objects: defaultSTANetif NOT NULL at the start of the Connection, what happened?");
 
                 wifiConnStep = WIFI_CONN::Wifi_Init;
                 break;
@@ -568,7 +617,7 @@ void Wifi::run(void)
             case WIFI_CONN::Wifi_Init:
             {
                 if (showWifi & _showWifiConnSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_CONN::Wifi_Init - Step " + std::to_string((int)WIFI_CONN::Wifi_Init));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_CONN::Wifi_Init - Step %d", (int)WIFI_CONN::Wifi_Init);
 
                 wifi_init_config_t cfg = WIFI_INIT_CONFIG_DEFAULT();
                 ESP_GOTO_ON_ERROR(esp_wifi_init(&cfg), wifi_Wifi_Init_err, TAG, "esp_wifi_init(&cfg) failed");
@@ -584,7 +633,7 @@ void Wifi::run(void)
             case WIFI_CONN::Register_Handlers:
             {
                 if (showWifi & _showWifiConnSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_CONN::Register_Handlers - Step " + std::to_string((int)WIFI_CONN::Register_Handlers));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_CONN::Register_Handlers - Step %d", (int)WIFI_CONN::Register_Handlers);
 
                 if (instanceHandlerWifiEventAnyId == nullptr)
                     ESP_GOTO_ON_ERROR(esp_event_handler_instance_register(WIFI_EVENT, ESP_EVENT_ANY_ID, &eventHandlerWifiMarshaller, this, &instanceHandlerWifiEventAnyId), Wifi_Register_Event_Handlers_err, TAG, "register WIFI_EVENT::ESP_EVENT_ANY_ID failed");
@@ -604,7 +653,7 @@ void Wifi::run(void)
             case WIFI_CONN::Set_Wifi_Mode:
             {
                 if (showWifi & _showWifiConnSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_CONN::Set_Wifi_Mode - Step " + std::to_string((int)WIFI_CONN::Set_Wifi_Mode));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_CONN::Set_Wifi_Mode - Step %d", (int)WIFI_CONN::Set_Wifi_Mode);
 
                 ESP_GOTO_ON_ERROR(esp_wifi_set_mode(WIFI_MODE_STA), wifi_Set_Wifi_Mode_err, TAG, "esp_wifi_set_mode(WIFI_MODE_APSTA) failed");
                 wifiConnStep = WIFI_CONN::Set_Sta_Config;
@@ -619,7 +668,7 @@ void Wifi::run(void)
             case WIFI_CONN::Set_Sta_Config:
             {
                 if (showWifi & _showWifiConnSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_CONN::Set_Sta_Config - Step " + std::to_string((int)WIFI_CONN::Set_Sta_Config));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_CONN::Set_Sta_Config - Step %d", (int)WIFI_CONN::Set_Sta_Config);
 
                 // Must do a read, modify, write with Config data.
                 ESP_GOTO_ON_ERROR(esp_wifi_get_config(WIFI_IF_STA, &staConfig), wifi_Set_Sta_Config_err, TAG, "esp_wifi_get_config(WIFI_IF_STA, &staConfig) failed");
@@ -678,12 +727,12 @@ void Wifi::run(void)
 
                 if (showWifi & _showWifiConnSteps)
                 {
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): sta.ssid                    " + std::string((char *)staConfig.sta.ssid));
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): sta.password                " + std::string((char *)staConfig.sta.password));
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): reserved                    " + std::to_string(staConfig.sta.reserved));
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): he_dcm_max_constellation_tx " + std::to_string(staConfig.sta.he_dcm_max_constellation_tx));
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): he_reserved                 " + std::to_string(staConfig.sta.he_reserved));
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): he_mcs9_enabled             " + std::to_string(staConfig.sta.he_mcs9_enabled));
+                    LOG_PRINTF(ESP_LOG_INFO, semWifiRouteLock, TAG, "sta.ssid                    %s", (char *)staConfig.sta.ssid);
+                    LOG_PRINTF(ESP_LOG_INFO, semWifiRouteLock, TAG, "sta.password                %s", (char *)staConfig.sta.password);
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "reserved                    %d", (int)staConfig.sta.reserved);
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "he_dcm_max_constellation_tx %d", (int)staConfig.sta.he_dcm_max_constellation_tx);
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "he_reserved                 %d", (int)staConfig.sta.he_reserved);
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "he_mcs9_enabled             %d", (int)staConfig.sta.he_mcs9_enabled);
                 }
 
                 ESP_GOTO_ON_ERROR(esp_wifi_set_config(WIFI_IF_STA, &staConfig), wifi_Set_Sta_Config_err, TAG, "esp_wifi_set_config(WIFI_IF_STA, &staConfig) failed");
@@ -699,99 +748,63 @@ void Wifi::run(void)
             case WIFI_CONN::Wifi_Start:
             {
                 if (showWifi & _showWifiConnSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_CONN::Wifi_Start - Step " + std::to_string((int)WIFI_CONN::Wifi_Start));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_CONN::Wifi_Start - Step %d", (int)WIFI_CONN::Wifi_Start);
+
+                wifiHostTimeOut = false; // Reset all the flags
+                wifiIPAddressTimeOut = false;
+                wifiNoValidTimeTimeOut = false;
+
+                connectTask = connectHost(); // It arms its events before the radio starts, so neither can come and go unseen
+                ESP_GOTO_ON_FALSE(executor.start(connectTask), ESP_ERR_NO_MEM, wifi_Wifi_Start_err, TAG, "WIFI_CONN::Wifi_Start connectHost() did not start");
 
                 ESP_GOTO_ON_ERROR(esp_wifi_start(), wifi_Wifi_Start_err, TAG, "WIFI_CONN::Wifi_Start esp_wifi_start() failed");
                 ESP_GOTO_ON_ERROR(esp_wifi_set_ps(WIFI_PS_MIN_MODEM), wifi_Wifi_Start_err, TAG, "WIFI_CONN::Wifi_Start esp_wifi_set_ps() failed");
 
-                wifiHostTimeOut = false;                  // Reset all the flags and start the timer algorithm.
-                wifiIPAddressTimeOut = false;             //
-                wifiNoValidTimeTimeOut = false;           //
-                wifiConnStartTicks = xTaskGetTickCount(); //
-
                 if (showWifi & _showWifiConnSteps) // Announce our intent to Wait To Connect before we start the wait.  This reduces unneeded messaging in that wait state.
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_CONN::Wifi_Waiting_To_Connect - Step " + std::to_string((int)WIFI_CONN::Wifi_Waiting_To_Connect));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_CONN::Wifi_Waiting_To_Connect - Step %d", (int)WIFI_CONN::Wifi_Waiting_To_Connect);
 
+                cadenceTimeDelay = 250; // connectHost() is resumed by its events, so there is nothing to poll while it waits.
                 wifiConnStep = WIFI_CONN::Wifi_Waiting_To_Connect;
                 break;
 
             wifi_Wifi_Start_err:
+                connectTask.cancel();
                 errMsg = std::string(__func__) + "(): WIFI_CONN::Wifi_Start : error : " + esp_err_to_name(ret);
                 wifiConnStep = WIFI_CONN::Error; // If we have any failures here, then exit out of our process.
                 break;
             }
 
-            case WIFI_CONN::Wifi_Waiting_To_Connect:
+            case WIFI_CONN::Wifi_Waiting_To_Connect: // connectHost() steps us from here to Wifi_Waiting_For_IP_Address
+            case WIFI_CONN::Wifi_Waiting_For_IP_Address:
             {
-                if (wifiConnState == WIFI_CONN_STATE::WIFI_CONNECTED_STA)
-                {
-                    wifiHostTimeOut = false;                  // Done looking for full STA Connection which includes receiving an IP address.
-                    wifiConnStartTicks = xTaskGetTickCount(); // Restarting the timer to look for IP Address
-
-                    if (showWifi & _showWifiConnSteps) // Announce our intent to Wait For IP Addres before we start the wait.  This reduces unneeded messaging in that wait state.
-                        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_CONN::Wifi_Waiting_For_IP_Address - Step " + std::to_string((int)WIFI_CONN::Wifi_Waiting_For_IP_Address));
-
-                    wifiConnStep = WIFI_CONN::Wifi_Waiting_For_IP_Address;
-                }
-                else // We have not connected yet, so count time here.  If we time out waiting, then disconnect so the system can connect again.
-                {
-                    waitingOnHostConnSec = (int)(pdTICKS_TO_MS(xTaskGetTickCount() - wifiConnStartTicks) / 1000);
-
-                    // ESP_LOGW(TAG, "waitingOnHostConnSec %d sec", waitingOnHostConnSec); // Debug
+                if (connectTask.running())
+                    break;
 
-                    if ((noHostSecsToRestartMax - waitingOnHostConnSec) < 4) // Show a count down just before the time out.
-                        ESP_LOGW(TAG, "Not Connected to Host, will restart in %d", noHostSecsToRestartMax - waitingOnHostConnSec);
+                ret = connectTask.result();
+                connectTask.cancel(); // Finished, so this only returns its frame
 
-                    if (waitingOnHostConnSec > noHostSecsToRestartMax)
-                    {
-                        wifiHostTimeOut = true;
-                        wifiDiscStep = WIFI_DISC::Start; // Call for a disconnect process
-                        wifiOP = WIFI_OP::Disconnect;
-                        break;
-                    }
-                }
-                break;
-            }
-
-            case WIFI_CONN::Wifi_Waiting_For_IP_Address:
-            {
-                if (haveIPAddress)
+                if (ret != ESP_OK) // Timed out.  Disconnect so the system can connect again.
                 {
-                    wifiIPAddressTimeOut = false;             // Reset all the flags and start the timer algorithm.
-                    wifiConnStartTicks = xTaskGetTickCount(); // Restarting timer to look for Epoch time.
-
-                    wifiConnStep = WIFI_CONN::Wifi_SNTP_Connect;
+                    wifiDiscStep = WIFI_DISC::Start; // Must always disconnect before connecting again.
+                    wifiOP = WIFI_OP::Disconnect;
                     break;
                 }
-                else // We have not received an IP Address yet, so count time here.  If we time out waiting, then disconnect so the system can connect again.
-                {
-                    waitingOnIPAddressSec = (int)(pdTICKS_TO_MS(xTaskGetTickCount() - wifiConnStartTicks) / 1000);
-
-                    // ESP_LOGW(TAG, "waitingOnIPAddressSec %d sec", waitingOnIPAddressSec); // Debug
 
-                    if ((noIPAddressSecToRestartMax - waitingOnIPAddressSec) < 4) // Show a count down just before the time out.
-                        ESP_LOGW(TAG, "Don't have an IP address, will restart in %d", noIPAddressSecToRestartMax - waitingOnIPAddressSec);
-
-                    if (waitingOnIPAddressSec > noIPAddressSecToRestartMax)
-                    {
-                        wifiIPAddressTimeOut = true;
-                        wifiDiscStep = WIFI_DISC::Start; // Must always disconnect before connecting again.
-                        wifiOP = WIFI_OP::Disconnect;
-                        break;
-                    }
-                }
+                cadenceTimeDelay = 10;                    // SNTP is still polled
+                wifiConnStartTicks = xTaskGetTickCount(); // Starting the timer to look for Epoch time.
+                wifiConnStep = WIFI_CONN::Wifi_SNTP_Connect;
                 break;
             }
 
             case WIFI_CONN::Wifi_SNTP_Connect:
             {
                 if (showWifi & _showWifiConnSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_CONN::Wifi_SNTP_Connect - Step " + std::to_string((int)WIFI_CONN::Wifi_SNTP_Connect));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_CONN::Wifi_SNTP_Connect - Step %d", (int)WIFI_CONN::Wifi_SNTP_Connect);
 
                 wifiConnStep = WIFI_CONN::Wifi_Waiting_SNTP_Valid_Time;
 
                 if (showWifi & _showWifiConnSteps) // Techincally we are in the next state and we give an advanced notice here.
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_CONN::Wifi_Waiting_SNTP_Valid_Time - Step " + std::to_string((int)WIFI_CONN::Wifi_Waiting_SNTP_Valid_Time));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_CONN::Wifi_Waiting_SNTP_Valid_Time - Step %d", (int)WIFI_CONN::Wifi_Waiting_SNTP_Valid_Time);
 
                 sntp->sntpOP = SNTP_OP::Connect;   // Ask SNTP to connect
                 sntp->connStep = SNTP_CONN::Start; //
@@ -803,6 +816,14 @@ void Wifi::run(void)
             {
                 if (sntp->timeValid)
                 {
+                    BUS_Message *msg = bus->acquire(BUS_TOPIC::TimeValid); // Anyone waiting on the time of day can start now
+                    if (msg != nullptr)
+                    {
+                        msg->timeValid.valid = true;
+                        time(&msg->timeValid.epoch);
+                        bus->publish(msg);
+                    }
+
                     wifiNoValidTimeTimeOut = false;
                     wifiConnStep = WIFI_CONN::Finished;
                 }
@@ -813,7 +834,7 @@ void Wifi::run(void)
                     // ESP_LOGW(TAG, "noValidTimeSecToRestart %d sec", noValidTimeSecToRestart); // Debug
 
                     if ((noValidTimeSecToRestartMax - noValidTimeSecToRestart) < 4) // Show a count down just before the time out.
-                        ESP_LOGW(TAG, "Did not receive Epoch time, will restart in %d", noValidTimeSecToRestartMax - noValidTimeSecToRestart);
+                        LOG_LIMITED(ESP_LOG_WARN, semWifiRouteLock, TAG, "Did not receive Epoch time, will restart in %d", noValidTimeSecToRestartMax - noValidTimeSecToRestart);
 
                     if (noValidTimeSecToRestart > noValidTimeSecToRestartMax)
                     {
@@ -831,10 +852,10 @@ void Wifi::run(void)
             case WIFI_CONN::Finished:
             {
                 if (showWifi & _showWifiConnSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_CONN::Finished");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_CONN::Finished");
 
-                while (!xTaskNotify(taskHandleSystemRun, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_CONNECTED), eSetValueWithoutOverwrite))
-                    vTaskDelay(pdMS_TO_TICKS(50));
+                LOG_Latency::stampNotify(LOG_LAT_SOURCE::System, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_CONNECTED));
+                xTaskNotify(taskHandleSystemRun, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_CONNECTED), eSetBits);
 
                 cadenceTimeDelay = 250; // Return to relaxed scheduling.
                 wifiOP = WIFI_OP::Directives;
@@ -858,7 +879,7 @@ void Wifi::run(void)
             case WIFI_DISC::Start:
             {
                 if (showWifi & _showWifiDiscSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_DISC::Start");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_DISC::Start");
 
                 cadenceTimeDelay = 0; // Don't permit scheduler delays in Run processing.
                 wifiDiscStep = WIFI_DISC::Cancel_Connect;
@@ -868,9 +889,10 @@ void Wifi::run(void)
             case WIFI_DISC::Cancel_Connect:
             {
                 if (showWifi & _showWifiDiscSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_DISC::Cancel_Connect - Step " + std::to_string((int)WIFI_DISC::Cancel_Connect));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_DISC::Cancel_Connect - Step %d", (int)WIFI_DISC::Cancel_Connect);
 
                 wifiDiscStep = WIFI_DISC::Deinitialize_SNTP; // Next step by default.
+                connectTask.cancel();                        // If connectHost() is still waiting, its events are unregistered here.
 
                 if (wifiConnStep != WIFI_CONN::Finished)
                 {
@@ -900,7 +922,7 @@ void Wifi::run(void)
             case WIFI_DISC::Deinitialize_SNTP:
             {
                 if (showWifi & _showWifiDiscSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_DISC::Deinitialize_SNTP - Step " + std::to_string((int)WIFI_DISC::Deinitialize_SNTP));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_DISC::Deinitialize_SNTP - Step %d", (int)WIFI_DISC::Deinitialize_SNTP);
 
                 esp_sntp_stop();
                 esp_netif_sntp_deinit(); // Deinitialize esp_netif SNTP module inside the IDF.
@@ -912,7 +934,7 @@ void Wifi::run(void)
             case WIFI_DISC::Wifi_Disconnect:
             {
                 if (showWifi & _showWifiDiscSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_DISC::Wifi_Disconnect - Step " + std::to_string((int)WIFI_DISC::Wifi_Disconnect));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_DISC::Wifi_Disconnect - Step %d", (int)WIFI_DISC::Wifi_Disconnect);
 
                 sntp->connStep = SNTP_CONN::Idle; // Reset the states
                 sntp->sntpOP = SNTP_OP::Idle;
@@ -924,9 +946,9 @@ void Wifi::run(void)
                     ret = esp_wifi_stop();
 
                     if (ret == ESP_OK)
-                        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): esp_wifi_stop() suceeded");
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "esp_wifi_stop() suceeded");
                     else if (ret == ESP_ERR_WIFI_NOT_INIT)
-                        logByValue(ESP_LOG_WARN, semWifiRouteLock, TAG, std::string(__func__) + "(): WiFi is not initialized by esp_wifi_init - esp_wifi_stop()");
+                        LOG_DEFERRED(ESP_LOG_WARN, semWifiRouteLock, TAG, "WiFi is not initialized by esp_wifi_init - esp_wifi_stop()");
                     else // Unknown error
                     {
                         errMsg = std::string(__func__) + "(): WIFI_DISC::Wifi_Disconnect: esp_wifi_stop() error : " + esp_err_to_name(ret);
@@ -935,9 +957,9 @@ void Wifi::run(void)
                     }
                 }
                 else if (ret == ESP_ERR_WIFI_NOT_INIT)
-                    logByValue(ESP_LOG_WARN, semWifiRouteLock, TAG, std::string(__func__) + "(): WiFi is not initialized by esp_wifi_init - esp_wifi_disconnect()");
+                    LOG_DEFERRED(ESP_LOG_WARN, semWifiRouteLock, TAG, "WiFi is not initialized by esp_wifi_init - esp_wifi_disconnect()");
                 else if (ret == ESP_ERR_WIFI_NOT_STARTED)
-                    logByValue(ESP_LOG_WARN, semWifiRouteLock, TAG, std::string(__func__) + "(): WiFi is not started by esp_wifi_start - esp_wifi_disconnect()");
+                    LOG_DEFERRED(ESP_LOG_WARN, semWifiRouteLock, TAG, "WiFi is not started by esp_wifi_start - esp_wifi_disconnect()");
                 else // Unknown error
                 {
                     errMsg = std::string(__func__) + "(): WIFI_DISC::Wifi_Disconnect: esp_wifi_disconnect() error : " + esp_err_to_name(ret);
@@ -953,7 +975,7 @@ void Wifi::run(void)
             case WIFI_DISC::Reset_Flags:
             {
                 if (showWifi & _showWifiDiscSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_DISC::Reset_Flags - Step " + std::to_string((int)WIFI_DISC::Reset_Flags));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_DISC::Reset_Flags - Step %d", (int)WIFI_DISC::Reset_Flags);
 
                 sntp->timeValid = false;                       // SNTP Time is not valid
                 haveIPAddress = false;                         // We don't have an IP Address
@@ -964,7 +986,7 @@ void Wifi::run(void)
             case WIFI_DISC::Unregister_Handlers:
             {
                 if (showWifi & _showWifiDiscSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_DISC::Unregister_Handlers - Step " + std::to_string((int)WIFI_DISC::Unregister_Handlers));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_DISC::Unregister_Handlers - Step %d", (int)WIFI_DISC::Unregister_Handlers);
 
                 if (instanceHandlerWifiEventAnyId != nullptr)
                 {
@@ -990,9 +1012,11 @@ void Wifi::run(void)
             case WIFI_DISC::Wifi_Deinit:
             {
                 if (showWifi & _showWifiDiscSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_DISC::Wifi_Deinit - Step " + std::to_string((int)WIFI_DISC::Wifi_Deinit));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_DISC::Wifi_Deinit - Step %d", (int)WIFI_DISC::Wifi_Deinit);
+
+                ret = esp_wifi_deinit(); // Not initialized when we shut down before ever connecting, which leaves nothing to undo
+                ESP_GOTO_ON_FALSE((ret == ESP_OK) || (ret == ESP_ERR_WIFI_NOT_INIT), ret, wifi_Wifi_Deinit_err, TAG, "esp_wifi_deinit() failed");
 
-                ESP_GOTO_ON_ERROR(esp_wifi_deinit(), wifi_Wifi_Deinit_err, TAG, "esp_wifi_deinit() failed");
                 wifiDiscStep = WIFI_DISC::Destroy_Netif_Objects;
                 break;
 
@@ -1005,7 +1029,7 @@ void Wifi::run(void)
             case WIFI_DISC::Destroy_Netif_Objects:
             {
                 if (showWifi & _showWifiDiscSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_DISC::Destroy_Netif_Objects - Step " + std::to_string((int)WIFI_DISC::Destroy_Netif_Objects));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_DISC::Destroy_Netif_Objects - Step %d", (int)WIFI_DISC::Destroy_Netif_Objects);
 
                 if (defaultSTANetif != nullptr)
                 {
@@ -1020,18 +1044,18 @@ void Wifi::run(void)
             case WIFI_DISC::Finished:
             {
                 if (showWifi & _showWifiDiscSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_DISC::Finished");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_DISC::Finished");
 
                 cadenceTimeDelay = 250; // Return to relaxed scheduling.
 
                 // This could potientially be a secondary call back to the System to annouce a disconnection.
-                while (!xTaskNotify(taskHandleSystemRun, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_DISCONNECTED), eSetValueWithoutOverwrite))
-                    vTaskDelay(pdMS_TO_TICKS(50));
+                LOG_Latency::stampNotify(LOG_LAT_SOURCE::System, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_DISCONNECTED));
+                xTaskNotify(taskHandleSystemRun, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_DISCONNECTED), eSetBits);
 
                 if (wifiShdnStep != WIFI_SHUTDOWN::Finished) // Give priority to a call for Shut Down
                 {
                     if (showWifi & _showWifiDiscSteps)
-                        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): Returning to Shutdown...");
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "Returning to Shutdown...");
 
                     wifiHostTimeOut = false;
                     wifiIPAddressTimeOut = false;
@@ -1060,8 +1084,17 @@ void Wifi::run(void)
             case WIFI_DISC::Error:
             {
                 if (showWifi & _showWifiDiscSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_DISC::Error");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_DISC::Error");
                 wifiConnStep = WIFI_CONN::Finished;
+
+                if (wifiShdnStep != WIFI_SHUTDOWN::Finished) // A Shut Down must still finish.  Our destructor is waiting on it.
+                {
+                    LOG_BY_VALUE(ESP_LOG_ERROR, semWifiRouteLock, TAG, errMsg);
+                    wifiConnState = WIFI_CONN_STATE::WIFI_DISCONNECTED;
+                    wifiOP = WIFI_OP::Shutdown;
+                    break;
+                }
+
                 wifiOP = WIFI_OP::Error;
                 break;
             }
@@ -1076,12 +1109,12 @@ void Wifi::run(void)
             case WIFI_PROV::Start:
             {
                 if (showWifi & _showWifiProvSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV::Start");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_PROV::Start");
 
                 if (showWifi & _showWifiProvSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV::Wait_On_Provision - Step " + std::to_string((int)WIFI_PROV::Wait_On_Provision));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_PROV::Wait_On_Provision - Step %d", (int)WIFI_PROV::Wait_On_Provision);
 
-                prov = new PROV(queueCmdRequests);
+                prov = new PROV(this);
                 if (prov != nullptr)
                     taskHandleProvisionRun = prov->taskHandleRun;
                 wifiProvStep = WIFI_PROV::Wait_On_Provision;
@@ -1096,7 +1129,7 @@ void Wifi::run(void)
                     prov = nullptr; // Destructor will not set pointer null.  We have to do that manually.
 
                     if (showWifi & _showWifiProvSteps)
-                        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): prov deleted");
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "prov deleted");
                     wifiProvStep = WIFI_PROV::Finished;
                 }
                 break;
@@ -1105,7 +1138,7 @@ void Wifi::run(void)
             case WIFI_PROV::Finished:
             {
                 if (showWifi & _showWifiProvSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV::Finished");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_PROV::Finished");
 
                 wifiOP = WIFI_OP::Directives;
                 break;
@@ -1114,7 +1147,7 @@ void Wifi::run(void)
             case WIFI_PROV::Error:
             {
                 if (showWifi & _showWifiProvSteps)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_PROV::Error");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_PROV::Error");
             }
             }
             break;
@@ -1124,10 +1157,10 @@ void Wifi::run(void)
         {
             cadenceTimeDelay = 250; // Return to relaxed scheduling.
 
-            while (!xTaskNotify(taskHandleSystemRun, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_DISCONNECTED), eSetValueWithoutOverwrite))
-                vTaskDelay(pdMS_TO_TICKS(50));
+            LOG_Latency::stampNotify(LOG_LAT_SOURCE::System, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_DISCONNECTED));
+            xTaskNotify(taskHandleSystemRun, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_DISCONNECTED), eSetBits);
 
-            logByValue(ESP_LOG_ERROR, semWifiRouteLock, TAG, errMsg);
+            LOG_BY_VALUE(ESP_LOG_ERROR, semWifiRouteLock, TAG, errMsg);
             wifiOP = WIFI_OP::Idle;
             [[fallthrough]];
         }
@@ -1139,6 +1172,12 @@ void Wifi::run(void)
             break;
         }
         }
+
+        if (quietPass && (wifiOP == WIFI_OP::Run) && !cmdRunDirectives)
+        {
+            runHeapAllocs.quietPasses++;
+            runHeapAllocs.quietAllocs += LOG_Heap::getTaskHeapAllocs() - heapAllocsAtPass;
+        }
     }
 }
 
@@ -1154,7 +1193,7 @@ void Wifi::runEvents()
     while (xQueueReceive(queueEvents, &evt, 0)) // Process all events in the queue
     {
         if (show & _showEvents)
-            logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): evt.event_base is " + std::string(evt.event_base) + " evt.event_id is " + std::to_string(evt.event_id));
+            LOG_PRINTF(ESP_LOG_INFO, semWifiRouteLock, TAG, "evt.event_base is %s evt.event_id is %ld", evt.event_base, (long)evt.event_id);
 
         if (evt.event_base == WIFI_EVENT)
         {
@@ -1163,21 +1202,21 @@ void Wifi::runEvents()
             case WIFI_EVENT_SCAN_DONE:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_EVENT:WIFI_EVENT_SCAN_DONE");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_EVENT:WIFI_EVENT_SCAN_DONE");
                 break;
             }
 
             case WIFI_EVENT_STA_START:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_EVENT:WIFI_EVENT_STA_START - wifi connect");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_EVENT:WIFI_EVENT_STA_START - wifi connect");
 
                 if (wifiConnState != WIFI_CONN_STATE::WIFI_READY_TO_CONNECT)
                 {
                     wifiConnState = WIFI_CONN_STATE::WIFI_READY_TO_CONNECT;
 
                     if (show & _showEvents)
-                        logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): wifiConnState = WIFI_READY_TO_CONNECT");
+                        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "wifiConnState = WIFI_READY_TO_CONNECT");
                 }
 
                 haveIPAddress = false;   // Can't possible have an IP address if we are not connected.
@@ -1187,30 +1226,30 @@ void Wifi::runEvents()
 
                 wifiConnState = WIFI_CONN_STATE::WIFI_CONNECTING_STA;
 
-                while (!xTaskNotify(taskHandleSystemRun, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_CONNECTING), eSetValueWithoutOverwrite))
-                    vTaskDelay(pdMS_TO_TICKS(50));
+                LOG_Latency::stampNotify(LOG_LAT_SOURCE::System, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_CONNECTING));
+                xTaskNotify(taskHandleSystemRun, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_CONNECTING), eSetBits);
                 break;
             }
 
             case WIFI_EVENT_STA_STOP:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_EVENT:WIFI_EVENT_STA_STOP");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_EVENT:WIFI_EVENT_STA_STOP");
 
                 sntp->timeValid = false; // When we stop the sta connection, sntp time must be invalidated.
 
                 if (wifiConnState != WIFI_CONN_STATE::WIFI_DISCONNECTED)
                     wifiConnState = WIFI_CONN_STATE::WIFI_DISCONNECTING_STA; // Only run these items one time at a Disconnection.
 
-                while (!xTaskNotify(taskHandleSystemRun, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_DISCONNECTING), eSetValueWithoutOverwrite))
-                    vTaskDelay(pdMS_TO_TICKS(50));
+                LOG_Latency::stampNotify(LOG_LAT_SOURCE::System, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_DISCONNECTING));
+                xTaskNotify(taskHandleSystemRun, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_DISCONNECTING), eSetBits);
                 break;
             }
 
             case WIFI_EVENT_STA_CONNECTED:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_EVENT:WIFI_EVENT_STA_CONNECTED - IP address will follow...");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_EVENT:WIFI_EVENT_STA_CONNECTED - IP address will follow...");
                 //
                 // We have connected to the Host.   This doesn't mean that we have an IP or access to the Internet yet,
                 // but we can confirm the ssid and password are valid for the targeted host.
@@ -1222,15 +1261,15 @@ void Wifi::runEvents()
             case WIFI_EVENT_STA_DISCONNECTED:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_EVENT:WIFI_EVENT_STA_DISCONNECTED");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_EVENT:WIFI_EVENT_STA_DISCONNECTED");
 
                 sntp->timeValid = false; // When we disconnect, sntp time must be invalidated.
 
                 if (wifiConnState != WIFI_CONN_STATE::WIFI_DISCONNECTED) // The first time we disconnect, set the state and send any required notifications.
                     wifiConnState = WIFI_CONN_STATE::WIFI_DISCONNECTED;
 
-                while (!xTaskNotify(taskHandleSystemRun, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_DISCONNECTED), eSetValueWithoutOverwrite))
-                    vTaskDelay(pdMS_TO_TICKS(50));
+                LOG_Latency::stampNotify(LOG_LAT_SOURCE::System, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_DISCONNECTED));
+                xTaskNotify(taskHandleSystemRun, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_DISCONNECTED), eSetBits);
 
                 if (autoConnect)
                 {
@@ -1240,8 +1279,8 @@ void Wifi::runEvents()
                     ESP_GOTO_ON_ERROR(esp_wifi_connect(), wifi_eventRun_err, TAG, "esp_wifi_connect() failed"); // Try to reconnect (But don't reset our timeout counts)
                     wifiConnState = WIFI_CONN_STATE::WIFI_CONNECTING_STA;
 
-                    while (!xTaskNotify(taskHandleSystemRun, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_CONNECTING), eSetValueWithoutOverwrite))
-                        vTaskDelay(pdMS_TO_TICKS(50));
+                    LOG_Latency::stampNotify(LOG_LAT_SOURCE::System, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_CONNECTING));
+                    xTaskNotify(taskHandleSystemRun, static_cast<uint32_t>(SYS_NOTIFY::NFY_WIFI_CONNECTING), eSetBits);
                 }
                 break;
             }
@@ -1249,7 +1288,7 @@ void Wifi::runEvents()
             case WIFI_EVENT_AP_START:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_EVENT:WIFI_EVENT_AP_START");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_EVENT:WIFI_EVENT_AP_START");
 
                 break;
             }
@@ -1257,7 +1296,7 @@ void Wifi::runEvents()
             case WIFI_EVENT_AP_STOP:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_EVENT:WIFI_EVENT_AP_STOP");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_EVENT:WIFI_EVENT_AP_STOP");
 
                 break;
             }
@@ -1265,7 +1304,7 @@ void Wifi::runEvents()
             case WIFI_EVENT_AP_STACONNECTED:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_EVENT:WIFI_EVENT_AP_STACONNECTED");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_EVENT:WIFI_EVENT_AP_STACONNECTED");
 
                 break;
             }
@@ -1273,7 +1312,7 @@ void Wifi::runEvents()
             case WIFI_EVENT_AP_STADISCONNECTED:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_EVENT:WIFI_EVENT_AP_STADISCONNECTED");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_EVENT:WIFI_EVENT_AP_STADISCONNECTED");
 
                 break;
             }
@@ -1281,7 +1320,7 @@ void Wifi::runEvents()
             case WIFI_EVENT_STA_BEACON_TIMEOUT:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_EVENT:WIFI_EVENT_STA_BEACON_TIMEOUT, Starting to lose a connection...");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_EVENT:WIFI_EVENT_STA_BEACON_TIMEOUT, Starting to lose a connection...");
 
                 break;
             }
@@ -1289,14 +1328,14 @@ void Wifi::runEvents()
             case WIFI_EVENT_HOME_CHANNEL_CHANGE:
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_EVENT:WIFI_EVENT_HOME_CHANNEL_CHANGE");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_EVENT:WIFI_EVENT_HOME_CHANNEL_CHANGE");
 
                 break;
             }
 
             default:
             {
-                logByValue(ESP_LOG_WARN, semWifiRouteLock, TAG, std::string(__func__) + "(): WIFI_EVENT:<default> event_id = " + std::to_string(evt.event_id));
+                LOG_DEFERRED(ESP_LOG_WARN, semWifiRouteLock, TAG, "WIFI_EVENT:<default> event_id = %d", (int)evt.event_id);
                 break;
             }
             }
@@ -1308,7 +1347,7 @@ void Wifi::runEvents()
             case IP_EVENT_STA_GOT_IP: // ESP32 station got IP from connected AP
             {
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): IP_EVENT:IP_EVENT_STA_GOT_IP:");
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "IP_EVENT:IP_EVENT_STA_GOT_IP:");
 
                 esp_netif_t *netif = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
                 ESP_GOTO_ON_FALSE(netif, ESP_FAIL, wifi_eventRun_err, TAG, "Could not locate the WIFI_STA_DEF netif instance..."); // Effectively, this is an assert without an abort.
@@ -1322,7 +1361,7 @@ void Wifi::runEvents()
                 uint8_t num4 = ((&(ip_info.ip.addr))[3]);
 
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): IP_EVENT:IP_EVENT_STA_GOT_IP: My IP address " + std::to_string(num1) + "." + std::to_string(num2) + "." + std::to_string(num3) + "." + std::to_string(num4));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "IP_EVENT:IP_EVENT_STA_GOT_IP: My IP address %d.%d.%d.%d", (int)num1, (int)num2, (int)num3, (int)num4);
 
                 num1 = ((&(ip_info.gw.addr))[0]);
                 num2 = ((&(ip_info.gw.addr))[1]);
@@ -1330,7 +1369,7 @@ void Wifi::runEvents()
                 num4 = ((&(ip_info.gw.addr))[3]);
 
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): IP_EVENT:IP_EVENT_STA_GOT_IP: My Gateway address " + std::to_string(num1) + "." + std::to_string(num2) + "." + std::to_string(num3) + "." + std::to_string(num4));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "IP_EVENT:IP_EVENT_STA_GOT_IP: My Gateway address %d.%d.%d.%d", (int)num1, (int)num2, (int)num3, (int)num4);
 
                 num1 = ((&(ip_info.netmask.addr))[0]);
                 num2 = ((&(ip_info.netmask.addr))[1]);
@@ -1338,7 +1377,7 @@ void Wifi::runEvents()
                 num4 = ((&(ip_info.netmask.addr))[3]);
 
                 if (show & _showEvents)
-                    logByValue(ESP_LOG_INFO, semWifiRouteLock, TAG, std::string(__func__) + "(): IP_EVENT:IP_EVENT_STA_GOT_IP: My Netmask is " + std::to_string(num1) + "." + std::to_string(num2) + "." + std::to_string(num3) + "." + std::to_string(num4));
+                    LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "IP_EVENT:IP_EVENT_STA_GOT_IP: My Netmask is %d.%d.%d.%d", (int)num1, (int)num2, (int)num3, (int)num4);
 
                 haveIPAddress = true; // This will stop the wifi waiting process.
 
@@ -1347,7 +1386,7 @@ void Wifi::runEvents()
 
             default:
             {
-                logByValue(ESP_LOG_WARN, semWifiRouteLock, TAG, std::string(__func__) + "():IP_EVENT:<default> event_id = " + std::to_string(evt.event_id));
+                LOG_DEFERRED(ESP_LOG_WARN, semWifiRouteLock, TAG, "IP_EVENT:<default> event_id = %ld", (long)evt.event_id);
                 break;
             }
             }
@@ -1359,3 +1398,38 @@ wifi_eventRun_err:
     errMsg = std::string(__func__) + "(): error: " + esp_err_to_name(ret);
     wifiOP = WIFI_OP::Error;
 }
+
+SYS_Async Wifi::connectHost(void)
+{
+    //
+    // From esp_wifi_start() until we have an IP address.  Both events are registered before the radio starts, and each wait ends
+    // in the pass where its event arrives.  If either times out, run() disconnects and the connection is tried again.
+    //
+    esp_err_t ret = ESP_OK;
+
+    SYS_WaitEvent connected = executor.event(WIFI_EVENT, WIFI_EVENT_STA_CONNECTED, pdMS_TO_TICKS(noHostSecsToRestartMax * 1000));
+    SYS_WaitEvent gotIP = executor.event(IP_EVENT, IP_EVENT_STA_GOT_IP, pdMS_TO_TICKS(noIPAddressSecToRestartMax * 1000));
+
+    ret = co_await connected;
+
+    if (ret != ESP_OK)
+    {
+        LOG_DEFERRED(ESP_LOG_WARN, semWifiRouteLock, TAG, "Not Connected to Host after %d secs.  Restarting the connection.", (int)noHostSecsToRestartMax);
+        wifiHostTimeOut = true;
+        co_return ret;
+    }
+
+    if (showWifi & _showWifiConnSteps)
+        LOG_DEFERRED(ESP_LOG_INFO, semWifiRouteLock, TAG, "WIFI_CONN::Wifi_Waiting_For_IP_Address - Step %d", (int)WIFI_CONN::Wifi_Waiting_For_IP_Address);
+
+    wifiConnStep = WIFI_CONN::Wifi_Waiting_For_IP_Address; // Still recorded, so the diagnostics can time the wait for an address
+    ret = co_await gotIP;
+
+    if (ret != ESP_OK)
+    {
+        LOG_DEFERRED(ESP_LOG_WARN, semWifiRouteLock, TAG, "Don't have an IP address after %d secs.  Restarting the connection.", (int)noIPAddressSecToRestartMax);
+        wifiIPAddressTimeOut = true;
+        co_return ret;
+    }
+    co_return ESP_OK;
+}
@@ -1,13 +1,16 @@
 #pragma once
 
-#include "sdkconfig.h"     // Configuration variables
-#include "system_defs.hpp" // Local definitions, structs, and enumerations
+#include "sdkconfig.h"         // Configuration variables
+#include "system_defs.hpp"     // Local definitions, structs, and enumerations
+#include "system_bus.hpp"      // Publish/subscribe between our objects
+#include "system_register.hpp" // Flags and counters shared by the timer and run tasks
 
 #include <stdio.h> // Standard libraries
 #include <inttypes.h>
 #include <stdbool.h>
 #include <sstream>
 #include <memory>
+#include <atomic>
 
 #include "freertos/task.h" // RTOS libraries (remaining files)
 #include "freertos/semphr.h"
@@ -23,6 +26,8 @@
 #include "esp_sntp.h"
 #include "esp_log.h"
 #include "esp_pm.h"
+#include "esp_partition.h"
+#include "esp_heap_caps.h"
 
 #include "nvs/nvs_.hpp" // Our components
 #include "spi/spi_.hpp"
@@ -30,6 +35,145 @@
 #include "i2c/i2c_.hpp"         //
 #include "wifi/wifi_.hpp"       // NOTE: SNTP is completely isolated from the System
 
+#include "logging/logging_.hpp" // Logging and the diagnostics modules beside it
+#include "logging/logging_journal.hpp"
+#include "logging/logging_stream.hpp"
+#include "logging/logging_heap.hpp"
+#include "logging/logging_tasks.hpp"
+#include "logging/logging_latency.hpp"
+#include "logging/logging_telemetry.hpp"
+#include "logging/logging_trace.hpp"
+
+//
+// One append-only record in the errlog flash partition.  Erased flash reads as 0xFF, so the magic word tells us a slot is in use.
+//
+struct SYS_JournalRecord
+{
+    uint32_t magic;
+    uint32_t sequence; // Keeps counting across boots.  The highest valid sequence found at startup is the newest record.
+    uint32_t bootCount;
+    LOG_JournalEntry entry;
+    uint32_t crc;
+};
+
+//
+// CPU load of one task, from the deltas of its FreeRTOS run time counter.  Tasks are matched by task number, which is never
+// reused, so a new task can't inherit the history of a deleted one.
+//
+struct SYS_LoadTask
+{
+    UBaseType_t taskNumber; // Zero marks a free slot
+    char name[configMAX_TASK_NAME_LEN];
+    BaseType_t core; // Affinity.  tskNO_AFFINITY for a task which runs on either core.
+    configRUN_TIME_COUNTER_TYPE lastCounter;
+    uint16_t permille[LOAD_HISTORY]; // Tenths of a percent of one core in each sample
+};
+
+//
+// What the incremental heap checker learned about one heap region on its last completed pass.
+//
+struct SYS_HeapRegion
+{
+    intptr_t start;
+    intptr_t end;
+    uint32_t blocks;
+    uint32_t freeBlocks;
+    uint32_t freeBytes;
+    uint32_t largestFree;
+    uint32_t errors; // Passes on which heap_caps_check_integrity_addr() failed.  Any at all means the heap is corrupt.
+    uint32_t passes;
+};
+
+//
+// The whole heap (8 bit capable memory) plus the per component counts, taken before and after an object lifecycle.  The
+// difference is what the cycle left behind.
+//
+struct SYS_HeapSnapshot
+{
+    uint32_t allocatedBytes;
+    uint32_t allocatedBlocks;
+    uint32_t freeBytes;
+    uint32_t largestFree;
+    uint32_t freeBlocks;
+    LOG_HeapTagStats tags[(int)LOG_HEAP_TAG::Count];
+};
+
+//
+// The timeline of one boot.  The last BOOT_PROFILE_COUNT of these are kept in NVS so a slower startup after a firmware update
+// shows up against the boots before it.
+//
+struct SYS_BootProfile
+{
+    uint32_t bootCount;
+    char version[12];                                // APP_VERSION_MAJOR.MINOR.PATCH of the build which booted
+    uint8_t resetReason;                             // esp_reset_reason_t
+    bool networkUp;                                  // False if we stopped waiting for the network
+    uint32_t markUs[(int)SYS_BOOT_MARK::Count];      // esp_timer_get_time() at each mark.  Zero for a mark never reached.
+    uint32_t stepUs[(int)SYS_INIT::Finished];        // Time spent in each SYS_INIT step
+    uint32_t componentUs[(int)SYS_COMPONENT::Count]; // Time from SYS_INIT::Start_Components until each object was ready
+};
+
+//
+// One object of the initialization graph.  It is created on its own task, pinned to a core, once every object in dependsOn
+// is ready.
+//
+struct SYS_InitNode
+{
+    SYS_COMPONENT component;
+    const char *taskName;
+    uint32_t dependsOn; // SYS_COMPONENT_BIT()s
+    BaseType_t core;
+    LOG_HEAP_TAG heapTag; // Everything the constructor allocates belongs to the object
+};
+
+//
+// Where one run task goes.  The plan is saved to NVS as an array of these, one per SYS_TASK, so keep the layout fixed.
+//
+struct SYS_TaskPlacement
+{
+    int8_t core;        // 0, 1, or TASK_ANY_CORE
+    uint8_t priority;   // Below configMAX_PRIORITIES.  Normally one of the TASK_PRIORITY_ levels.
+    uint8_t stackSizeK; // Zero keeps the size the object restored from NVS (tuned by tuneTaskStacks())
+};
+
+//
+// A health snapshot for SYS_COMMAND::GET_STATS.  The binary form is this struct as it is.  The JSON form is streamed from it
+// into a string whose capacity was reserved up front, so answering a poll never touches the heap.
+//
+struct SYS_StatsTask // One entry of the Logging task registry
+{
+    char name[configMAX_TASK_NAME_LEN];
+    uint32_t stackBytes;
+    uint32_t minFreeBytes;
+    uint32_t beats;
+    uint32_t stalls;
+    uint16_t loadPermille; // LOAD_UNKNOWN until the first load sample
+    uint8_t state;         // _OP state at the last heartbeat
+    bool stalled;
+};
+
+struct SYS_Stats
+{
+    uint16_t version; // SYS_STATS_VERSION
+    uint16_t size;    // sizeof(SYS_Stats)
+    uint32_t uptimeSecs;
+    uint32_t bootCount;
+    uint32_t heapFree; // 8 bit capable memory
+    uint32_t heapMinFree;
+    uint32_t heapLargestFree;
+    uint32_t internalFree;
+    uint32_t spiramFree;
+    uint16_t coreLoad[portNUM_PROCESSORS]; // Tenths of a percent
+    uint8_t queueDepth[SYS_STATS_QUEUES];  // Requests waiting
+    uint8_t wifiConnState;                 // WIFI_CONN_STATE
+    uint16_t rtosTasks;                    // Every task, ours and the IDF's
+    uint32_t nvsUsedEntries;
+    uint32_t nvsFreeEntries;
+    uint32_t nvsNamespaces;
+    uint8_t taskCount; // Entries used in tasks[]
+    SYS_StatsTask tasks[LOG_TASK_SLOTS];
+};
+
 class Logging; // Forward declarations
 class NVS;
 class Display;
@@ -48,14 +192,25 @@ extern "C"
             return &sysInstance;
         }
 
+        static void markAppMain(void); // Called first thing in app_main() by the boot profiler
+
         TaskHandle_t getRunTaskHandle(void);
-        QueueHandle_t getCmdRequestQueue(void);
+        bool sendCmdRequest(SYS_CmdRequest *, TickType_t); // Queues the request and wakes the run loop.  False if the queue stayed full.
+
+        static BaseType_t createTask(SYS_TASK, TaskFunction_t, const char *, uint8_t *, void *, TaskHandle_t *); // xTaskCreatePinnedToCore() as the task plan says
+
+        uint16_t getTaskLoad(const char *, uint8_t samplesBack = 0); // Tenths of a percent of one core, or LOAD_UNKNOWN
+        uint16_t getCoreLoad(uint8_t, uint8_t samplesBack = 0);      //
+        uint16_t getTaskLoadAverage(const char *, uint8_t);          // Over the newest samples.  LOAD_UNKNOWN if none of them is known.
+        uint16_t getCoreLoadAverage(uint8_t, uint8_t);               //
+        uint32_t getLoadSamples(void);                               // Samples taken since boot
 
     private:
         System(esp_reset_reason_t);
         System(const System &) = delete;         // Disable copy constructor
         void operator=(System const &) = delete; // Disable assignment operator
 
+        static constexpr esp_log_level_t logLevelCompiled = SYS_LOG_LEVEL_COMPILED;
         char TAG[6] = "_sys ";
 
         /* Object States */
@@ -63,6 +218,7 @@ extern "C"
 
         /* Object References */
         NVS *nvs = nullptr;
+        Bus *bus = nullptr;
         // Speaker *speak = nullptr;
         Display *disp = nullptr;
         I2C *i2c = nullptr;
@@ -77,7 +233,7 @@ extern "C"
 
         uint8_t show = 0;    // Flags
         uint8_t showSys = 0; //
-        uint8_t diagSys = 0; //
+        SYS_Register<uint8_t> diagSys; //
 
         uint32_t bootCount = 0;
 
@@ -92,11 +248,81 @@ extern "C"
         void createSemaphores(void);
         void createQueues(void);
 
+        /* System_Boot */
+        static int64_t bootAppMainUs;
+        SYS_BootProfile bootProfile = {};                      // This boot
+        SYS_BootProfile bootHistory[BOOT_PROFILE_COUNT] = {}; // Earlier boots from NVS.  Kept here so saving never needs a large stack.
+        SYS_Flag bootProfileFlag;                              // Set on the first connection or by the timer, serviced by run()
+        SYS_Flag bootProfileSaved;                             //
+
+        void bootMark(SYS_BOOT_MARK, int64_t timeUs = esp_timer_get_time());
+        void bootInitFinished(void);
+        bool readBootHistory(void);
+        void saveBootProfile(void);
+        void printBootProfiles(void);
+
         /* System_Diagnostics */
         void runDiagnostics(void);
         void printRunTimeStats(void);
         void printMemoryStats(void);
         void printTaskInfo(void);
+        void printStateTransitions(void);
+        void printTaskLoad(void);
+        void printHeapRegions(void);
+
+        /* System_Heap */
+        SYS_HeapRegion heapRegions[HEAP_CHECK_MAX_REGIONS] = {}; // Results of the last completed pass over each region
+        SYS_HeapRegion heapWork = {};                            // The region being checked now
+        uint8_t heapRegionCount = 0;                             // Regions seen on the last full pass
+        uint8_t heapRegion = 0;                                  // Region being checked now
+        SYS_Flag heapCheckFlag;                                  // Set by the timer every second, serviced by run()
+
+        struct SYS_HeapWalk // State for one call to heap_caps_walk_all()
+        {
+            intptr_t heapStart;
+            uint8_t heapIndex;
+            bool regionVisited;
+        } heapWalk = {};
+
+        void heapCheckStep(void);
+        void heapCheckRegionDone(void);
+        static bool heapCheckWalker(walker_heap_into_t, walker_block_info_t, void *);
+
+        /* System_Load */
+        SYS_LoadTask loadTasks[LOAD_MAX_TASKS] = {};
+        TaskStatus_t loadStatus[LOAD_MAX_TASKS] = {}; // Filled by uxTaskGetSystemState().  Kept here so sampling never uses the heap.
+        uint16_t loadCores[LOAD_HISTORY][portNUM_PROCESSORS] = {};
+        configRUN_TIME_COUNTER_TYPE loadLastTotal = 0;
+        uint32_t loadSamples = 0;  // Samples taken.  (loadSamples - 1) % LOAD_HISTORY is the newest.
+        SYS_Flag loadSampleFlag;
+        portMUX_TYPE loadLock = portMUX_INITIALIZER_UNLOCKED;
+
+        void sampleTaskLoad(void);
+
+        /* System_Init */
+        EventGroupHandle_t initGroup = nullptr; // Ready and failed bits of each SYS_COMPONENT
+        int64_t initStartUs = 0;                //
+
+        bool startComponents(void);
+        bool waitOnComponents(uint32_t *); // True when every object is ready, or when one failed (SYS_COMPONENT_BIT()s of those) and every init task is done
+        TickType_t initTicksLeft(void);    // Until the SYS_INIT deadline
+        static void initTask(void *);
+        void initComponent(const SYS_InitNode *);
+        bool createComponent(SYS_COMPONENT);
+
+        /* System_Journal */
+        const esp_partition_t *journalPartition = nullptr;
+        uint32_t journalSlotCount = 0;                      // Records which fit in the partition
+        uint32_t journalWriteSlot = 0;                      // Next record slot to be written
+        uint32_t journalSequence = 1;                       // Sequence number for the next record
+        SYS_Flag journalFlushFlag;                          // Set by the timer, serviced by run()
+        SYS_JournalRecord journalBuffer[LOG_JOURNAL_SLOTS]; // One batch.  Flushing never touches the heap.
+
+        void openErrorJournal(void);
+        void recoverErrorJournal(esp_reset_reason_t, bool);
+        bool journalFlushDue(void);
+        void flushErrorJournal(void);
+        void printErrorJournal(uint8_t);
 
         /* System_gpio */
         uint8_t gpioStackSizeK = 5;                     // Default minimum size
@@ -119,16 +345,39 @@ extern "C"
         void test_deep_sleep(SYS_TEST_TYPE *, uint8_t *);
         void test_nvs(SYS_TEST_TYPE *, uint8_t *);
         void test_wifi(SYS_TEST_TYPE *, uint8_t *);
+        void test_logging(SYS_TEST_TYPE *, uint8_t *);
+        void test_task_placement(SYS_TEST_TYPE *, uint8_t *);
+
+        bool logBenchUseRing = true;                    // Log producer benchmark
+        SemaphoreHandle_t semLogBenchDone = nullptr;    //
+        std::atomic<uint32_t> logBenchTotalCycles = 0;  //
+        std::atomic<uint32_t> logBenchMaxCycles = 0;    //
+
+        static void logBenchProducer(void *);
+
+        SYS_HeapSnapshot lifecycleBaseline = {};        // Object lifecycle heap test
+        TaskHandle_t taskHandleLifecycleSoak = nullptr; //
+
+        bool lifecycleCreateWifi(void);
+        void lifecycleDestroyWifi(void);
+        void takeHeapSnapshot(SYS_HeapSnapshot *);
+        void printHeapDrift(const char *, const SYS_HeapSnapshot *, const SYS_HeapSnapshot *);
+        static void lifecycleSoakTask(void *);
 
         /* System_NVS */
-        bool saveToNVSFlag = false;
-        uint8_t saveToNVSDelaySecs = 0;
+        SYS_Flag saveToNVSFlag;
+        SYS_Register<uint8_t> saveToNVSDelaySecs; // Counted down by the timer.  saveToNVSFlag is raised when it reaches zero.
+
+        SYS_Flag stackTuneFlag; // Set by the timer once a minute, serviced by run()
 
         void restoreVariablesFromNVS(void);
         void saveVariablesToNVS(void);
+        void tuneTaskStacks(void);
 
         /* System_Run */
         SYS_NOTIFY sysTaskNotifyValue = (SYS_NOTIFY)0;
+        uint32_t sysNotifyBits = 0;                // Everything the last wake delivered: a SYS_NOTIFY code plus any SYS_WAKE_ bits
+        TickType_t runWaitTicks = 0;               // portMAX_DELAY unless work is left over from the last pass
 
         QueueHandle_t systemCmdRequestQue = nullptr; // Command Queue
         SYS_CmdRequest *ptrSYSCmdRequest = nullptr;
@@ -140,7 +389,7 @@ extern "C"
 
         SYS_OP sysOP = SYS_OP::Idle; // State variables
         SYS_OP opSys_Return = SYS_OP::Idle;
-        SYS_INIT sysInitStep = SYS_INIT::Finished;
+        LOG_StateStep<SYS_INIT, LOG_MACHINE::Sys_Init> sysInitStep = SYS_INIT::Finished;
 
         TaskHandle_t taskHandleSPIRun = nullptr;     // RTOS
         TaskHandle_t taskHandleDisplayRun = nullptr; // RTOS
@@ -151,6 +400,25 @@ extern "C"
         static void runMarshaller(void *); // Handles all System activites
         void run(void);                    //
 
+        LOG_HeapAllocStats runHeapAllocs = {}; // Steady state passes of run() should not touch the heap
+
+        /* System_Stats */
+        SYS_Stats stats = {};
+        std::string statsJson = ""; // Capacity reserved in createQueues()
+
+        void takeStats(SYS_Stats *);
+        bool serializeStats(const SYS_Stats *, std::string *);
+
+        /* System_Tasks */
+        static SYS_TaskPlacement taskPlan[(int)SYS_TASK::Count]; // Restored from NVS ("taskPlan")
+        static bool taskPlanFromNVS;                              // False while the built in layout 0 is used
+
+        bool applyTaskPlan(const SYS_TaskPlacement *); // False, and nothing changed, if any row is out of range
+        int8_t getTaskLayout(void);                    // The built in layout the plan matches, or -1
+        esp_err_t saveTaskLayout(uint8_t);             // Takes effect on the next boot
+        void printTaskPlan(void);
+        void benchTaskPlan(void);
+
         /* System_Timer */
         uint8_t rebootTimerSec = 0;
         uint8_t syncEventTimeOut_Counter = 0;
@@ -170,16 +438,14 @@ extern "C"
         void tenSecondActions(void);
         void oneMinuteActions(void);
 
+        bool superviseRunLoops(void); // True while any run loop is stalled
+
         /* Utilities */
         const char *convertWifiStateToChars(uint8_t);
         std::string getDeviceID(void);
 
-        void lockSetBool(bool *, bool);                      // Locking bool variables
-        bool lockGetBool(bool *);                            //
-        uint8_t lockGetUint8(uint8_t *);                     // Locking uint8_t variables
-        void lockOrUint8(uint8_t *, uint8_t);                //
-        void lockAndUint8(uint8_t *variable, uint8_t value); //
-        void lockSetUint8(uint8_t *, uint8_t);               //
-        uint8_t lockDecrementUint8(uint8_t *);               //
+        void setPending(SYS_Flag *);       // Raises a pending action flag and wakes the run loop
+        SYS_NOTIFY takeNotify(uint32_t *); // Removes the next SYS_NOTIFY bit to service from the set.  Repeats of a bit coalesce.
+        void publishConnectivity(void);    // BUS_TOPIC::Connectivity from sysWifiConnState
     };
 }
\ No newline at end of file
@@ -0,0 +1,193 @@
+#pragma once
+
+#include <stdint.h> // Standard libraries
+#include <cstdlib>
+#include <atomic>
+#include <coroutine>
+
+#include "freertos/FreeRTOS.h" // RTOS Libraries
+#include "freertos/task.h"
+#include "freertos/queue.h"
+
+#include "esp_err.h" // ESP libraries
+#include "esp_event.h"
+
+#define SYS_ASYNC_FRAMES 4        // Coroutine frames held in a static pool
+#define SYS_ASYNC_FRAME_BYTES 512 // A larger frame, or one more than the pool holds, comes from the heap
+#define SYS_ASYNC_SLOTS 2         // Coroutines one executor may have waiting at once
+
+//
+// Coroutines for our run tasks.  A connect or disconnect sequence can be written as straight line code which co_awaits each
+// thing it needs, instead of a state which is polled on every pass of the run loop:
+//
+//   SYS_Async Object::connect(void)
+//   {
+//       SYS_WaitEvent gotIP = executor.event(IP_EVENT, IP_EVENT_STA_GOT_IP, pdMS_TO_TICKS(15000)); // Armed here, so it can't be missed
+//       ...
+//       if (co_await gotIP != ESP_OK) // The 15 seconds count from here
+//           co_return ESP_ERR_TIMEOUT;
+//       co_return ESP_OK;
+//   }
+//
+// The executor belongs to the task which runs it, and everything happens on that task.  The run loop hands every notification
+// it takes to resume(), and takes its wait time from waitTicks().  A coroutine is resumed in the pass where its notify bit,
+// queue item, or event arrives, or where its timeout runs out, and runs until its next co_await.
+//
+// Events are delivered by a handler which the awaiter registers with the default event loop.  The handler notifies the owning
+// task with the executor's wake bit, which the run loop must not use for anything else.  A queue wait is only looked at when
+// the task wakes, so whoever sends to the queue must also notify the task.
+//
+// One coroutine does not co_await another.  Frames come from a small static pool so a sequence which runs on every reconnect
+// doesn't fragment the heap.
+//
+class SYS_Executor;
+
+struct SYS_Wait // What a suspended coroutine is waiting for
+{
+    SYS_Wait(SYS_Executor *newExecutor, TickType_t newTimeout) : executor(newExecutor), timeout(newTimeout) {}
+    SYS_Wait(const SYS_Wait &) = delete; // Awaiters stay where they were made.  Handlers hold pointers to them.
+    void operator=(SYS_Wait const &) = delete;
+
+    SYS_Executor *executor = nullptr;
+    uint32_t bits = 0;              // Notify bits which end the wait
+    uint32_t received = 0;          // The bits which did
+    QueueHandle_t queue = nullptr;  // A queue to receive from, into item
+    void *item = nullptr;           //
+    std::atomic<bool> fired{false}; // Set by an event handler
+    TickType_t timeout = portMAX_DELAY;
+    TickType_t deadline = 0;
+    esp_err_t result = ESP_OK;
+
+    bool await_ready(void) const { return false; }
+    void await_suspend(std::coroutine_handle<> handle);
+};
+
+struct SYS_WaitNotify : SYS_Wait
+{
+    SYS_WaitNotify(SYS_Executor *newExecutor, uint32_t newBits, TickType_t newTimeout) : SYS_Wait(newExecutor, newTimeout) { bits = newBits; }
+    uint32_t await_resume(void) const { return received; } // Zero after a timeout
+};
+
+struct SYS_WaitQueue : SYS_Wait
+{
+    SYS_WaitQueue(SYS_Executor *newExecutor, QueueHandle_t newQueue, void *newItem, TickType_t newTimeout) : SYS_Wait(newExecutor, newTimeout)
+    {
+        queue = newQueue;
+        item = newItem;
+    }
+    bool await_ready(void) { return xQueueReceive(queue, item, 0) == pdTRUE; }
+    bool await_resume(void) const { return result == ESP_OK; }
+};
+
+class SYS_WaitEvent : public SYS_Wait
+{
+public:
+    SYS_WaitEvent(SYS_Executor *, esp_event_base_t, int32_t, TickType_t);
+    ~SYS_WaitEvent(); // Unregisters the handler
+
+    bool await_ready(void) // Already fired since it was armed, or never registered (result holds why)
+    {
+        if (instance == nullptr)
+            return true;
+
+        if (!fired.exchange(false))
+            return false;
+
+        result = ESP_OK;
+        return true;
+    }
+
+    esp_err_t await_resume(void) const { return result; } // ESP_OK, or ESP_ERR_TIMEOUT
+
+private:
+    esp_event_base_t base = nullptr;
+    int32_t id = 0;
+    esp_event_handler_instance_t instance = nullptr;
+
+    static void handler(void *, esp_event_base_t, int32_t, void *);
+};
+
+class SYS_Async // The return type of a coroutine.  Its owner keeps it, and destroying it cancels the coroutine.
+{
+public:
+    struct promise_type
+    {
+        esp_err_t result = ESP_ERR_INVALID_STATE; // Until co_return
+
+        SYS_Async get_return_object(void) { return SYS_Async(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        static SYS_Async get_return_object_on_allocation_failure(void) { return SYS_Async(nullptr); }
+
+        std::suspend_always initial_suspend(void) noexcept { return {}; } // The executor starts it
+        std::suspend_always final_suspend(void) noexcept { return {}; }   // The owner reads the result before the frame goes
+        void return_value(esp_err_t value) { result = value; }
+        void unhandled_exception(void) { abort(); } // We build without exceptions
+
+        static void *operator new(size_t) noexcept;
+        static void operator delete(void *, size_t) noexcept;
+    };
+
+    SYS_Async(void) = default;
+    SYS_Async(SYS_Async &&other) noexcept : handle(other.handle), executor(other.executor)
+    {
+        other.handle = nullptr;
+        other.executor = nullptr;
+    }
+    SYS_Async &operator=(SYS_Async &&) noexcept;
+    ~SYS_Async() { cancel(); }
+
+    bool valid(void) const { return (bool)handle; } // False when no frame could be allocated
+    bool running(void) const { return handle && !handle.done(); }
+    bool done(void) const { return handle && handle.done(); }
+    esp_err_t result(void) const { return handle ? handle.promise().result : ESP_ERR_NO_MEM; }
+
+    void cancel(void); // Destroys the frame wherever it is waiting.  Awaiters in it unregister what they registered.
+
+    static uint32_t getHeapFrames(void); // Frames which did not fit the pool
+
+private:
+    explicit SYS_Async(std::coroutine_handle<promise_type> newHandle) : handle(newHandle) {}
+
+    std::coroutine_handle<promise_type> handle = nullptr;
+    SYS_Executor *executor = nullptr;
+
+    friend class SYS_Executor;
+};
+
+class SYS_Executor
+{
+public:
+    explicit SYS_Executor(uint32_t newWakeBit) : wakeBit(newWakeBit) {}
+    SYS_Executor(const SYS_Executor &) = delete;
+    void operator=(SYS_Executor const &) = delete;
+
+    bool start(SYS_Async &task); // Runs the coroutine up to its first co_await.  Call from the owning task.
+    void resume(uint32_t notifyBits);
+    TickType_t waitTicks(TickType_t idleTicks); // How long the run loop may block before a timeout falls due
+    bool busy(void);
+
+    SYS_WaitNotify notified(uint32_t bits, TickType_t timeout = portMAX_DELAY);
+    SYS_WaitQueue received(QueueHandle_t queue, void *item, TickType_t timeout = portMAX_DELAY);
+    SYS_WaitEvent event(esp_event_base_t base, int32_t id, TickType_t timeout = portMAX_DELAY); // Registers now.  The timeout runs from the co_await.
+    SYS_WaitNotify delay(TickType_t ticks) { return notified(0, ticks); }
+
+    uint32_t getWakeBit(void) const { return wakeBit; }
+
+private:
+    struct Slot
+    {
+        std::coroutine_handle<> handle = nullptr;
+        SYS_Wait *wait = nullptr; // nullptr while it runs
+    };
+
+    Slot slots[SYS_ASYNC_SLOTS] = {};
+    TaskHandle_t owner = nullptr;
+    const uint32_t wakeBit;
+
+    void suspend(std::coroutine_handle<>, SYS_Wait *);
+    void forget(std::coroutine_handle<>);
+    bool ready(SYS_Wait *, uint32_t notifyBits, TickType_t now);
+
+    friend struct SYS_Wait;
+    friend class SYS_WaitEvent;
+    friend class SYS_Async;
+};
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <stdint.h> // Standard libraries
+#include <time.h>
+#include <atomic>
+
+#include "freertos/FreeRTOS.h" // RTOS libraries
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+/* Message Bus */
+#define BUS_POOL_SIZE 16      // Messages in flight at once, the retained ones included
+#define BUS_SUBSCRIBERS 8     // Subscriber slots
+#define BUS_SENSOR_VALUES 6   // Values in one BUS_SensorData sample
+#define BUS_TOPIC_BIT(topic) (1UL << (uint8_t)(topic))
+
+enum class BUS_TOPIC : uint8_t
+{
+    Connectivity = 0, // BUS_Connectivity.  Published by the System as Wifi moves through its lifecycle.
+    TimeValid,        // BUS_TimeValid.  Published by Wifi when SNTP has given us the time.
+    SensorData,       // BUS_SensorData.  For the sensor objects.
+    Count,            // Keep this last
+};
+
+struct BUS_Connectivity
+{
+    bool connected;        // Wifi can be used
+    uint8_t wifiConnState; // WIFI_CONN_STATE
+};
+
+struct BUS_TimeValid
+{
+    bool valid;
+    time_t epoch; // Time of day when the message was published
+};
+
+struct BUS_SensorData
+{
+    uint8_t sensor; // Chosen by the publisher
+    uint8_t count;  // Values used
+    int64_t sampledUs;
+    float values[BUS_SENSOR_VALUES];
+};
+
+//
+// One message lives in the pool and is shared by everyone who receives it.  Subscribers get a pointer through their own
+// queue, read the payload of its topic, and hand it back with Bus::release().  Nobody writes to a message once it is
+// published.
+//
+struct BUS_Message
+{
+    BUS_TOPIC topic;
+    std::atomic<uint8_t> refs; // Zero while the message is free in the pool
+    uint32_t sequence;         // Per topic
+    int64_t publishedUs;
+
+    union
+    {
+        BUS_Connectivity connectivity;
+        BUS_TimeValid timeValid;
+        BUS_SensorData sensorData;
+    };
+};
+
+struct BUS_Stats
+{
+    uint32_t published;
+    uint32_t delivered;
+    uint32_t dropped;   // A subscriber queue was full
+    uint32_t exhausted; // acquire() found no free message
+    uint8_t inUse;      // Messages out of the pool right now
+    uint8_t inUseMax;
+    uint8_t subscribers;
+};
+
+extern "C"
+{
+    class Bus
+    {
+    public:
+        static Bus *getInstance() // A single broker for every object
+        {
+            static Bus busInstance;
+            return &busInstance;
+        }
+
+        int8_t subscribe(uint32_t, QueueHandle_t, TaskHandle_t = nullptr, uint32_t = 0); // Topic bits, queue of BUS_Message *, task and notify bit to wake it.  -1 if full.
+        void unsubscribe(int8_t);                                                        // Also releases anything still in the subscriber's queue
+
+        BUS_Message *acquire(BUS_TOPIC); // A free message for the publisher to fill in.  nullptr if the pool is empty.
+        uint8_t publish(BUS_Message *);  // Hands the message to every subscriber of its topic and gives up the publisher's reference
+        void release(BUS_Message *);     // Every subscriber calls this once for each message it receives
+
+        void getStats(BUS_Stats *);
+        void printStats(void);
+
+    private:
+        Bus(void);
+        ~Bus(void) = default;
+        Bus(const Bus &) = delete;
+        Bus &operator=(const Bus &) = delete;
+
+        struct BUS_Subscriber
+        {
+            uint32_t topics; // Zero marks a free slot
+            QueueHandle_t queue;
+            TaskHandle_t task;
+            uint32_t notifyBit;
+        };
+
+        SemaphoreHandle_t semBusLock = nullptr; // Guards the subscribers and the retained messages.  Never held while blocking.
+
+        BUS_Message pool[BUS_POOL_SIZE] = {};
+        BUS_Subscriber subscribers[BUS_SUBSCRIBERS] = {};
+        BUS_Message *retained[(int)BUS_TOPIC::Count] = {}; // The last message of each topic, for late subscribers
+        uint32_t sequences[(int)BUS_TOPIC::Count] = {};
+
+        std::atomic<uint32_t> published{0};
+        std::atomic<uint32_t> delivered{0};
+        std::atomic<uint32_t> dropped{0};
+        std::atomic<uint32_t> exhausted{0};
+        std::atomic<uint8_t> inUse{0};
+        std::atomic<uint8_t> inUseMax{0};
+
+        bool deliver(BUS_Subscriber *, BUS_Message *);
+    };
+}
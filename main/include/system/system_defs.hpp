@@ -12,9 +12,82 @@
 
 #define ESP_INTR_FLAG_DEFAULT 0
 
+/* System Run Loop Wake Reasons */
+#define SYS_NOTIFY_CODE_MASK 0x000000FF // SYS_NOTIFY bits.  The bits above them tell the run loop why else it was woken.
+#define SYS_WAKE_COMMAND 0x00000100     // sendCmdRequest() queued a request
+#define SYS_WAKE_PENDING 0x00000200     // setPending() raised a pending action flag
+#define SYS_NOTIFY_WIFI_MASK 0x0000000F // The four NFY_WIFI_ bits, in the order of the connection lifecycle
+
 /* System Timer contant */
 #define TIMER_PERIOD_10Hz 100000 // 100000 microseconds = .1 second = 10Hz
 
+/* Error Journal */
+#define JOURNAL_PARTITION_NAME "errlog" // See partitions.csv
+#define JOURNAL_PARTITION_SUBTYPE 0x40  // Custom data subtype
+#define JOURNAL_RECORD_MAGIC 0x4A524543
+#define JOURNAL_FLUSH_BATCH 8           // Pending entries which trigger a flush
+#define JOURNAL_FLUSH_MAX_AGE_SECS 60   // Age of the oldest pending entry which triggers a flush
+#define JOURNAL_RECOVER_COUNT 8         // Entries shown after an abnormal reset
+
+/* Incremental Heap Check */
+#define HEAP_CHECK_MAX_REGIONS 16    // Heap regions we keep statistics for
+#define HEAP_CHECK_FRAG_WARN 80      // Fragmentation (percent of free memory not in the largest free block) worth a warning
+
+/* Run Loop Supervisor */
+#ifndef LIVENESS_TASK_WDT
+#define LIVENESS_TASK_WDT 0 // 1: The timer task joins the task watchdog and stops feeding it while any run loop is stalled
+#endif
+
+/* CPU Load Sampler */
+#define LOAD_MAX_TASKS 32     // Tasks we can follow at once
+#define LOAD_HISTORY 12       // Samples kept for each task.  At one sample every five seconds, this is one minute.
+#define LOAD_UNKNOWN UINT16_MAX
+
+/* Network Log Stream */
+#ifndef LOG_STREAM_COLLECTOR_IP
+#define LOG_STREAM_COLLECTOR_IP "" // IPv4 address of a host running tools/log_collector.py.  Empty leaves the stream off.
+#endif
+#define LOG_STREAM_COLLECTOR_PORT 5140
+
+/* Object Lifecycle Heap Test */
+#define LIFECYCLE_SETTLE_MS 2000          // Time after a delete for deleted tasks to be cleaned up by the idle task
+#define LIFECYCLE_SOAK_CYCLES 500         // Create/destroy cycles in one soak run
+#define LIFECYCLE_SOAK_REPORT 10          // Cycles between "#S" drift lines (see tools/heap_drift.py)
+#define LIFECYCLE_CREATE_TIMEOUT_MS 5000  // Wait for a new Wifi object to finish initializing
+#define LIFECYCLE_SOAK_MAX_FAILED 10      // Skipped cycles which end a soak early
+
+/* Stats Snapshot (SYS_COMMAND::GET_STATS) */
+#define SYS_STATS_VERSION 1      // Changes with every change to the layout of SYS_Stats
+#define SYS_STATS_QUEUES 5       // Command queues of System, Wifi, Display, I2C and SPI, in that order
+#define SYS_STATS_JSON_SIZE 3072 // Capacity reserved for the JSON form.  A snapshot which doesn't fit returns SYS_STATUS::ERROR.
+
+/* Initialization Graph */
+#define SYS_INIT_PARALLEL 1              // 0: Each object waits for the one before it in SYS_COMPONENT order, as before the graph
+#define SYS_INIT_TIMEOUT_MS 10000        // An object not ready by now fails SYS_INIT
+#define SYS_INIT_STACK_SIZE_K 4          // Each object is created on a short lived task of its own
+#define SYS_INIT_FAILED_SHIFT 8          // Event group bits: SYS_COMPONENT_BIT() when ready, shifted up by this when it failed
+#define SYS_INIT_DONE_SHIFT 16           // ... and shifted up by this when its init task has finished, ready or not
+#define SYS_COMPONENT_BIT(component) (1UL << (uint8_t)(component))
+#define SYS_COMPONENT_ALL ((1UL << (uint8_t)SYS_COMPONENT::Count) - 1)
+
+/* Task Placement */
+#define TASK_ANY_CORE -1        // A task plan core for a task which may run on either core (tskNO_AFFINITY)
+#define TASK_PLAN_LAYOUTS 3     // Built in layouts which the placement benchmark can switch between
+#define TASK_BENCH_SECS 10      // Time the placement benchmark watches one layout
+
+/* Boot Profiler */
+#define BOOT_PROFILE_COUNT 8              // Boots kept in NVS, newest first
+#define BOOT_PROFILE_NETWORK_WAIT_SECS 60 // A boot with no network by now is saved without a Network_Up time
+
+/* Logging Benchmark */
+#define LOG_BENCH_TASKS 6     // Number of tasks logging at the same time (spread over both cores)
+#define LOG_BENCH_MESSAGES 20 // Messages logged by each task
+
+/* Compile Time Log Level */
+#ifndef SYS_LOG_LEVEL_COMPILED
+#define SYS_LOG_LEVEL_COMPILED ESP_LOG_INFO // Log sites above this level are left out of the build
+#endif
+
 /* GPIO Definitions */
 #define SW1 GPIO_NUM_0 // Boot Switch -- GPIO_EN.  This a strapping pin is pulled-up by default
 
@@ -37,3 +110,7 @@
 #define _printRunTimeStats 0x02
 #define _printMemoryStats 0x04
 #define _printTaskInfo 0x08
+#define _printLogSuppression 0x10
+#define _printStateTransitions 0x20
+#define _printTaskLoad 0x40 // With the latency histograms
+#define _printHeapRegions 0x80
@@ -7,23 +7,27 @@
 #include "freertos/FreeRTOS.h" // RTOS Libraries
 #include "freertos/queue.h"
 
+#include "logging/logging_latency.hpp" // LOG_LatencyStamp
+
 //
 // Run Notifications and Commands
 //
 // Task Notifications should be used for notifications or commands which need no input and return no data.
-enum class SYS_NOTIFY : uint8_t // Task Notification definitions for the Run loop
+enum class SYS_NOTIFY : uint8_t // Task Notification bits for the Run loop (sent with eSetBits)
 {
-    NFY_WIFI_CONNECTING = 1, // We have started the process to connect
-    NFY_WIFI_CONNECTED,      // Wifi can be used
-    NFY_WIFI_DISCONNECTING,  // Stop using Wifi
-    NFY_WIFI_DISCONNECTED,   // Wifi is availiable to be connected again
-    CMD_DESTROY_WIFI,        // Receives a request to destroy Wifi
+    NFY_WIFI_CONNECTING = 0x01,    // We have started the process to connect
+    NFY_WIFI_CONNECTED = 0x02,     // Wifi can be used
+    NFY_WIFI_DISCONNECTING = 0x04, // Stop using Wifi
+    NFY_WIFI_DISCONNECTED = 0x08,  // Wifi is availiable to be connected again
+    CMD_DESTROY_WIFI = 0x10,       // Receives a request to destroy Wifi
 };
 
 // Queue based commands should be used for commands which may provide input and perhaps return data.
 enum class SYS_COMMAND : uint8_t
 {
     NONE = 0,
+    SET_SHOW_FLAGS, // data64bit: byte 0 = show, byte 1 = showSys.  Only log sites built under SYS_LOG_LEVEL_COMPILED can be shown.
+    GET_STATS,      // data64bit: 0 = binary SYS_Stats only, 1 = JSON as well.  Both stay valid until the next GET_STATS.
 };
 
 //
@@ -42,12 +46,16 @@ struct SYS_CmdRequest
     SYS_COMMAND requestedCmd;
     std::string *stringData = nullptr;
     int64_t data64bit = 0;
+    LOG_LatencyStamp stamp; // Set by LOG_Latency::stampEnqueue() just before sending
 };
 
+struct SYS_Stats; // system_.hpp
+
 struct SYS_Response
 {
     SYS_STATUS responseCode;
     std::string *jsonResponse = nullptr;
+    const SYS_Stats *stats = nullptr; // GET_STATS
 };
 
 //
@@ -87,21 +95,56 @@ enum class SYS_INIT : uint8_t
     // Wait_On_Touch,
     // Create_IMU,
     // Wait_On_IMU,
-    Create_I2C,  // The System diagram clearly shows that we must enable/active our Touch and IMU before
-    Wait_On_I2C, // attaching those devices to the I2C bus.
-
-    Create_SPI,
-    Wait_On_SPI,
-    Create_Display,
-    Wait_On_Display,
-
-    Create_Wifi,
-    Wait_On_Wifi,
+    Start_Components,   // Every object of the initialization graph is created as soon as the ones it depends on are ready
+    Wait_On_Components, // (system_init.cpp).  Both cores share the work.
     Start_System_Timer,
     Finished,
     Error,
 };
 
+//
+// The objects the System creates during SYS_INIT, in the order they were created before the initialization graph.  The graph
+// itself is in system_init.cpp.
+//
+enum class SYS_COMPONENT : uint8_t
+{
+    I2C = 0,
+    SPI,
+    Display,
+    Wifi,
+    Count, // Keep this last
+};
+
+//
+// Every run task of our objects has a row in the task plan (system_tasks.cpp), which says which core it runs on, at what
+// priority, and with how much stack.
+//
+enum class SYS_TASK : uint8_t
+{
+    System_Run = 0, // sys_run
+    System_Timer,   // sys_tmr
+    System_GPIO,    // sys_gpio
+    I2C_Run,        // I2C::Run
+    SPI_Run,        // SPI::Run
+    Display_Run,    // disp_run
+    Wifi_Run,       // wifi_run.  SNTP runs on this task too.
+    Prov_Run,       // prov_run
+    Count,          // Keep this last
+};
+
+//
+// Points on the way from reset to a working network, kept for each boot by the boot profiler (system_boot.cpp).
+//
+enum class SYS_BOOT_MARK : uint8_t
+{
+    App_Main,         // app_main() entered.  The time before this is spent in the bootloaders and the IDF startup code.
+    NVS_Restored,     // The System constructor restored its variables
+    Run_Task_Started, // The System run task began the SYS_INIT steps
+    First_Run,        // SYS_OP::Run entered for the first time
+    Network_Up,       // First NFY_WIFI_CONNECTED
+    Count,            // Keep this last
+};
+
 //
 // Logging
 //
@@ -125,4 +168,6 @@ enum class SYS_TEST_TYPE : uint8_t
     DEEP_SLEEP,
     NVS,
     WIFI,
+    LOGGING,
+    TASK_PLACEMENT,
 };
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdint.h> // Standard libraries
+#include <atomic>
+
+//
+// A flag, bit set, or small counter which the System's tasks share.  The timer task raises pending actions and counts down
+// delays, and the run task services them.  Every operation is a single atomic instruction, or a short compare-and-swap loop,
+// so neither side ever blocks or calls into the kernel.
+//
+// The value is held in 32 bits whatever T is.  The Xtensa cores have a native 32 bit compare-and-swap (S32C1I).  Narrower
+// atomics would be emulated.
+//
+template <typename T>
+class SYS_Register
+{
+public:
+    T get(void) const { return (T)value.load(std::memory_order_acquire); }
+    void set(T newValue) { value.store((uint32_t)newValue, std::memory_order_release); }
+    T take(void) { return (T)value.exchange(0, std::memory_order_acq_rel); } // Reads and clears in one step, so a raise is never lost
+
+    void setBits(T bits) { value.fetch_or((uint32_t)bits, std::memory_order_acq_rel); }
+    void clearBits(T bits) { value.fetch_and(~(uint32_t)bits, std::memory_order_acq_rel); }
+
+    T decrement(void) // Stops at zero.  Returns the new value.
+    {
+        uint32_t current = value.load(std::memory_order_relaxed);
+
+        while ((current > 0) && !value.compare_exchange_weak(current, current - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+            ;
+        return (T)((current > 0) ? current - 1 : 0);
+    }
+
+private:
+    std::atomic<uint32_t> value{0};
+};
+
+using SYS_Flag = SYS_Register<bool>;
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <stdint.h> // Standard libraries
+#include <atomic>
+
+//
+// A fixed set of command requests which an object lends to its callers, so several requests can be in flight at once and each
+// one keeps its own data (and its own response, when the request type has one).  claim() hands out a free slot, cleared, with a
+// new correlationId.  It never blocks and never allocates.  The slot stays with the request until release():
+//
+//   - For a command with no response, the receiver releases the slot once it has serviced it.
+//   - For a command with a response, the caller releases it after reading the response.
+//
+// T must have a uint32_t correlationId.  release() ignores a pointer which is not one of our slots, so a caller may still
+// send a request it owns itself.
+//
+template <typename T, uint8_t SLOTS>
+class SYS_Slab
+{
+public:
+    T *claim(void) // nullptr when all SLOTS are in flight
+    {
+        bool expected = false;
+
+        for (uint8_t i = 0; i < SLOTS; i++)
+        {
+            expected = false;
+            if (used[i].compare_exchange_strong(expected, true, std::memory_order_acquire))
+            {
+                slots[i] = {};
+                slots[i].correlationId = nextId.fetch_add(1, std::memory_order_relaxed);
+                return &slots[i];
+            }
+        }
+
+        exhausted.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    void release(T *slot)
+    {
+        if ((slot >= &slots[0]) && (slot < &slots[SLOTS]))
+            used[slot - &slots[0]].store(false, std::memory_order_release);
+    }
+
+    uint8_t inUse(void)
+    {
+        uint8_t count = 0;
+        for (uint8_t i = 0; i < SLOTS; i++)
+            count += used[i].load(std::memory_order_relaxed);
+        return count;
+    }
+
+    uint32_t getExhausted(void) { return exhausted.load(std::memory_order_relaxed); } // Claims which found no free slot
+
+private:
+    T slots[SLOTS] = {};
+    std::atomic<bool> used[SLOTS] = {};
+    std::atomic<uint32_t> nextId{1}; // Counts up from one for the life of the object
+    std::atomic<uint32_t> exhausted{0};
+};
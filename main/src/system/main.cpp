@@ -5,6 +5,8 @@
 
 extern "C" void app_main(void)
 {
+    System::markAppMain(); // Start of the boot profile.  Keep this first.
+
     // Upon startup, there is always a reset reason.  With a cold boot or the reset button, the startup reason is ESP_RST_POWERON.
     // When we are waking up fron Deep Sleep, the startup reason is ESP_RST_DEEPSLEEP.  We pass in that value so
     // the System to wake up in the correct way according to the startup reason.
@@ -6,8 +6,6 @@ SemaphoreHandle_t semSysRouteLock = NULL;
 
 /* External Semaphores */
 extern SemaphoreHandle_t semNVSEntry;
-extern SemaphoreHandle_t semSysBoolLock;
-extern SemaphoreHandle_t semSysUint8Lock;
 
 /* Construction / Destruction */
 System::System(esp_reset_reason_t resetReason)
@@ -15,6 +13,10 @@ System::System(esp_reset_reason_t resetReason)
     ESP_LOGW(TAG, "Startup...");
     ESP_LOGW(TAG, "Firmware Ver: %d.%d.%d", APP_VERSION_MAJOR, APP_VERSION_MINOR, APP_VERSION_PATCH);
 
+    bus = Bus::getInstance(); // Before any object which subscribes or publishes is created
+    startLogDrainer(TASK_PRIORITY_LOW); // From here on, logByValue() hands records to the log rings instead of the console.
+    // setLogBinaryOutput(true);        // LOG_DEFERRED() records go out as raw "#LB" lines.  Decode them with tools/log_decoder.py
+
     resetHandling(resetReason); // Perform any unique action based on how the system (re)started.
     setFlags();                 // Static enabling of logging statements for any area of concern during development.
     setLogLevels();             // Manually sets log levels for tasks down the call stack for development.
@@ -22,13 +24,18 @@ System::System(esp_reset_reason_t resetReason)
     createQueues();             // Create RTOS Commend Request resources.
     restoreVariablesFromNVS();  // Brings back all our persistant data.
 
+    bootMark(SYS_BOOT_MARK::App_Main, bootAppMainUs);
+    bootMark(SYS_BOOT_MARK::NVS_Restored);
+    bootProfile.resetReason = (uint8_t)resetReason;
+
     // NOTE: Don't 'take' our own semSysEntry semaphore here, as new objects are calling back to the System for handles throughout initialization.
 
     sysInitStep = SYS_INIT::Start; // Allow the object to initialize when the task becoming operational
     sysOP = SYS_OP::Init;
 
-    logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): runStackSizek: " + std::to_string(runStackSizeK));
-    xTaskCreate(runMarshaller, "sys_run", 1024 * runStackSizeK, this, TASK_PRIORITY_MID, &taskHandleSystemRun);
+    LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): runStackSizek: " + std::to_string(runStackSizeK));
+    createTask(SYS_TASK::System_Run, runMarshaller, "sys_run", &runStackSizeK, this, &taskHandleSystemRun);
+    LOG_Tasks::registerTask(taskHandleSystemRun, 1024 * runStackSizeK, &runStackSizeK, "system"); // Stack use is tuned from here on
 }
 
 void System::resetHandling(esp_reset_reason_t reason)
@@ -39,11 +46,11 @@ void System::resetHandling(esp_reset_reason_t reason)
     //
     // Other restart reasons that we don't catch yet are:
     // ESP_RST_SW        - This may be completely normal.
-    // ESP_RST_PANIC     - We may want to log this as an error.
-    // ESP_RST_INT_WDT   - We may want to log this as an error.
-    // ESP_RST_TASK_WDT  - We may want to log this as an error.
-    // ESP_RST_WDT       - We may want to log this as an error.
-    // ESP_RST_BROWNOUT  - We may want to log this as an error.
+    //
+    // After a panic, a watchdog, or a brownout, we recover the last entries of the error journal so we can see what led up to it.
+    //
+    bool journalSurvived = LOG_ErrorJournal::initErrorJournal(); // RTC memory is kept through everything except a power on.
+    openErrorJournal();
 
     switch (reason)
     {
@@ -59,6 +66,17 @@ void System::resetHandling(esp_reset_reason_t reason)
         break;
     }
 
+    case ESP_RST_PANIC:
+    case ESP_RST_INT_WDT:
+    case ESP_RST_TASK_WDT:
+    case ESP_RST_WDT:
+    case ESP_RST_BROWNOUT:
+    {
+        ESP_LOGE(TAG, "Abnormal reset number %d", (int)reason);
+        recoverErrorJournal(reason, journalSurvived);
+        break;
+    }
+
     default:
     {
         ESP_LOGW(TAG, "Unhandled Reset number %d", (int)reason); // Ok to read there reset reason again...it remains valid.
@@ -85,8 +103,8 @@ void System::setFlags()
     // showSys |= _showSysTimerSeconds;
     // showSys |= _showSysTimerMinutes;
 
-    diagSys = 0;               // We may be running diagnostics from time to time.
-    diagSys |= _diagHeapCheck; // This diag test should run during all development work.
+    diagSys.set(0);                  // We may be running diagnostics from time to time.
+    diagSys.setBits(_diagHeapCheck); // One full check at startup.  After that, the incremental checker (system_heap.cpp) runs all the time.
 }
 
 void System::setLogLevels()
@@ -106,14 +124,6 @@ void System::createSemaphores()
     semSysRouteLock = xSemaphoreCreateBinary(); // Route locking
     if (semSysRouteLock != NULL)
         xSemaphoreGive(semSysRouteLock);
-
-    semSysBoolLock = xSemaphoreCreateBinary(); // Flag locking
-    if (semSysBoolLock != NULL)
-        xSemaphoreGive(semSysBoolLock);
-
-    semSysUint8Lock = xSemaphoreCreateBinary(); // Boolean locking
-    if (semSysUint8Lock != NULL)
-        xSemaphoreGive(semSysUint8Lock);
 }
 
 void System::createQueues()
@@ -129,6 +139,8 @@ void System::createQueues()
         ptrSYSResponse = new SYS_Response(); // --> Outgoing responses
         ptrSYSResponse->jsonResponse = nullptr;
     }
+
+    statsJson.reserve(SYS_STATS_JSON_SIZE); // GET_STATS never grows it
 }
 
 /* Public Member Functions */
@@ -137,7 +149,15 @@ TaskHandle_t System::getRunTaskHandle(void)
     return taskHandleSystemRun;
 }
 
-QueueHandle_t System::getCmdRequestQueue(void) // Other subsystems need access to the Cmd Request Queue
+bool System::sendCmdRequest(SYS_CmdRequest *request, TickType_t ticksToWait)
 {
-    return systemCmdRequestQue;
+    // The run loop sleeps until it is woken, so a request put straight into the queue would wait for some unrelated wake.
+    LOG_Latency::stampEnqueue(&request->stamp);
+
+    if (!xQueueSendToBack(systemCmdRequestQue, &request, ticksToWait))
+        return false;
+
+    if (taskHandleSystemRun != nullptr)
+        xTaskNotify(taskHandleSystemRun, SYS_WAKE_COMMAND, eSetBits); // Never fails, and never disturbs a SYS_NOTIFY code
+    return true;
 }
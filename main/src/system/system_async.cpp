@@ -0,0 +1,235 @@
+#include "system_async.hpp"
+
+#include <cstddef>
+#include <new>
+
+/* Coroutine Frames */
+struct alignas(std::max_align_t) SYS_AsyncFrame
+{
+    uint8_t bytes[SYS_ASYNC_FRAME_BYTES];
+};
+
+static SYS_AsyncFrame framePool[SYS_ASYNC_FRAMES];
+static std::atomic<bool> frameUsed[SYS_ASYNC_FRAMES] = {};
+static std::atomic<uint32_t> heapFrames{0};
+
+void *SYS_Async::promise_type::operator new(size_t size) noexcept
+{
+    bool expected = false;
+    void *frame = nullptr;
+
+    if (size <= SYS_ASYNC_FRAME_BYTES)
+    {
+        for (uint8_t i = 0; i < SYS_ASYNC_FRAMES; i++)
+        {
+            expected = false;
+            if (frameUsed[i].compare_exchange_strong(expected, true, std::memory_order_acquire))
+                return &framePool[i];
+        }
+    }
+
+    frame = ::operator new(size, std::nothrow); // nullptr gives get_return_object_on_allocation_failure()
+
+    if (frame != nullptr)
+        heapFrames.fetch_add(1, std::memory_order_relaxed);
+    return frame;
+}
+
+void SYS_Async::promise_type::operator delete(void *frame, size_t size) noexcept
+{
+    if ((frame >= (void *)&framePool[0]) && (frame < (void *)&framePool[SYS_ASYNC_FRAMES]))
+        frameUsed[(SYS_AsyncFrame *)frame - &framePool[0]].store(false, std::memory_order_release);
+    else
+        ::operator delete(frame);
+}
+
+uint32_t SYS_Async::getHeapFrames(void) { return heapFrames.load(std::memory_order_relaxed); }
+
+/* SYS_Async */
+SYS_Async &SYS_Async::operator=(SYS_Async &&other) noexcept
+{
+    if (this != &other)
+    {
+        cancel();
+        handle = other.handle;
+        executor = other.executor;
+        other.handle = nullptr;
+        other.executor = nullptr;
+    }
+    return *this;
+}
+
+void SYS_Async::cancel(void)
+{
+    if (!handle)
+        return;
+
+    if (executor != nullptr)
+        executor->forget(handle);
+
+    handle.destroy();
+    handle = nullptr;
+    executor = nullptr;
+}
+
+/* SYS_Executor */
+bool SYS_Executor::start(SYS_Async &task)
+{
+    uint8_t i = 0;
+
+    if (!task.handle || task.handle.done() || (task.executor != nullptr))
+        return false;
+
+    for (i = 0; i < SYS_ASYNC_SLOTS; i++)
+    {
+        if (!slots[i].handle)
+            break;
+    }
+
+    if (i == SYS_ASYNC_SLOTS)
+        return false;
+
+    owner = xTaskGetCurrentTaskHandle();
+    task.executor = this;
+    slots[i].handle = task.handle;
+    slots[i].wait = nullptr;
+
+    task.handle.resume(); // Runs until its first co_await, which calls suspend()
+
+    if (task.handle.done())
+        slots[i].handle = nullptr;
+    return true;
+}
+
+void SYS_Executor::resume(uint32_t notifyBits)
+{
+    TickType_t now = xTaskGetTickCount();
+
+    for (uint8_t i = 0; i < SYS_ASYNC_SLOTS; i++)
+    {
+        if (!slots[i].handle || (slots[i].wait == nullptr) || !ready(slots[i].wait, notifyBits, now))
+            continue;
+
+        slots[i].wait = nullptr;
+        slots[i].handle.resume();
+
+        if (slots[i].handle && slots[i].handle.done()) // Finished.  The owner keeps the frame until it has read the result.
+            slots[i].handle = nullptr;
+    }
+}
+
+TickType_t SYS_Executor::waitTicks(TickType_t idleTicks)
+{
+    TickType_t now = xTaskGetTickCount();
+    TickType_t ticks = idleTicks;
+
+    for (uint8_t i = 0; i < SYS_ASYNC_SLOTS; i++)
+    {
+        if (!slots[i].handle || (slots[i].wait == nullptr) || (slots[i].wait->timeout == portMAX_DELAY))
+            continue;
+
+        if ((int32_t)(slots[i].wait->deadline - now) <= 0)
+            return 0;
+
+        if ((slots[i].wait->deadline - now) < ticks)
+            ticks = slots[i].wait->deadline - now;
+    }
+    return ticks;
+}
+
+bool SYS_Executor::busy(void)
+{
+    for (uint8_t i = 0; i < SYS_ASYNC_SLOTS; i++)
+    {
+        if (slots[i].handle)
+            return true;
+    }
+    return false;
+}
+
+SYS_WaitNotify SYS_Executor::notified(uint32_t bits, TickType_t timeout) { return SYS_WaitNotify(this, bits, timeout); }
+
+SYS_WaitQueue SYS_Executor::received(QueueHandle_t queue, void *item, TickType_t timeout) { return SYS_WaitQueue(this, queue, item, timeout); }
+
+SYS_WaitEvent SYS_Executor::event(esp_event_base_t base, int32_t id, TickType_t timeout) { return SYS_WaitEvent(this, base, id, timeout); }
+
+void SYS_Executor::suspend(std::coroutine_handle<> handle, SYS_Wait *wait)
+{
+    wait->result = ESP_OK;
+    wait->received = 0;
+
+    if (wait->timeout != portMAX_DELAY)
+        wait->deadline = xTaskGetTickCount() + wait->timeout;
+
+    for (uint8_t i = 0; i < SYS_ASYNC_SLOTS; i++)
+    {
+        if (slots[i].handle == handle)
+        {
+            slots[i].wait = wait;
+            return;
+        }
+    }
+}
+
+void SYS_Executor::forget(std::coroutine_handle<> handle)
+{
+    for (uint8_t i = 0; i < SYS_ASYNC_SLOTS; i++)
+    {
+        if (slots[i].handle == handle)
+            slots[i] = {};
+    }
+}
+
+bool SYS_Executor::ready(SYS_Wait *wait, uint32_t notifyBits, TickType_t now)
+{
+    if (wait->bits & notifyBits)
+    {
+        wait->received = wait->bits & notifyBits;
+        return true;
+    }
+
+    if ((wait->queue != nullptr) && (xQueueReceive(wait->queue, wait->item, 0) == pdTRUE))
+        return true;
+
+    if (wait->fired.exchange(false))
+        return true;
+
+    if ((wait->timeout != portMAX_DELAY) && ((int32_t)(now - wait->deadline) >= 0))
+    {
+        wait->result = ESP_ERR_TIMEOUT;
+        return true;
+    }
+    return false;
+}
+
+/* Awaiters */
+void SYS_Wait::await_suspend(std::coroutine_handle<> handle) { executor->suspend(handle, this); }
+
+SYS_WaitEvent::SYS_WaitEvent(SYS_Executor *newExecutor, esp_event_base_t newBase, int32_t newId, TickType_t newTimeout)
+    : SYS_Wait(newExecutor, newTimeout), base(newBase), id(newId)
+{
+    result = esp_event_handler_instance_register(base, id, &handler, this, &instance);
+
+    if (result != ESP_OK)
+        instance = nullptr;
+}
+
+SYS_WaitEvent::~SYS_WaitEvent()
+{
+    //
+    // The event loop holds its lock while it calls handlers, and unregistering takes the same lock.  Once this returns, our
+    // handler is not running and won't be called again, so the frame holding us can go.
+    //
+    if (instance != nullptr)
+        esp_event_handler_instance_unregister(base, id, instance);
+}
+
+void SYS_WaitEvent::handler(void *arg, esp_event_base_t base, int32_t id, void *data)
+{
+    SYS_WaitEvent *wait = (SYS_WaitEvent *)arg; // Runs on the event loop task
+
+    wait->fired.store(true);
+
+    if (wait->executor->owner != nullptr)
+        xTaskNotify(wait->executor->owner, wait->executor->wakeBit, eSetBits);
+}
@@ -0,0 +1,199 @@
+#include "system_.hpp"
+
+#include "esp_check.h"
+
+/* External Semaphores */
+extern SemaphoreHandle_t semSysRouteLock;
+extern SemaphoreHandle_t semNVSEntry;
+
+//
+// The boot profiler records how long we take to get from reset to a working network, and where that time goes.  Marks are
+// stamped at fixed points (SYS_BOOT_MARK).  The time spent in each SYS_INIT step is not stamped separately.  When the steps
+// are finished, we add it up from the Sys_Init transitions which LOG_StateStep<> already records.
+//
+// Once the network is up, or once we give up waiting for it, the profile goes into the "system" namespace next to the ones
+// of the boots before.  printBootProfiles() compares them, with an average for each firmware version.
+//
+int64_t System::bootAppMainUs = 0;
+
+void System::markAppMain(void)
+{
+    bootAppMainUs = esp_timer_get_time(); // The System object doesn't exist yet.  The constructor picks this up.
+}
+
+void System::bootMark(SYS_BOOT_MARK mark, int64_t timeUs)
+{
+    if (bootProfile.markUs[(int)mark] == 0) // Only the first time counts
+        bootProfile.markUs[(int)mark] = (uint32_t)timeUs;
+}
+
+void System::bootInitFinished(void)
+{
+    LOG_Transition transition = {};
+    LOG_Transition last = {};
+    bool haveLast = false;
+    uint32_t head = LOG_Telemetry::getTransitionHead();
+
+    //
+    // A stay in a step runs from the transition into it until the next one.  If the transition ring wrapped during startup,
+    // the oldest steps are gone and stay at zero.
+    //
+    for (uint32_t position = (head > LOG_TRANSITION_SLOTS) ? (head - LOG_TRANSITION_SLOTS) : 0; position < head; position++)
+    {
+        if (!LOG_Telemetry::getTransition(position, &transition) || (transition.machine != LOG_MACHINE::Sys_Init))
+            continue;
+
+        if (haveLast && (last.to < (uint8_t)SYS_INIT::Finished))
+            bootProfile.stepUs[last.to] += (uint32_t)(transition.timeUs - last.timeUs);
+
+        last = transition;
+        haveLast = true;
+    }
+
+    bootMark(SYS_BOOT_MARK::First_Run);
+}
+
+bool System::readBootHistory(void)
+{
+    // The caller holds semNVSEntry and has the "system" namespace open
+    size_t length = sizeof(bootHistory);
+    esp_err_t ret = nvs->readBlobFromNVS("bootProfiles", bootHistory, &length);
+
+    if ((ret != ESP_OK) || (length != sizeof(bootHistory))) // Nothing saved yet, or saved by a build with a different SYS_BootProfile
+    {
+        memset(bootHistory, 0, sizeof(bootHistory));
+        return false;
+    }
+    return true;
+}
+
+void System::saveBootProfile(void)
+{
+    esp_err_t ret = ESP_OK;
+
+    bootProfileSaved.set(true); // Whatever happens, once per boot
+
+    bootProfile.bootCount = bootCount;
+    bootProfile.networkUp = (bootProfile.markUs[(int)SYS_BOOT_MARK::Network_Up] != 0);
+    snprintf(bootProfile.version, sizeof(bootProfile.version), "%d.%d.%d%s", APP_VERSION_MAJOR, APP_VERSION_MINOR, APP_VERSION_PATCH,
+             SYS_INIT_PARALLEL ? "" : "-ser"); // A serial SYS_INIT build averages apart from the parallel one
+
+    if (nvs == nullptr)
+        nvs = NVS::getInstance();
+
+    if (xSemaphoreTake(semNVSEntry, portMAX_DELAY))
+    {
+        ESP_GOTO_ON_ERROR(nvs->openNVSStorage("system"), sys_saveBootProfile_err, TAG, "nvs->openNVSStorage('system') failed");
+
+        readBootHistory();
+        memmove(&bootHistory[1], &bootHistory[0], sizeof(SYS_BootProfile) * (BOOT_PROFILE_COUNT - 1)); // Newest first
+        bootHistory[0] = bootProfile;
+        ret = nvs->writeBlobToNVS("bootProfiles", bootHistory, sizeof(bootHistory));
+
+        nvs->closeNVStorage();
+        xSemaphoreGive(semNVSEntry);
+    }
+
+    if (ret != ESP_OK)
+        LOG_PRINTF(ESP_LOG_ERROR, semSysRouteLock, TAG, "Unable to save the boot profile.  Error = %s", esp_err_to_name(ret));
+
+    LOG_PRINTF(ESP_LOG_WARN, semSysRouteLock, TAG, "Boot %ld (%s): app_main %ld ms  first run %ld ms  network %ld ms", bootProfile.bootCount, bootProfile.version,
+               bootProfile.markUs[(int)SYS_BOOT_MARK::App_Main] / 1000, bootProfile.markUs[(int)SYS_BOOT_MARK::First_Run] / 1000,
+               bootProfile.markUs[(int)SYS_BOOT_MARK::Network_Up] / 1000);
+    return;
+
+sys_saveBootProfile_err:
+    LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
+    xSemaphoreGive(semNVSEntry);
+}
+
+void System::printBootProfiles(void)
+{
+    esp_err_t ret = ESP_OK;
+    const char *versions[BOOT_PROFILE_COUNT] = {}; // Distinct versions, newest first
+    uint8_t versionCount = 0;
+    uint8_t boots = 0;
+    uint64_t total = 0;
+    bool found = false;
+
+    if (nvs == nullptr)
+        nvs = NVS::getInstance();
+
+    if (xSemaphoreTake(semNVSEntry, portMAX_DELAY))
+    {
+        ESP_GOTO_ON_ERROR(nvs->openNVSStorage("system"), sys_printBootProfiles_err, TAG, "nvs->openNVSStorage('system') failed");
+        found = readBootHistory();
+        nvs->closeNVStorage();
+        xSemaphoreGive(semNVSEntry);
+    }
+
+    if (!found)
+    {
+        ESP_LOGW(TAG, "No boot profiles saved yet");
+        return;
+    }
+
+    ESP_LOGW(TAG, "Boot profiles (ms)    reset  app_main  nvs  run task  first run  network");
+
+    for (uint8_t i = 0; i < BOOT_PROFILE_COUNT; i++)
+    {
+        SYS_BootProfile *profile = &bootHistory[i];
+
+        if (profile->version[0] == 0) // Unused
+            continue;
+
+        ESP_LOGW(TAG, "%6ld  %-12s  %5d  %8ld  %3ld  %8ld  %9ld  %7ld%s", profile->bootCount, profile->version, profile->resetReason,
+                 profile->markUs[(int)SYS_BOOT_MARK::App_Main] / 1000, profile->markUs[(int)SYS_BOOT_MARK::NVS_Restored] / 1000,
+                 profile->markUs[(int)SYS_BOOT_MARK::Run_Task_Started] / 1000, profile->markUs[(int)SYS_BOOT_MARK::First_Run] / 1000,
+                 profile->markUs[(int)SYS_BOOT_MARK::Network_Up] / 1000, profile->networkUp ? "" : "  (no network)");
+
+        found = false;
+        for (uint8_t j = 0; j < versionCount; j++)
+            found |= (strncmp(versions[j], profile->version, sizeof(profile->version)) == 0);
+
+        if (!found)
+            versions[versionCount++] = profile->version;
+    }
+
+    //
+    // The average time of each SYS_INIT step for every version we have boots of.  A step which got slower in a new build
+    // stands out against the same step of the older version, printed after it.
+    //
+    for (uint8_t j = 0; j < versionCount; j++)
+    {
+        boots = 0;
+        for (uint8_t i = 0; i < BOOT_PROFILE_COUNT; i++)
+            boots += (strncmp(versions[j], bootHistory[i].version, sizeof(bootHistory[i].version)) == 0);
+
+        ESP_LOGW(TAG, "Version %s, average of %d boot(s)", versions[j], boots);
+
+        for (uint8_t step = 0; step < (uint8_t)SYS_INIT::Finished; step++)
+        {
+            total = 0;
+            for (uint8_t i = 0; i < BOOT_PROFILE_COUNT; i++)
+            {
+                if (strncmp(versions[j], bootHistory[i].version, sizeof(bootHistory[i].version)) == 0)
+                    total += bootHistory[i].stepUs[step];
+            }
+
+            ESP_LOGW(TAG, "  SYS_INIT step %2d  %8" PRIu64 " us", step, total / boots);
+        }
+
+        for (uint8_t component = 0; component < (uint8_t)SYS_COMPONENT::Count; component++)
+        {
+            total = 0;
+            for (uint8_t i = 0; i < BOOT_PROFILE_COUNT; i++)
+            {
+                if (strncmp(versions[j], bootHistory[i].version, sizeof(bootHistory[i].version)) == 0)
+                    total += bootHistory[i].componentUs[component];
+            }
+
+            ESP_LOGW(TAG, "  SYS_COMPONENT %2d ready  %8" PRIu64 " us", component, total / boots);
+        }
+    }
+    return;
+
+sys_printBootProfiles_err:
+    LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
+    xSemaphoreGive(semNVSEntry);
+}
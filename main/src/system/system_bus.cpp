@@ -0,0 +1,181 @@
+#include "system_bus.hpp"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+
+#include <cstring>
+
+//
+// A publish/subscribe broker between our objects.  A publisher fills in one message from the pool and publishes it.  The broker
+// passes a pointer to it into the queue of every subscriber of its topic and counts one reference for each.  Nothing is copied,
+// however many subscribers there are, and nothing comes from the heap.  The message goes back to the pool with the last release().
+//
+// Objects subscribe when they are created and unsubscribe when they are destroyed.  The last message of each topic is retained,
+// so a new subscriber is told the current state (Wifi connected, for instance) without having to ask for it.
+//
+Bus::Bus(void)
+{
+    semBusLock = xSemaphoreCreateBinary();
+    if (semBusLock != NULL)
+        xSemaphoreGive(semBusLock);
+}
+
+int8_t Bus::subscribe(uint32_t topics, QueueHandle_t queue, TaskHandle_t task, uint32_t notifyBit)
+{
+    int8_t id = -1;
+
+    if ((topics == 0) || (queue == nullptr))
+        return -1;
+
+    if (xSemaphoreTake(semBusLock, portMAX_DELAY))
+    {
+        for (int8_t i = 0; i < BUS_SUBSCRIBERS; i++)
+        {
+            if (subscribers[i].topics == 0)
+            {
+                subscribers[i] = {topics, queue, task, notifyBit};
+                id = i;
+                break;
+            }
+        }
+
+        if (id >= 0)
+        {
+            for (uint8_t topic = 0; topic < (uint8_t)BUS_TOPIC::Count; topic++) // Catch the new subscriber up
+            {
+                if ((topics & BUS_TOPIC_BIT(topic)) && (retained[topic] != nullptr))
+                {
+                    retained[topic]->refs.fetch_add(1, std::memory_order_relaxed);
+                    deliver(&subscribers[id], retained[topic]);
+                }
+            }
+        }
+        xSemaphoreGive(semBusLock);
+    }
+    return id;
+}
+
+void Bus::unsubscribe(int8_t id)
+{
+    QueueHandle_t queue = nullptr;
+    BUS_Message *msg = nullptr;
+
+    if ((id < 0) || (id >= BUS_SUBSCRIBERS))
+        return;
+
+    if (xSemaphoreTake(semBusLock, portMAX_DELAY))
+    {
+        queue = subscribers[id].queue;
+        subscribers[id] = {};
+        xSemaphoreGive(semBusLock);
+    }
+
+    // No publisher can reach the queue now.  Whatever is still in it would never be released.
+    while ((queue != nullptr) && xQueueReceive(queue, &msg, 0))
+        release(msg);
+}
+
+BUS_Message *Bus::acquire(BUS_TOPIC topic)
+{
+    uint8_t expected = 0;
+    uint8_t count = 0;
+
+    for (uint8_t i = 0; i < BUS_POOL_SIZE; i++)
+    {
+        expected = 0;
+        if (pool[i].refs.compare_exchange_strong(expected, 1, std::memory_order_acquire)) // The publisher holds the first reference
+        {
+            pool[i].topic = topic;
+            pool[i].publishedUs = 0;
+            memset(&pool[i].sensorData, 0, sizeof(BUS_SensorData)); // The largest member of the payload union
+
+            count = inUse.fetch_add(1, std::memory_order_relaxed) + 1;
+            if (count > inUseMax.load(std::memory_order_relaxed))
+                inUseMax.store(count, std::memory_order_relaxed);
+            return &pool[i];
+        }
+    }
+
+    exhausted.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+uint8_t Bus::publish(BUS_Message *msg)
+{
+    uint8_t count = 0;
+    BUS_Message *previous = nullptr;
+
+    if (msg == nullptr)
+        return 0;
+
+    if (xSemaphoreTake(semBusLock, portMAX_DELAY))
+    {
+        msg->sequence = ++sequences[(int)msg->topic];
+        msg->publishedUs = esp_timer_get_time();
+
+        for (uint8_t i = 0; i < BUS_SUBSCRIBERS; i++)
+        {
+            if (subscribers[i].topics & BUS_TOPIC_BIT(msg->topic))
+            {
+                msg->refs.fetch_add(1, std::memory_order_relaxed); // Before the subscriber can see it, and release it
+                count += deliver(&subscribers[i], msg);
+            }
+        }
+
+        previous = retained[(int)msg->topic]; // The retained copy takes over the publisher's reference
+        retained[(int)msg->topic] = msg;
+        xSemaphoreGive(semBusLock);
+    }
+
+    published.fetch_add(1, std::memory_order_relaxed);
+
+    if (previous != nullptr)
+        release(previous);
+    return count;
+}
+
+void Bus::release(BUS_Message *msg)
+{
+    if ((msg != nullptr) && (msg->refs.fetch_sub(1, std::memory_order_acq_rel) == 1)) // The last one out puts it back in the pool
+        inUse.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool Bus::deliver(BUS_Subscriber *subscriber, BUS_Message *msg)
+{
+    // The caller holds semBusLock and has counted a reference for this subscriber
+    if (!xQueueSendToBack(subscriber->queue, &msg, 0)) // Never wait on a slow subscriber
+    {
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        release(msg);
+        return false;
+    }
+
+    if (subscriber->task != nullptr)
+        xTaskNotify(subscriber->task, subscriber->notifyBit, eSetBits);
+
+    delivered.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void Bus::getStats(BUS_Stats *stats)
+{
+    *stats = {};
+    stats->published = published.load(std::memory_order_relaxed);
+    stats->delivered = delivered.load(std::memory_order_relaxed);
+    stats->dropped = dropped.load(std::memory_order_relaxed);
+    stats->exhausted = exhausted.load(std::memory_order_relaxed);
+    stats->inUse = inUse.load(std::memory_order_relaxed);
+    stats->inUseMax = inUseMax.load(std::memory_order_relaxed);
+
+    for (uint8_t i = 0; i < BUS_SUBSCRIBERS; i++)
+        stats->subscribers += (subscribers[i].topics != 0);
+}
+
+void Bus::printStats(void)
+{
+    BUS_Stats stats = {};
+
+    getStats(&stats);
+    ESP_LOGW("_bus ", "Bus: %d subscribers  published %ld  delivered %ld  dropped %ld  pool %d/%d (max %d, empty %ld times)", stats.subscribers,
+             stats.published, stats.delivered, stats.dropped, stats.inUse, BUS_POOL_SIZE, stats.inUseMax, stats.exhausted);
+}
@@ -4,28 +4,65 @@
 
 void System::runDiagnostics()
 {
-    uint8_t diagSysValue = lockGetUint8(&diagSys);
+    uint8_t diagSysValue = diagSys.get();
 
     if (diagSysValue & _diagHeapCheck)
     {
-        lockAndUint8(&diagSys, _diagHeapCheck); // Clear the bit
-        heap_caps_check_integrity_all(true);    // Esp library test
+        diagSys.clearBits(_diagHeapCheck);   // Clear the bit
+        heap_caps_check_integrity_all(true); // Esp library test
     }
     else if (diagSysValue & _printRunTimeStats)
     {
-        lockAndUint8(&diagSys, _printRunTimeStats); // Clear the bit
-        printRunTimeStats();                        // This diagnostic will affect your process over a 45 seconds period.  Can't use without special Menuconfig settings set.
+        diagSys.clearBits(_printRunTimeStats); // Clear the bit
+        printRunTimeStats();                   // This diagnostic will affect your process over a 45 seconds period.  Can't use without special Menuconfig settings set.
     }
     else if (diagSysValue & _printMemoryStats)
     {
-        lockAndUint8(&diagSys, _printMemoryStats); // Clear the bit
+        diagSys.clearBits(_printMemoryStats); // Clear the bit
         printMemoryStats();
     }
     else if (diagSysValue & _printTaskInfo)
     {
-        lockAndUint8(&diagSys, _printTaskInfo); // Clear the bit
+        diagSys.clearBits(_printTaskInfo); // Clear the bit
         printTaskInfo();
     }
+    else if (diagSysValue & _printLogSuppression)
+    {
+        diagSys.clearBits(_printLogSuppression); // Clear the bit
+        LOG_RateLimit::printLogSuppression();    // What LOG_LIMITED() sites have held back
+    }
+    else if (diagSysValue & _printStateTransitions)
+    {
+        diagSys.clearBits(_printStateTransitions); // Clear the bit
+        printStateTransitions();
+        printBootProfiles(); // Startup time of the last boots, per firmware version
+    }
+    else if (diagSysValue & _printHeapRegions)
+    {
+        diagSys.clearBits(_printHeapRegions); // Clear the bit
+        printHeapRegions();
+    }
+    else if (diagSysValue & _printTaskLoad)
+    {
+        diagSys.clearBits(_printTaskLoad); // Clear the bit
+        printTaskLoad();                   // From the background sampler.  Unlike printRunTimeStats(), this doesn't disturb anything.
+        LOG_Latency::printLatency();       // Request and notification latency between our run loops
+    }
+}
+
+void System::printStateTransitions()
+{
+    //
+    // Every LOG_StateStep<> records its changes in the Logging transition ring.  Here we show the newest of them and the time
+    // spent in the steps which most often take long in the field.
+    //
+    int64_t latestUs = LOG_Telemetry::getStateDuration(LOG_MACHINE::Wifi_Conn, (uint8_t)WIFI_CONN::Wifi_Waiting_For_IP_Address);
+    int64_t longestUs = LOG_Telemetry::getStateDuration(LOG_MACHINE::Wifi_Conn, (uint8_t)WIFI_CONN::Wifi_Waiting_For_IP_Address, false);
+
+    ESP_LOGW(TAG, "State transitions (%ld recorded):", LOG_Telemetry::getTransitionHead());
+    LOG_Telemetry::printTransitions(LOG_MACHINE::Count, 24);
+
+    ESP_LOGW(TAG, "Wifi_Waiting_For_IP_Address     latest %lld us  longest %lld us", latestUs, longestUs);
 }
 
 void System::printRunTimeStats()
@@ -82,127 +119,25 @@ void System::printMemoryStats()
 
 void System::printTaskInfo()
 {
-    uint32_t totalNumTasks = uxTaskGetNumberOfTasks();
+    //
+    // Our own run tasks are in the task registry (see LOG_Tasks::registerTask()).  The IDF tasks we care about are looked up by name.
+    //
+    static const char *idfTaskNames[] = {"ipc0", "ipc1", "wifi", "tiT", "esp_timer", "tmr_svc", "sys_evt", "main", "IDLE0", "IDLE1"};
+    TaskHandle_t hd = nullptr;
 
     printf("...................................................\n");
-    printf("  Total Number of Tasks %ld\n", totalNumTasks);
+    printf("  Total Number of Tasks %d\n", (int)uxTaskGetNumberOfTasks());
     printf("  name         priority     high water mark\n");
 
-    // char *name = nullptr;
-    std::string name = "";
-    // std::string name;
-    TaskHandle_t hd = nullptr;
-    uint32_t priority = 0;
-    uint32_t highWaterMark = 0;
-
-    name = "ipc0"; // Inter processor call
-    hd = xTaskGetHandle(name.c_str());
-    if (hd != NULL)
-    {
-        priority = uxTaskPriorityGet(hd);
-        highWaterMark = uxTaskGetStackHighWaterMark(hd);
-        printf("  %-10s   %02ld           %ld\n", name.c_str(), priority, highWaterMark);
-    }
-
-    name = "ipc1";
-    hd = xTaskGetHandle(name.c_str());
-    if (hd != NULL)
-    {
-        priority = uxTaskPriorityGet(hd);
-        highWaterMark = uxTaskGetStackHighWaterMark(hd);
-        printf("  %-10s   %02ld           %ld\n", name.c_str(), priority, highWaterMark);
-    }
-
-    name = "wifi"; // wifi task
-    hd = xTaskGetHandle(name.c_str());
-    if (hd != NULL)
+    for (const char *name : idfTaskNames)
     {
-        priority = uxTaskPriorityGet(hd);
-        highWaterMark = uxTaskGetStackHighWaterMark(hd);
-        printf("  %-10s   %02ld           %ld\n", name.c_str(), priority, highWaterMark);
-    }
-
-    name = "tiT"; // tc/pip task
-    hd = xTaskGetHandle(name.c_str());
-    if (hd != NULL)
-    {
-        priority = uxTaskPriorityGet(hd);
-        highWaterMark = uxTaskGetStackHighWaterMark(hd);
-        printf("  %-10s   %02ld           %ld\n", name.c_str(), priority, highWaterMark);
-    }
-
-    name = "esp_timer";
-    hd = xTaskGetHandle(name.c_str());
-    if (hd != NULL)
-    {
-        priority = uxTaskPriorityGet(hd);
-        highWaterMark = uxTaskGetStackHighWaterMark(hd);
-        printf("  %-10s   %02ld           %ld\n", name.c_str(), priority, highWaterMark);
-    }
-
-    name = "tmr_svc";
-    hd = xTaskGetHandle(name.c_str());
-    if (hd != NULL)
-    {
-        priority = uxTaskPriorityGet(hd);
-        highWaterMark = uxTaskGetStackHighWaterMark(hd);
-        printf("  %-10s   %02ld           %ld\n", name.c_str(), priority, highWaterMark);
-    }
-
-    // NOTE:  If you call these functions on the Timer task too early, that task will not be created yet.
-    name = pcTaskGetName(taskHandleRunSysTimer);
-    priority = uxTaskPriorityGet(taskHandleRunSysTimer);
-    highWaterMark = uxTaskGetStackHighWaterMark(taskHandleRunSysTimer);
-    printf("  %-10s   %02ld           %ld\n", name.c_str(), priority, highWaterMark);
-
-    name = "sys_evt";
-    hd = xTaskGetHandle(name.c_str());
-    if (hd != NULL)
-    {
-        priority = uxTaskPriorityGet(hd);
-        highWaterMark = uxTaskGetStackHighWaterMark(hd);
-        printf("  %-10s   %02ld           %ld\n", name.c_str(), priority, highWaterMark);
-    }
-
-    name = pcTaskGetName(taskHandleSystemRun);
-    priority = uxTaskPriorityGet(taskHandleSystemRun);
-    highWaterMark = uxTaskGetStackHighWaterMark(taskHandleSystemRun);
-    printf("  %-10s   %02ld           %ld\n", name.c_str(), priority, highWaterMark);
-
-    name = pcTaskGetName(runTaskHandleSystemGPIO);
-    priority = uxTaskPriorityGet(runTaskHandleSystemGPIO);
-    highWaterMark = uxTaskGetStackHighWaterMark(runTaskHandleSystemGPIO);
-    printf("  %-10s   %02ld           %ld\n", name.c_str(), priority, highWaterMark);
-
-    // if (wifi != nullptr)
-        // wifi->printTaskInfoByColumns();
-
-    name = "main";
-    hd = xTaskGetHandle(name.c_str());
-    if (hd != NULL)
-    {
-        priority = uxTaskPriorityGet(hd);
-        highWaterMark = uxTaskGetStackHighWaterMark(hd);
-        printf("  %-10s   %02ld           %ld\n", name.c_str(), priority, highWaterMark);
-    }
-
-    name = "IDLE0";
-    hd = xTaskGetHandle(name.c_str());
-    if (hd != NULL)
-    {
-        priority = uxTaskPriorityGet(hd);
-        highWaterMark = uxTaskGetStackHighWaterMark(hd);
-        printf("  %-10s   %02ld           %ld\n", name.c_str(), priority, highWaterMark);
-    }
-
-    name = "IDLE1";
-    hd = xTaskGetHandle(name.c_str());
-    if (hd != NULL)
-    {
-        priority = uxTaskPriorityGet(hd);
-        highWaterMark = uxTaskGetStackHighWaterMark(hd);
-        printf("  %-10s   %02ld           %ld\n", name.c_str(), priority, highWaterMark);
+        hd = xTaskGetHandle(name);
+        if (hd != NULL)
+            printf("  %-10s   %02d           %d\n", name, (int)uxTaskPriorityGet(hd), (int)uxTaskGetStackHighWaterMark(hd));
     }
 
+    LOG_Tasks::printTaskRegistry();
+    LOG_Tasks::printHeartbeats();
+    bus->printStats();
     printf("...................................................\n");
-}
\ No newline at end of file
+}
@@ -65,7 +65,7 @@ void IRAM_ATTR GPIOIsrHandler(void *arg)
 void System::initGPIOTask(void)
 {
     if (show & _showInit)
-        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "()");
+        LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "()");
 
     esp_err_t ret = ESP_OK;
 
@@ -75,15 +75,16 @@ void System::initGPIOTask(void)
     ESP_GOTO_ON_ERROR(gpio_install_isr_service(ESP_INTR_FLAG_DEFAULT), sys_GPIOIsrHandler_err, TAG, "gpio_install_isr_service() failed");
 
     if (show & _showInit)
-        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): Started gpio isr service...");
+        LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): Started gpio isr service...");
 
     ESP_GOTO_ON_ERROR(gpio_isr_handler_add(SW1, GPIOSwitchIsrHandler, (void *)SW1), sys_GPIOIsrHandler_err, TAG, "gpio_isr_handler_add() failed");
 
     SwitchDebounceCounter = 10;
     allowSwitchGPIOinput = true;
 
-    logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): gpioStackSizeK: " + std::to_string(gpioStackSizeK));
-    xTaskCreate(runGPIOTaskMarshaller, "sys_gpio", 1024 * gpioStackSizeK, this, TASK_PRIORITY_MID, &runTaskHandleSystemGPIO); // (1) Low number indicates low priority task
+    LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): gpioStackSizeK: " + std::to_string(gpioStackSizeK));
+    createTask(SYS_TASK::System_GPIO, runGPIOTaskMarshaller, "sys_gpio", &gpioStackSizeK, this, &runTaskHandleSystemGPIO);
+    LOG_Tasks::registerTask(runTaskHandleSystemGPIO, 1024 * gpioStackSizeK, &gpioStackSizeK, "system", "gpioStackSizeK");
     return;
 
 sys_GPIOIsrHandler_err:
@@ -95,6 +96,7 @@ void System::runGPIOTaskMarshaller(void *arg) // This function can be resolved a
 {
     ((System *)arg)->runGPIOTask();
     ((System *)arg)->runTaskHandleSystemGPIO = nullptr; // This doesn't happen automatically but we look at this variable for validity, so set it manually.
+    LOG_Tasks::unregisterTask(nullptr);
     vTaskDelete(NULL);
 }
 
@@ -118,13 +120,13 @@ void System::runGPIOTask(void)
             {
             case SW1:
             {
-                logByValue(ESP_LOG_WARN, semSysRouteLock, TAG, std::string(__func__) + "(): SW1 - testIndex = " + std::to_string(testIndex) + " Wakeup Cause = " + std::to_string((int)esp_sleep_get_wakeup_cause()));
+                LOG_BY_VALUE(ESP_LOG_WARN, semSysRouteLock, TAG, std::string(__func__) + "(): SW1 - testIndex = " + std::to_string(testIndex) + " Wakeup Cause = " + std::to_string((int)esp_sleep_get_wakeup_cause()));
 
                 switch (testType)
                 {
                 case SYS_TEST_TYPE::IDLE:
                 {
-                    logByValue(ESP_LOG_WARN, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_TEST_TYPE::IDLE...");
+                    LOG_BY_VALUE(ESP_LOG_WARN, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_TEST_TYPE::IDLE...");
                     esp_pm_dump_locks(stdout);
                     break;
                 }
@@ -170,12 +172,24 @@ void System::runGPIOTask(void)
                     test_wifi(&testType, &testIndex);
                     break;
                 }
+
+                case SYS_TEST_TYPE::LOGGING:
+                {
+                    test_logging(&testType, &testIndex);
+                    break;
+                }
+
+                case SYS_TEST_TYPE::TASK_PLACEMENT:
+                {
+                    test_task_placement(&testType, &testIndex);
+                    break;
+                }
                 }
                 break;
             }
 
             default:
-                logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): Missing Case for io_num  " + std::to_string(io_num));
+                LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): Missing Case for io_num  " + std::to_string(io_num));
                 break;
             }
         }
@@ -12,10 +12,12 @@
 #include "esp_private/esp_clk.h"
 
 #include "esp_sleep.h"
+#include "esp_cpu.h"
 
 /* External Semaphores */
 extern SemaphoreHandle_t semNVSEntry;
 extern SemaphoreHandle_t semWifiEntry;
+extern SemaphoreHandle_t semSysRouteLock;
 
 //
 // This source file is all about running tests.  All functions here are called only from our runGPIOTask() function.
@@ -26,33 +28,33 @@ extern SemaphoreHandle_t semWifiEntry;
 // 3) NVS
 // 4) Indication
 // 5) WIFI
-// 6)
+// 6) Logging
 
 //
 // Object Lifecycle
 //
+// Index 0 creates the Wifi object and the next press destroys it.  After the destroy we print what the cycle left on the heap,
+// overall and per component (needs CONFIG_HEAP_USE_HOOKS for the component counts).  Index 1 starts a soak task which runs
+// LIFECYCLE_SOAK_CYCLES cycles by itself and prints "#S" lines.  Feed a console capture to tools/heap_drift.py to graph them.
+//
 void System::test_objectLifecycle_create(SYS_TEST_TYPE *type, uint8_t *index)
 {
     switch (*index)
     {
     case 0:
     {
-        if (wifi == nullptr)
-            wifi = new Wifi();
-
-        if (wifi != nullptr) // Make sure memory was allocated
+        if (taskHandleLifecycleSoak != nullptr) // The soak owns the Wifi object while it runs
         {
-            if (xSemaphoreTake(semWifiEntry, 100)) // Get a lock on the object after it initializes
-            {
-                taskHandleWifiRun = wifi->getRunTaskHandle();
-                queHandleWIFICmdRequest = wifi->getCmdRequestQueue();
-                xSemaphoreGive(semWifiEntry); // Release lock
+            ESP_LOGW(TAG, "Lifecycle soak is running");
+            break;
+        }
 
-                // Send out notifications to any object that needs the wifi and tell them wifi is now available.
+        LOG_Heap::startHeapTracking();
+        takeHeapSnapshot(&lifecycleBaseline);
+
+        if (lifecycleCreateWifi())
+            ESP_LOGW(TAG, "wifi instantiated");
 
-                ESP_LOGW(TAG, "wifi instantiated");
-            }
-        }
         *type = SYS_TEST_TYPE::LIFE_CYCLE_DESTROY;
         *index = 0;
         break;
@@ -60,6 +62,17 @@ void System::test_objectLifecycle_create(SYS_TEST_TYPE *type, uint8_t *index)
 
     case 1:
     {
+        if (taskHandleLifecycleSoak != nullptr)
+        {
+            ESP_LOGW(TAG, "Lifecycle soak is already running");
+            break;
+        }
+
+        if (wifi != nullptr) // The soak starts from no object at all
+            lifecycleDestroyWifi();
+
+        xTaskCreate(lifecycleSoakTask, "sys_soak", 1024 * 4, this, TASK_PRIORITY_MID, &taskHandleLifecycleSoak);
+        *index = 0;
         break;
     }
 
@@ -72,27 +85,26 @@ void System::test_objectLifecycle_create(SYS_TEST_TYPE *type, uint8_t *index)
 
 void System::test_objectLifecycle_destroy(SYS_TEST_TYPE *type, uint8_t *index)
 {
+    SYS_HeapSnapshot after = {};
+
     switch (*index)
     {
     case 0:
     {
-        if (wifi != nullptr)
+        if (taskHandleLifecycleSoak != nullptr)
         {
-            if (semWifiEntry != nullptr)
-            {
-                xSemaphoreTake(semWifiEntry, portMAX_DELAY); // Wait here until we gain the lock.
-
-                // Send out notifications to any object that uses the wifi and tell them wifi is no longer available.
-
-                taskHandleWIFIRun = nullptr;       // Reset the wifi handles
-                queHandleWIFICmdRequest = nullptr; //
+            ESP_LOGW(TAG, "Lifecycle soak is running");
+            return;
+        }
 
-                delete wifi;                   // Lock on the object will be done inside the destructor.
-                wifi = nullptr;                // Destructor will not set pointer null.  We have to do that manually.
-                ESP_LOGW(TAG, "wifi deleted"); //
+        if (wifi != nullptr)
+        {
+            lifecycleDestroyWifi();
+            ESP_LOGW(TAG, "wifi deleted");
 
-                // Note: The semWifiEntry semaphore is already destroyed - so don't "Give" it or a run time error will occur
-            }
+            vTaskDelay(pdMS_TO_TICKS(LIFECYCLE_SETTLE_MS));
+            takeHeapSnapshot(&after);
+            printHeapDrift("Wifi create/destroy", &lifecycleBaseline, &after);
         }
         *type = SYS_TEST_TYPE::LIFE_CYCLE_CREATE;
         *index = 0;
@@ -118,6 +130,148 @@ void System::test_objectLifecycle_destroy(SYS_TEST_TYPE *type, uint8_t *index)
     }
 }
 
+bool System::lifecycleCreateWifi(void)
+{
+    if (wifi == nullptr)
+    {
+        LOG_HeapScope scope(LOG_HEAP_TAG::Wifi); // Everything the constructor allocates on this task belongs to Wifi
+        wifi = new Wifi();
+    }
+
+    if (wifi == nullptr) // Make sure memory was allocated
+        return false;
+
+    if (!xSemaphoreTake(semWifiEntry, pdMS_TO_TICKS(LIFECYCLE_CREATE_TIMEOUT_MS))) // Get a lock on the object after it initializes
+        return false;
+
+    taskHandleWIFIRun = wifi->getRunTaskHandle();
+    queHandleWIFICmdRequest = wifi->getCmdRequestQueue();
+    xSemaphoreGive(semWifiEntry); // Release lock
+
+    // Send out notifications to any object that needs the wifi and tell them wifi is now available.
+    return true;
+}
+
+void System::lifecycleDestroyWifi(void)
+{
+    if ((wifi == nullptr) || (semWifiEntry == nullptr))
+        return;
+
+    xSemaphoreTake(semWifiEntry, portMAX_DELAY); // Wait here until we gain the lock.
+
+    // Send out notifications to any object that uses the wifi and tell them wifi is no longer available.
+
+    taskHandleWIFIRun = nullptr;       // Reset the wifi handles
+    queHandleWIFICmdRequest = nullptr; //
+
+    {
+        LOG_HeapScope scope(LOG_HEAP_TAG::Wifi);
+        delete wifi; // Lock on the object will be done inside the destructor.
+    }
+    wifi = nullptr; // Destructor will not set pointer null.  We have to do that manually.
+
+    // Note: The semWifiEntry semaphore is already destroyed - so don't "Give" it or a run time error will occur
+}
+
+void System::takeHeapSnapshot(SYS_HeapSnapshot *snapshot)
+{
+    multi_heap_info_t info = {};
+
+    heap_caps_get_info(&info, MALLOC_CAP_8BIT);
+
+    snapshot->allocatedBytes = info.total_allocated_bytes;
+    snapshot->allocatedBlocks = info.allocated_blocks;
+    snapshot->freeBytes = info.total_free_bytes;
+    snapshot->largestFree = info.largest_free_block;
+    snapshot->freeBlocks = info.free_blocks;
+
+    for (int tag = 0; tag < (int)LOG_HEAP_TAG::Count; tag++)
+        LOG_Heap::getHeapTagStats((LOG_HEAP_TAG)tag, &snapshot->tags[tag]);
+}
+
+void System::printHeapDrift(const char *label, const SYS_HeapSnapshot *before, const SYS_HeapSnapshot *after)
+{
+    static const char *tagNames[(int)LOG_HEAP_TAG::Count] = {"Other", "System", "Wifi", "Prov", "Display", "I2C", "SPI", "NVS"};
+
+    printf("...................................................\n");
+    printf("  %s left on the heap:  %ld bytes in %ld blocks   free %ld -> %ld   largest free %ld -> %ld\n", label,
+           (int32_t)(after->allocatedBytes - before->allocatedBytes), (int32_t)(after->allocatedBlocks - before->allocatedBlocks),
+           before->freeBytes, after->freeBytes, before->largestFree, after->largestFree);
+
+    for (int tag = 0; tag < (int)LOG_HEAP_TAG::Count; tag++)
+    {
+        int32_t bytes = after->tags[tag].bytes - before->tags[tag].bytes;
+        int32_t blocks = after->tags[tag].blocks - before->tags[tag].blocks;
+
+        if ((bytes != 0) || (blocks != 0))
+            printf("  %-8s  %ld bytes in %ld blocks\n", tagNames[tag], bytes, blocks);
+    }
+
+    if (LOG_Heap::getHeapUntracked() > 0)
+        printf("  (%ld allocations were not tracked.  Increase LOG_HEAP_TRACK_SLOTS.)\n", LOG_Heap::getHeapUntracked());
+    printf("...................................................\n");
+}
+
+void System::lifecycleSoakTask(void *arg)
+{
+    System *sys = (System *)arg;
+    SYS_HeapSnapshot baseline = {};
+    SYS_HeapSnapshot now = {};
+    uint32_t failed = 0; // Cycles whose Wifi object wasn't ready in time.  They are still destroyed, but not counted as a cycle.
+
+    LOG_Heap::startHeapTracking();
+
+    //
+    // One warm up cycle first.  Lazily created IDF state (the esp_netif and event loop bits, the PHY calibration data) stays
+    // allocated after the first Wifi object is gone and would otherwise show up as a step at cycle 1.
+    //
+    if (!sys->lifecycleCreateWifi())
+    {
+        sys->lifecycleDestroyWifi();
+        ESP_LOGE(TAG, "Lifecycle soak: the Wifi object wasn't ready within %d ms.  Soak abandoned.", LIFECYCLE_CREATE_TIMEOUT_MS);
+        sys->taskHandleLifecycleSoak = nullptr;
+        vTaskDelete(NULL);
+    }
+    sys->lifecycleDestroyWifi();
+    vTaskDelay(pdMS_TO_TICKS(LIFECYCLE_SETTLE_MS));
+    sys->takeHeapSnapshot(&baseline);
+
+    printf("#S cycle,bytes,blocks,largestFree,wifiBytes\n");
+    printf("#S 0,0,0,%ld,0\n", baseline.largestFree);
+
+    for (uint32_t cycle = 1; cycle <= LIFECYCLE_SOAK_CYCLES; cycle++)
+    {
+        if (!sys->lifecycleCreateWifi())
+        {
+            sys->lifecycleDestroyWifi(); // Waits for the object to finish initializing
+            failed++;
+            cycle--;
+
+            if (failed >= LIFECYCLE_SOAK_MAX_FAILED)
+                break;
+            continue;
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(100)); // Let the run task get going
+        sys->lifecycleDestroyWifi();
+
+        if ((cycle % LIFECYCLE_SOAK_REPORT) == 0)
+        {
+            vTaskDelay(pdMS_TO_TICKS(LIFECYCLE_SETTLE_MS));
+            sys->takeHeapSnapshot(&now);
+            printf("#S %ld,%ld,%ld,%ld,%ld\n", cycle, (int32_t)(now.allocatedBytes - baseline.allocatedBytes), (int32_t)(now.allocatedBlocks - baseline.allocatedBlocks),
+                   now.largestFree, now.tags[(int)LOG_HEAP_TAG::Wifi].bytes - baseline.tags[(int)LOG_HEAP_TAG::Wifi].bytes);
+        }
+    }
+
+    sys->printHeapDrift("Lifecycle soak", &baseline, &now);
+    if (failed > 0)
+        printf("  (%ld cycles skipped: the Wifi object wasn't ready within %d ms)\n", failed, LIFECYCLE_CREATE_TIMEOUT_MS);
+
+    sys->taskHandleLifecycleSoak = nullptr;
+    vTaskDelete(NULL);
+}
+
 //
 // Low Power and Sleep Modes
 //
@@ -378,14 +532,14 @@ void System::test_wifi(SYS_TEST_TYPE *type, uint8_t *index)
     {
     case 0:
     {
-        while (!xTaskNotify(taskHandleWIFIRun, static_cast<uint32_t>(WIFI_NOTIFY::CMD_CLEAR_PRI_HOST), eSetValueWithoutOverwrite))
-             vTaskDelay(pdMS_TO_TICKS(50));
+        LOG_Latency::stampNotify(LOG_LAT_SOURCE::Wifi, static_cast<uint32_t>(WIFI_NOTIFY::CMD_CLEAR_PRI_HOST));
+        xTaskNotify(taskHandleWIFIRun, static_cast<uint32_t>(WIFI_NOTIFY::CMD_CLEAR_PRI_HOST), eSetBits);
 
-        while (!xTaskNotify(taskHandleWIFIRun, static_cast<uint32_t>(WIFI_NOTIFY::CMD_PROV_HOST), eSetValueWithoutOverwrite))
-            vTaskDelay(pdMS_TO_TICKS(50));
+        LOG_Latency::stampNotify(LOG_LAT_SOURCE::Wifi, static_cast<uint32_t>(WIFI_NOTIFY::CMD_PROV_HOST));
+        xTaskNotify(taskHandleWIFIRun, static_cast<uint32_t>(WIFI_NOTIFY::CMD_PROV_HOST), eSetBits);
 
-        while (!xTaskNotify(taskHandleWIFIRun, static_cast<uint32_t>(WIFI_NOTIFY::CMD_RUN_DIRECTIVES), eSetValueWithoutOverwrite))
-            vTaskDelay(pdMS_TO_TICKS(50));
+        LOG_Latency::stampNotify(LOG_LAT_SOURCE::Wifi, static_cast<uint32_t>(WIFI_NOTIFY::CMD_RUN_DIRECTIVES));
+        xTaskNotify(taskHandleWIFIRun, static_cast<uint32_t>(WIFI_NOTIFY::CMD_RUN_DIRECTIVES), eSetBits);
         ++*index;
         break;
     }
@@ -399,14 +553,13 @@ void System::test_wifi(SYS_TEST_TYPE *type, uint8_t *index)
 
     case 2:
     {
-        // while (!xTaskNotify(taskHandleWIFIRun, static_cast<uint32_t>(WIFI_NOTIFY::CMD_DISC_HOST), eSetValueWithoutOverwrite))
-        //     vTaskDelay(pdMS_TO_TICKS(50));
+        // xTaskNotify(taskHandleWIFIRun, static_cast<uint32_t>(WIFI_NOTIFY::CMD_DISC_HOST), eSetBits);
 
-        while (!xTaskNotify(taskHandleWIFIRun, static_cast<uint32_t>(WIFI_NOTIFY::CMD_CONN_PRI_HOST), eSetValueWithoutOverwrite))
-            vTaskDelay(pdMS_TO_TICKS(50));
+        LOG_Latency::stampNotify(LOG_LAT_SOURCE::Wifi, static_cast<uint32_t>(WIFI_NOTIFY::CMD_CONN_PRI_HOST));
+        xTaskNotify(taskHandleWIFIRun, static_cast<uint32_t>(WIFI_NOTIFY::CMD_CONN_PRI_HOST), eSetBits);
 
-        while (!xTaskNotify(taskHandleWIFIRun, static_cast<uint32_t>(WIFI_NOTIFY::CMD_RUN_DIRECTIVES), eSetValueWithoutOverwrite))
-            vTaskDelay(pdMS_TO_TICKS(50));
+        LOG_Latency::stampNotify(LOG_LAT_SOURCE::Wifi, static_cast<uint32_t>(WIFI_NOTIFY::CMD_RUN_DIRECTIVES));
+        xTaskNotify(taskHandleWIFIRun, static_cast<uint32_t>(WIFI_NOTIFY::CMD_RUN_DIRECTIVES), eSetBits);
         ++*index;
         break;
     }
@@ -420,4 +573,190 @@ void System::test_wifi(SYS_TEST_TYPE *type, uint8_t *index)
     }
 
     // CHANGE YOUR TEST AREA AND INDEX AS NEEDED FOR THE NEXT SEQUENCE YOU WANT
-}
\ No newline at end of file
+}
+
+//
+// Logging
+//
+void System::test_logging(SYS_TEST_TYPE *type, uint8_t *index)
+{
+    // Compares producer latency of logByValue() when LOG_BENCH_TASKS tasks log at the same time.
+    // Index 0 measures the log ring path, index 1 measures the older semaphore + console path.
+    // Index 2 counts heap allocations per log call and reports the steady state run loop counts (needs CONFIG_HEAP_USE_HOOKS).
+    // Index 3 exports the trace spans and state transitions as a Chrome trace (see tools/trace_extract.py).
+    // Index 4 polls SYS_COMMAND::GET_STATS the way an external controller would and prints the JSON snapshot.
+    uint32_t cyclesPerUs = esp_clk_cpu_freq() / 1000000;
+    uint32_t callCount = LOG_BENCH_TASKS * LOG_BENCH_MESSAGES;
+
+    switch (*index)
+    {
+    case 0:
+    case 1:
+    {
+        logBenchUseRing = (*index == 0);
+        logBenchTotalCycles = 0;
+        logBenchMaxCycles = 0;
+
+        if (semLogBenchDone == nullptr)
+            semLogBenchDone = xSemaphoreCreateCounting(LOG_BENCH_TASKS, 0);
+
+        for (int i = 0; i < LOG_BENCH_TASKS; i++)
+            xTaskCreatePinnedToCore(logBenchProducer, "log_bench", 1024 * 3, this, TASK_PRIORITY_MID, nullptr, i % 2);
+
+        for (int i = 0; i < LOG_BENCH_TASKS; i++)
+            xSemaphoreTake(semLogBenchDone, portMAX_DELAY);
+
+        vTaskDelay(pdMS_TO_TICKS(500)); // Let the drainer catch up so our results are not buried in the output.
+
+        ESP_LOGW(TAG, "%s path: %d tasks x %d messages  avg %ld us  max %ld us  dropped %ld", logBenchUseRing ? "ring" : "locked",
+                 LOG_BENCH_TASKS, LOG_BENCH_MESSAGES, logBenchTotalCycles / callCount / cyclesPerUs, logBenchMaxCycles / cyclesPerUs, getLogDroppedCount());
+
+        ++*index;
+        break;
+    }
+
+    case 2:
+    {
+        uint32_t allocsByValue = 0;
+        uint32_t allocsPrintf = 0;
+        uint32_t start = 0;
+        LOG_HeapAllocStats sysStats = runHeapAllocs;
+        LOG_HeapAllocStats wifiStats = {};
+        LOG_HeapAllocStats sntpStats = {};
+
+        for (int i = 0; i < LOG_BENCH_MESSAGES; i++)
+        {
+            start = LOG_Heap::getTaskHeapAllocs();
+            LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): std::string message " + std::to_string(i));
+            allocsByValue += LOG_Heap::getTaskHeapAllocs() - start;
+
+            start = LOG_Heap::getTaskHeapAllocs();
+            LOG_PRINTF(ESP_LOG_INFO, semSysRouteLock, TAG, "printf message %d", i);
+            allocsPrintf += LOG_Heap::getTaskHeapAllocs() - start;
+        }
+
+        if (wifi != nullptr)
+        {
+            wifiStats = wifi->getRunHeapAllocs();
+            sntpStats = wifi->getSNTPRunHeapAllocs();
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(500)); // Let the drainer catch up so our results are not buried in the output.
+
+        ESP_LOGW(TAG, "Heap allocations per call:  LOG_BY_VALUE(std::string) %ld.%02ld  LOG_PRINTF() %ld.%02ld  inside Logging %ld total",
+                 allocsByValue / LOG_BENCH_MESSAGES, (allocsByValue * 100 / LOG_BENCH_MESSAGES) % 100,
+                 allocsPrintf / LOG_BENCH_MESSAGES, (allocsPrintf * 100 / LOG_BENCH_MESSAGES) % 100, LOG_Heap::getLogHeapAllocs());
+        ESP_LOGW(TAG, "Steady state heap allocations:  System::run %ld in %ld passes  Wifi::run %ld in %ld passes  SNTP::run %ld in %ld passes",
+                 sysStats.quietAllocs, sysStats.quietPasses, wifiStats.quietAllocs, wifiStats.quietPasses, sntpStats.quietAllocs, sntpStats.quietPasses);
+
+        ++*index;
+        break;
+    }
+
+    case 3:
+    {
+        vTaskDelay(pdMS_TO_TICKS(500)); // Let the drainer empty the ring so log lines don't land inside the JSON
+        LOG_Trace::exportTrace();
+
+        ++*index;
+        break;
+    }
+
+    case 4:
+    {
+        static QueueHandle_t statsResponseQueue = xQueueCreate(1, sizeof(SYS_Response *));
+        static SYS_CmdRequest statsRequest = {}; // The System still touches it after it has responded
+        SYS_Response *ptrResponse = nullptr;
+
+        statsRequest.queueToSendResponse = statsResponseQueue;
+        statsRequest.requestedCmd = SYS_COMMAND::GET_STATS;
+        statsRequest.data64bit = 1; // JSON as well
+
+        if (sendCmdRequest(&statsRequest, pdMS_TO_TICKS(100)) && xQueueReceive(statsResponseQueue, &ptrResponse, pdMS_TO_TICKS(1000)))
+        {
+            ESP_LOGW(TAG, "GET_STATS: status %d  binary %d bytes  JSON %d of %d bytes", (int)ptrResponse->responseCode, ptrResponse->stats->size,
+                     (ptrResponse->jsonResponse != nullptr) ? (int)ptrResponse->jsonResponse->size() : 0, SYS_STATS_JSON_SIZE);
+
+            if (ptrResponse->jsonResponse != nullptr)
+                printf("%s\n", ptrResponse->jsonResponse->c_str());
+        }
+        else
+            ESP_LOGE(TAG, "GET_STATS: No response");
+
+        ++*index;
+        break;
+    }
+
+    case 5:
+    {
+        *index = 0;
+        break;
+    }
+    }
+}
+
+//
+// Task Placement
+//
+void System::test_task_placement(SYS_TEST_TYPE *type, uint8_t *index)
+{
+    // Index 0 watches the task plan we booted with for TASK_BENCH_SECS and reports run loop wakes, load, and latency.
+    // Index 1 saves the next built in layout to NVS and restarts.  After the boot, index 0 watches that layout.
+    int8_t layout = getTaskLayout();
+
+    switch (*index)
+    {
+    case 0:
+    {
+        benchTaskPlan();
+        ++*index;
+        break;
+    }
+
+    case 1:
+    {
+        layout = (layout < 0) ? 0 : (layout + 1) % TASK_PLAN_LAYOUTS; // A plan of our own is followed by layout 0
+
+        if (saveTaskLayout(layout) == ESP_OK)
+        {
+            ESP_LOGW(TAG, "Task plan layout %d saved.  Restarting...", layout);
+            vTaskDelay(pdMS_TO_TICKS(500)); // Let the drainer empty the ring
+            esp_restart();
+        }
+
+        ESP_LOGE(TAG, "Unable to save task plan layout %d", layout);
+        *index = 0;
+        break;
+    }
+    }
+}
+
+void System::logBenchProducer(void *arg)
+{
+    System *sys = (System *)arg;
+    std::string msg = "";
+    uint32_t start = 0;
+    uint32_t cycles = 0;
+    uint32_t max = 0;
+
+    for (int i = 0; i < LOG_BENCH_MESSAGES; i++)
+    {
+        msg = std::string(pcTaskGetName(NULL)) + " core " + std::to_string(xPortGetCoreID()) + " message " + std::to_string(i); // Built outside of the measurement
+
+        start = esp_cpu_get_cycle_count(); // Our task is pinned, so the cycle counter stays on one core.
+        if (sys->logBenchUseRing)
+            sys->logByValue(ESP_LOG_INFO, semSysRouteLock, sys->TAG, msg);
+        else
+            sys->logByValueLocked(ESP_LOG_INFO, semSysRouteLock, sys->TAG, msg);
+        cycles = esp_cpu_get_cycle_count() - start;
+
+        sys->logBenchTotalCycles.fetch_add(cycles);
+
+        max = sys->logBenchMaxCycles.load();
+        while ((cycles > max) && !sys->logBenchMaxCycles.compare_exchange_weak(max, cycles))
+            ;
+    }
+
+    xSemaphoreGive(sys->semLogBenchDone);
+    vTaskDelete(NULL);
+}
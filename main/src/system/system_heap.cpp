@@ -0,0 +1,116 @@
+#include "system_.hpp"
+
+#include <algorithm>
+
+/* External Semaphores */
+extern SemaphoreHandle_t semSysRouteLock;
+
+//
+// heap_caps_check_integrity_all() checks every heap region in one go, and its cost grows with the heap (PSRAM above all).
+// Instead, once a second we check one region with heap_caps_check_integrity_addr(), which is the same check (block headers,
+// the TLSF free lists and, with heap poisoning, every canary) limited to that region.  The next second takes the next region.
+//
+// The work per second is bounded by the size of one region, not by a block count, so the largest region (usually PSRAM) sets
+// the longest pass of the run loop.  A corrupt region is found up to one full pass (a second per region) after it is damaged.
+//
+// The free block statistics come from a walk of the same region just before the check.  Both take the region's lock, so we
+// never log from inside them.
+//
+void System::heapCheckStep(void)
+{
+    LOG_TraceSpan span("System::heapCheckStep");
+
+    heapWalk = {};
+    heapWalk.heapIndex = UINT8_MAX; // The first region seen becomes index 0
+    heapWork = {};
+
+    heap_caps_walk_all(heapCheckWalker, this);
+
+    if (!heapWalk.regionVisited) // We ran past the last region, so a full pass is complete.
+    {
+        heapRegionCount = heapRegion;
+        heapRegion = 0;
+        return;
+    }
+
+    if (!heap_caps_check_integrity_addr(heapWork.start, false))
+        heapWork.errors = 1;
+
+    heapCheckRegionDone();
+}
+
+bool System::heapCheckWalker(walker_heap_into_t heap, walker_block_info_t block, void *arg)
+{
+    System *sys = (System *)arg;
+    SYS_HeapWalk *walk = &sys->heapWalk;
+    SYS_HeapRegion *work = &sys->heapWork;
+
+    if (heap.start != walk->heapStart)
+    {
+        walk->heapStart = heap.start;
+        walk->heapIndex++;
+    }
+
+    if (walk->heapIndex != sys->heapRegion) // Not the region we are working on.  Returning false skips the rest of it.
+        return false;
+
+    walk->regionVisited = true;
+
+    work->start = heap.start;
+    work->end = heap.end;
+    work->blocks++;
+    if (!block.used)
+    {
+        work->freeBlocks++;
+        work->freeBytes += block.size;
+        work->largestFree = std::max<uint32_t>(work->largestFree, block.size);
+    }
+    return true;
+}
+
+void System::heapCheckRegionDone(void)
+{
+    uint32_t fragmentation = (heapWork.freeBytes > 0) ? (100 - (uint32_t)(((uint64_t)heapWork.largestFree * 100) / heapWork.freeBytes)) : 0;
+    bool failed = (heapWork.errors > 0);
+
+    if (heapRegion < HEAP_CHECK_MAX_REGIONS)
+    {
+        if (heapRegions[heapRegion].start == heapWork.start) // Counts carry over while the region stays the same
+        {
+            heapWork.passes = heapRegions[heapRegion].passes + 1;
+            heapWork.errors += heapRegions[heapRegion].errors;
+        }
+        else
+            heapWork.passes = 1;
+        heapRegions[heapRegion] = heapWork;
+    }
+
+    if (failed)
+    {
+        LOG_PRINTF(ESP_LOG_ERROR, semSysRouteLock, TAG, "Heap region %d (0x%08x - 0x%08x) failed its integrity check", heapRegion, heapWork.start, heapWork.end);
+        heap_caps_check_integrity_addr(heapWork.start, true); // Check again and let the heap print the details
+    }
+    else if ((fragmentation >= HEAP_CHECK_FRAG_WARN) && (heapWork.freeBytes >= 4096)) // Tiny regions are always "fragmented"
+        LOG_LIMITED(ESP_LOG_WARN, semSysRouteLock, TAG, "Heap region %d is %ld%% fragmented (largest free block %ld of %ld bytes free)", heapRegion, fragmentation,
+                    heapWork.largestFree, heapWork.freeBytes);
+
+    heapRegion++;
+    heapWork = {};
+}
+
+void System::printHeapRegions(void)
+{
+    printf("...................................................\n");
+    printf("  Heap regions (incremental check, one region a second)\n");
+    printf("  #   start       end         blocks  free    free bytes  largest     frag%%  errors  passes\n");
+
+    for (uint8_t i = 0; (i < heapRegionCount) && (i < HEAP_CHECK_MAX_REGIONS); i++)
+    {
+        SYS_HeapRegion *region = &heapRegions[i];
+        uint32_t fragmentation = (region->freeBytes > 0) ? (100 - (uint32_t)(((uint64_t)region->largestFree * 100) / region->freeBytes)) : 0;
+
+        printf("  %-2d  0x%08x  0x%08x  %-6ld  %-6ld  %-10ld  %-10ld  %-5ld  %-6ld  %ld\n", i, region->start, region->end, region->blocks, region->freeBlocks,
+               region->freeBytes, region->largestFree, fragmentation, region->errors, region->passes);
+    }
+    printf("...................................................\n");
+}
@@ -0,0 +1,192 @@
+#include "system_.hpp"
+
+/* External Semaphores */
+extern SemaphoreHandle_t semSPIEntry;
+extern SemaphoreHandle_t semDisplayEntry;
+extern SemaphoreHandle_t semI2CEntry;
+extern SemaphoreHandle_t semWifiEntry;
+
+extern SemaphoreHandle_t semSysRouteLock;
+
+//
+// The objects created during SYS_INIT and what each of them needs first.  Every object gets a short lived task of its own,
+// pinned to a core.  That task waits until the objects it depends on are ready, runs the constructor, and then waits on the
+// entry semaphore which the object gives when its own initialization is finished.  Objects which don't depend on each other
+// are built at the same time, on both cores, and the System waits for all of them together.
+//
+// Before the graph, each object was created and waited for in turn, so the boot took the sum of them all.  SYS_INIT_PARALLEL 0
+// brings that order back (each object depends on the one before it), so the two can be compared in printBootProfiles().
+//
+// Every wait, in the init tasks and in the System, runs against the one deadline SYS_INIT_TIMEOUT_MS after Start_Components.
+// When an object fails, the init tasks still waiting on it give up, and the System waits until every init task has finished
+// (at the latest by that deadline) before it moves to SYS_INIT::Error.  No init task touches the System after that.
+//
+//   Display - the panel is on the SPI bus
+//   Touch and IMU, when they are added, will hang off I2C
+//
+static const SYS_InitNode initGraph[(int)SYS_COMPONENT::Count] = {
+    {SYS_COMPONENT::I2C, "init_i2c", 0, 0, LOG_HEAP_TAG::I2C},
+    {SYS_COMPONENT::SPI, "init_spi", 0, 1, LOG_HEAP_TAG::SPI},
+    {SYS_COMPONENT::Display, "init_disp", SYS_COMPONENT_BIT(SYS_COMPONENT::SPI), 1, LOG_HEAP_TAG::Display},
+    {SYS_COMPONENT::Wifi, "init_wifi", 0, 0, LOG_HEAP_TAG::Wifi},
+};
+
+bool System::startComponents(void)
+{
+    if (initGroup == nullptr)
+        initGroup = xEventGroupCreate();
+
+    if (initGroup == nullptr)
+        return false;
+
+    xEventGroupClearBits(initGroup, SYS_COMPONENT_ALL | (SYS_COMPONENT_ALL << SYS_INIT_FAILED_SHIFT));
+    initStartUs = esp_timer_get_time();
+
+    for (uint8_t i = 0; i < (uint8_t)SYS_COMPONENT::Count; i++)
+    {
+        if (xTaskCreatePinnedToCore(initTask, initGraph[i].taskName, 1024 * SYS_INIT_STACK_SIZE_K, (void *)&initGraph[i], TASK_PRIORITY_MID, nullptr,
+                                    initGraph[i].core) != pdPASS)
+            xEventGroupSetBits(initGroup, (SYS_COMPONENT_BIT(i) << SYS_INIT_FAILED_SHIFT) | (SYS_COMPONENT_BIT(i) << SYS_INIT_DONE_SHIFT));
+    }
+    return true;
+}
+
+bool System::waitOnComponents(uint32_t *failed)
+{
+    // Returns the moment the last object is ready.  The timeout only lets us look for failures.
+    EventBits_t bits = xEventGroupWaitBits(initGroup, SYS_COMPONENT_ALL, pdFALSE, pdTRUE, pdMS_TO_TICKS(100));
+
+    *failed = (bits >> SYS_INIT_FAILED_SHIFT) & SYS_COMPONENT_ALL;
+
+    if ((bits & SYS_COMPONENT_ALL) == SYS_COMPONENT_ALL)
+        return true;
+
+    if ((*failed == 0) && (initTicksLeft() == 0))
+        *failed = SYS_COMPONENT_ALL & ~bits; // Anything not ready by now
+
+    if (*failed == 0)
+        return false;
+
+    return ((bits >> SYS_INIT_DONE_SHIFT) & SYS_COMPONENT_ALL) == SYS_COMPONENT_ALL; // Failed, but some init task may still be finishing
+}
+
+TickType_t System::initTicksLeft(void)
+{
+    int64_t leftUs = (initStartUs + (int64_t)SYS_INIT_TIMEOUT_MS * 1000) - esp_timer_get_time();
+
+    return (leftUs > 0) ? pdMS_TO_TICKS((leftUs + 999) / 1000) : 0;
+}
+
+void System::initTask(void *arg)
+{
+    const SYS_InitNode *node = (const SYS_InitNode *)arg;
+
+    LOG_Heap::setTaskHeapTag(node->heapTag);
+    getInstance()->initComponent(node);
+    xEventGroupSetBits(getInstance()->initGroup, SYS_COMPONENT_BIT(node->component) << SYS_INIT_DONE_SHIFT); // Last touch of the System
+    vTaskDelete(NULL);
+}
+
+void System::initComponent(const SYS_InitNode *node)
+{
+    uint32_t needs = node->dependsOn;
+    EventBits_t bits = 0;
+
+#if SYS_INIT_PARALLEL == 0
+    if (node->component != (SYS_COMPONENT)0)
+        needs |= SYS_COMPONENT_BIT((uint8_t)node->component - 1);
+#endif
+
+    while ((bits & needs) != needs)
+    {
+        bits = xEventGroupWaitBits(initGroup, needs, pdFALSE, pdTRUE, pdMS_TO_TICKS(100));
+
+        if (((bits >> SYS_INIT_FAILED_SHIFT) & SYS_COMPONENT_ALL) || (initTicksLeft() == 0))
+            goto sys_initComponent_err; // SYS_INIT is going to fail anyway
+    }
+
+    if (!createComponent(node->component))
+        goto sys_initComponent_err;
+
+    bootProfile.componentUs[(int)node->component] = (uint32_t)(esp_timer_get_time() - initStartUs); // Read by the System after the bit is set
+
+    if (show & _showInit)
+        LOG_PRINTF(ESP_LOG_INFO, semSysRouteLock, TAG, "%s ready after %ld us on core %d", node->taskName, bootProfile.componentUs[(int)node->component],
+                   xPortGetCoreID());
+
+    xEventGroupSetBits(initGroup, SYS_COMPONENT_BIT(node->component));
+    return;
+
+sys_initComponent_err:
+    xEventGroupSetBits(initGroup, SYS_COMPONENT_BIT(node->component) << SYS_INIT_FAILED_SHIFT);
+}
+
+bool System::createComponent(SYS_COMPONENT component)
+{
+    //
+    // Each object takes its entry semaphore in the constructor and gives it when it has finished initializing.  We block on it
+    // here rather than coming back to look.
+    //
+    switch (component)
+    {
+    case SYS_COMPONENT::I2C:
+    {
+        if (i2c == nullptr)
+            i2c = new I2C();
+
+        if ((i2c == nullptr) || !xSemaphoreTake(semI2CEntry, initTicksLeft()))
+            return false;
+
+        taskHandleI2CRun = i2c->getRunTaskHandle();
+        queHandleI2CCmdRequest = i2c->getCmdRequestQueue();
+        xSemaphoreGive(semI2CEntry);
+        return true;
+    }
+
+    case SYS_COMPONENT::SPI:
+    {
+        if (spi == nullptr)
+            spi = new SPI(SPI2_HOST, 11, 12, 10); // MOSI_Pin, MISO_Pin, Clock_Pin
+
+        if ((spi == nullptr) || !xSemaphoreTake(semSPIEntry, initTicksLeft()))
+            return false;
+
+        taskHandleSPIRun = spi->getRunTaskHandle();
+        queHandleSPICmdRequest = spi->getCmdRequestQueue();
+        xSemaphoreGive(semSPIEntry);
+        return true;
+    }
+
+    case SYS_COMPONENT::Display:
+    {
+        if (disp == nullptr)
+            disp = new Display();
+
+        if ((disp == nullptr) || !xSemaphoreTake(semDisplayEntry, initTicksLeft()))
+            return false;
+
+        taskHandleDisplayRun = disp->getRunTaskHandle();
+        queHandleDisplayCmdRequest = disp->getCmdRequestQueue();
+        xSemaphoreGive(semDisplayEntry);
+        return true;
+    }
+
+    case SYS_COMPONENT::Wifi:
+    {
+        if (wifi == nullptr)
+            wifi = new Wifi();
+
+        if ((wifi == nullptr) || !xSemaphoreTake(semWifiEntry, initTicksLeft()))
+            return false;
+
+        taskHandleWIFIRun = wifi->getRunTaskHandle();
+        queHandleWIFICmdRequest = wifi->getCmdRequestQueue();
+        xSemaphoreGive(semWifiEntry);
+        return true;
+    }
+
+    case SYS_COMPONENT::Count:
+        break;
+    }
+    return false;
+}
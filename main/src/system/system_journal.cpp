@@ -0,0 +1,186 @@
+#include "system_.hpp"
+
+#include "esp_check.h"
+#include "esp_rom_crc.h"
+#include "spi_flash_mmap.h"
+
+/* External Semaphores */
+extern SemaphoreHandle_t semSysRouteLock;
+
+//
+// The Logging journal in RTC memory holds the most recent ERROR and WARN entries across a crash.  Here we copy those entries
+// into the errlog partition so they also survive a power cycle and can be sent somewhere after the next boot.
+//
+// Flash is written append-only, one record after another, round and round the partition.  A sector is erased only just
+// before we write its first record, so every sector wears at the same rate.  Entries are flushed in batches (see
+// journalFlushDue()), so a burst of errors turns into a single write instead of a write storm.
+//
+void System::openErrorJournal(void)
+{
+    SYS_JournalRecord record = {};
+    uint32_t newestSequence = 0;
+    bool haveRecords = false;
+
+    journalPartition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)JOURNAL_PARTITION_SUBTYPE, JOURNAL_PARTITION_NAME);
+
+    if (journalPartition == nullptr)
+    {
+        ESP_LOGE(TAG, "openErrorJournal(): No %s partition.  Errors are kept in RTC memory only.", JOURNAL_PARTITION_NAME);
+        return;
+    }
+
+    journalSlotCount = journalPartition->size / sizeof(SYS_JournalRecord);
+    journalWriteSlot = 0;
+
+    for (uint32_t slot = 0; slot < journalSlotCount; slot++) // Find the newest record.  We write just after it.
+    {
+        if (esp_partition_read(journalPartition, slot * sizeof(SYS_JournalRecord), &record, sizeof(record)) != ESP_OK)
+            continue;
+
+        if ((record.magic != JOURNAL_RECORD_MAGIC) || (record.crc != esp_rom_crc32_le(0, (uint8_t *)&record, offsetof(SYS_JournalRecord, crc))))
+            continue;
+
+        if (!haveRecords || ((int32_t)(record.sequence - newestSequence) > 0))
+        {
+            haveRecords = true;
+            newestSequence = record.sequence;
+            journalWriteSlot = (slot + 1) % journalSlotCount;
+        }
+    }
+
+    if (haveRecords)
+        journalSequence = newestSequence + 1;
+
+    //
+    // If power failed during a write, the next slot may hold a partial record.  We can't write over it without an erase,
+    // so move on to the start of the next sector, which is erased just before it is used.
+    //
+    if ((journalWriteSlot % (SPI_FLASH_SEC_SIZE / sizeof(SYS_JournalRecord))) != 0)
+    {
+        if ((esp_partition_read(journalPartition, journalWriteSlot * sizeof(SYS_JournalRecord), &record, sizeof(record)) != ESP_OK) || (record.magic != 0xFFFFFFFF))
+        {
+            journalWriteSlot += (SPI_FLASH_SEC_SIZE / sizeof(SYS_JournalRecord)) - (journalWriteSlot % (SPI_FLASH_SEC_SIZE / sizeof(SYS_JournalRecord)));
+            journalWriteSlot %= journalSlotCount;
+        }
+    }
+}
+
+void System::recoverErrorJournal(esp_reset_reason_t reason, bool journalSurvived)
+{
+    LOG_JournalEntry entry = {};
+    uint32_t head = LOG_ErrorJournal::getJournalHead();
+    uint32_t shown = 0;
+
+    if (journalSurvived && (head > 0))
+    {
+        ESP_LOGW(TAG, "Last errors before reset %d (RTC journal, %ld lost):", (int)reason, LOG_ErrorJournal::getJournalLost());
+
+        for (uint32_t position = head - ((head < JOURNAL_RECOVER_COUNT) ? head : JOURNAL_RECOVER_COUNT); position != head; position++)
+        {
+            if (LOG_ErrorJournal::getJournalEntry(position, &entry))
+            {
+                ESP_LOGW(TAG, "  (%ld) %s: %s", entry.timeStamp, entry.tag, entry.msg);
+                shown++;
+            }
+        }
+    }
+
+    if (shown == 0) // Nothing in RTC memory (power was lost), so show what we kept in flash.
+        printErrorJournal(JOURNAL_RECOVER_COUNT);
+
+    if (reason != ESP_RST_BROWNOUT) // Keep the evidence now.  After a brownout, the supply may still be too weak for a flash write.
+        flushErrorJournal();
+}
+
+bool System::journalFlushDue(void)
+{
+    LOG_JournalEntry entry = {};
+    uint32_t flushed = LOG_ErrorJournal::getJournalFlushed();
+    uint32_t pending = LOG_ErrorJournal::getJournalHead() - flushed;
+
+    if (pending == 0)
+        return false;
+
+    if (pending >= JOURNAL_FLUSH_BATCH)
+        return true;
+
+    if (!LOG_ErrorJournal::getJournalEntry(flushed, &entry)) // Damaged or overwritten.  A flush will step past it.
+        return true;
+
+    return ((esp_log_timestamp() - entry.timeStamp) >= (JOURNAL_FLUSH_MAX_AGE_SECS * 1000));
+}
+
+void System::flushErrorJournal(void)
+{
+    LOG_TraceSpan span("System::flushErrorJournal");
+
+    esp_err_t ret = ESP_OK;
+    uint32_t recordsPerSector = SPI_FLASH_SEC_SIZE / sizeof(SYS_JournalRecord);
+    uint32_t position = LOG_ErrorJournal::getJournalFlushed();
+    uint32_t head = LOG_ErrorJournal::getJournalHead();
+    uint32_t count = 0;
+    uint32_t done = 0;
+    uint32_t length = 0;
+
+    if (journalPartition == nullptr)
+        return;
+
+    while ((position != head) && (count < LOG_JOURNAL_SLOTS)) // Gather one batch
+    {
+        if (LOG_ErrorJournal::getJournalEntry(position, &journalBuffer[count].entry))
+        {
+            journalBuffer[count].magic = JOURNAL_RECORD_MAGIC;
+            journalBuffer[count].sequence = journalSequence++;
+            journalBuffer[count].bootCount = bootCount;
+            journalBuffer[count].crc = esp_rom_crc32_le(0, (uint8_t *)&journalBuffer[count], offsetof(SYS_JournalRecord, crc));
+            count++;
+        }
+        position++;
+    }
+
+    while (done < count) // Write the batch with as few calls as possible, erasing each sector just before its first record.
+    {
+        if ((journalWriteSlot % recordsPerSector) == 0)
+            ESP_GOTO_ON_ERROR(esp_partition_erase_range(journalPartition, journalWriteSlot * sizeof(SYS_JournalRecord), SPI_FLASH_SEC_SIZE), sys_flushErrorJournal_err, TAG, "esp_partition_erase_range() failed");
+
+        length = recordsPerSector - (journalWriteSlot % recordsPerSector); // Stop at the end of this sector
+        if (length > (count - done))
+            length = count - done;
+
+        ESP_GOTO_ON_ERROR(esp_partition_write(journalPartition, journalWriteSlot * sizeof(SYS_JournalRecord), &journalBuffer[done], length * sizeof(SYS_JournalRecord)), sys_flushErrorJournal_err, TAG, "esp_partition_write() failed");
+
+        done += length;
+        journalWriteSlot = (journalWriteSlot + length) % journalSlotCount;
+    }
+
+    LOG_ErrorJournal::setJournalFlushed(position);
+    return;
+
+sys_flushErrorJournal_err:
+    errMsg = std::string(__func__) + "(): " + esp_err_to_name(ret);
+    ESP_LOGE(TAG, "%s", errMsg.c_str()); // Not through logByValue(), or this error would go straight back into the journal.
+}
+
+void System::printErrorJournal(uint8_t count)
+{
+    SYS_JournalRecord record = {};
+    uint32_t slot = journalWriteSlot;
+    uint8_t shown = 0;
+
+    if (journalPartition == nullptr)
+        return;
+
+    for (uint32_t i = 0; (i < journalSlotCount) && (shown < count); i++) // Walk backwards from the newest record
+    {
+        slot = (slot == 0) ? (journalSlotCount - 1) : (slot - 1);
+
+        if (esp_partition_read(journalPartition, slot * sizeof(SYS_JournalRecord), &record, sizeof(record)) != ESP_OK)
+            continue;
+
+        if ((record.magic != JOURNAL_RECORD_MAGIC) || (record.crc != esp_rom_crc32_le(0, (uint8_t *)&record, offsetof(SYS_JournalRecord, crc))))
+            continue;
+
+        ESP_LOGW(TAG, "  #%ld boot %ld (%ld) %s: %s", record.sequence, record.bootCount, record.entry.timeStamp, record.entry.tag, record.entry.msg);
+        shown++;
+    }
+}
@@ -0,0 +1,220 @@
+#include "system_.hpp"
+
+#include <algorithm>
+
+/* External Semaphores */
+extern SemaphoreHandle_t semSysRouteLock;
+
+//
+// Every five seconds we read all the FreeRTOS run time counters with uxTaskGetSystemState() and keep, for each task, the share
+// of one core it used since the last sample.  Core load is taken from the two IDLE tasks.  One sample costs a short scheduler
+// suspension and no heap, so this can stay on in production.  Compare printRunTimeStats(), which we only use by hand.
+//
+// Needs CONFIG_FREERTOS_USE_TRACE_FACILITY and CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS (see sdkconfig.defaults).
+//
+void System::sampleTaskLoad(void)
+{
+    LOG_TraceSpan span("System::sampleTaskLoad");
+
+#if ((configUSE_TRACE_FACILITY == 1) && (configGENERATE_RUN_TIME_STATS == 1))
+    configRUN_TIME_COUNTER_TYPE total = 0;
+    configRUN_TIME_COUNTER_TYPE elapsed = 0;
+    UBaseType_t count = uxTaskGetSystemState(loadStatus, LOAD_MAX_TASKS, &total);
+    uint32_t index = loadSamples % LOAD_HISTORY;
+    bool seen[LOAD_MAX_TASKS] = {};
+    TaskHandle_t idle[portNUM_PROCESSORS] = {};
+    int slot = -1;
+
+    for (int core = 0; core < portNUM_PROCESSORS; core++)
+        idle[core] = xTaskGetIdleTaskHandleForCore(core);
+
+    if (count == 0) // More tasks than LOAD_MAX_TASKS.  Nothing is filled in.
+    {
+        LOG_LIMITED(ESP_LOG_WARN, semSysRouteLock, TAG, "More than %d tasks.  Increase LOAD_MAX_TASKS.", LOAD_MAX_TASKS);
+        return;
+    }
+
+    elapsed = total - loadLastTotal;
+    loadLastTotal = total;
+
+    portENTER_CRITICAL(&loadLock);
+    for (UBaseType_t i = 0; i < count; i++)
+    {
+        slot = -1;
+        for (int j = 0; j < LOAD_MAX_TASKS; j++) // Find the task, or the first free slot for a new one
+        {
+            if (loadTasks[j].taskNumber == loadStatus[i].xTaskNumber)
+            {
+                slot = j;
+                break;
+            }
+
+            if ((slot < 0) && (loadTasks[j].taskNumber == 0))
+                slot = j;
+        }
+
+        if (slot < 0)
+            continue;
+
+        if (loadTasks[slot].taskNumber != loadStatus[i].xTaskNumber) // New task.  Its first delta starts now.
+        {
+            loadTasks[slot] = {};
+            loadTasks[slot].taskNumber = loadStatus[i].xTaskNumber;
+            strlcpy(loadTasks[slot].name, loadStatus[i].pcTaskName, sizeof(loadTasks[slot].name));
+            loadTasks[slot].lastCounter = loadStatus[i].ulRunTimeCounter;
+        }
+
+        loadTasks[slot].core = loadStatus[i].xCoreID;
+
+        if ((loadSamples > 0) && (elapsed > 0))
+            loadTasks[slot].permille[index] = (uint16_t)(((uint64_t)(loadStatus[i].ulRunTimeCounter - loadTasks[slot].lastCounter) * 1000) / elapsed);
+        else
+            loadTasks[slot].permille[index] = LOAD_UNKNOWN;
+
+        loadTasks[slot].lastCounter = loadStatus[i].ulRunTimeCounter;
+        seen[slot] = true;
+
+        for (int core = 0; core < portNUM_PROCESSORS; core++)
+        {
+            if (loadStatus[i].xHandle == idle[core])
+                loadCores[index][core] = (loadTasks[slot].permille[index] == LOAD_UNKNOWN) ? LOAD_UNKNOWN : (1000 - std::min<uint16_t>(loadTasks[slot].permille[index], 1000));
+        }
+    }
+
+    for (int j = 0; j < LOAD_MAX_TASKS; j++) // Tasks which have gone away free their slots
+    {
+        if (!seen[j])
+            loadTasks[j].taskNumber = 0;
+    }
+
+    loadSamples++;
+    portEXIT_CRITICAL(&loadLock);
+#endif
+}
+
+uint16_t System::getTaskLoad(const char *name, uint8_t samplesBack)
+{
+    uint16_t permille = LOAD_UNKNOWN;
+
+    portENTER_CRITICAL(&loadLock);
+    if ((samplesBack < LOAD_HISTORY) && (samplesBack < loadSamples))
+    {
+        for (int j = 0; j < LOAD_MAX_TASKS; j++)
+        {
+            if ((loadTasks[j].taskNumber != 0) && (strncmp(loadTasks[j].name, name, sizeof(loadTasks[j].name)) == 0))
+            {
+                permille = loadTasks[j].permille[(loadSamples - 1 - samplesBack) % LOAD_HISTORY];
+                break;
+            }
+        }
+    }
+    portEXIT_CRITICAL(&loadLock);
+    return permille;
+}
+
+uint16_t System::getCoreLoad(uint8_t core, uint8_t samplesBack)
+{
+    uint16_t permille = LOAD_UNKNOWN;
+
+    portENTER_CRITICAL(&loadLock);
+    if ((core < portNUM_PROCESSORS) && (samplesBack < LOAD_HISTORY) && (samplesBack < loadSamples))
+        permille = loadCores[(loadSamples - 1 - samplesBack) % LOAD_HISTORY][core];
+    portEXIT_CRITICAL(&loadLock);
+    return permille;
+}
+
+uint16_t System::getTaskLoadAverage(const char *name, uint8_t samples)
+{
+    uint32_t sum = 0;
+    uint8_t valid = 0;
+
+    for (uint8_t back = 0; back < samples; back++)
+    {
+        uint16_t permille = getTaskLoad(name, back);
+
+        if (permille != LOAD_UNKNOWN)
+        {
+            sum += permille;
+            valid++;
+        }
+    }
+    return (valid > 0) ? (uint16_t)(sum / valid) : LOAD_UNKNOWN;
+}
+
+uint16_t System::getCoreLoadAverage(uint8_t core, uint8_t samples)
+{
+    uint32_t sum = 0;
+    uint8_t valid = 0;
+
+    for (uint8_t back = 0; back < samples; back++)
+    {
+        uint16_t permille = getCoreLoad(core, back);
+
+        if (permille != LOAD_UNKNOWN)
+        {
+            sum += permille;
+            valid++;
+        }
+    }
+    return (valid > 0) ? (uint16_t)(sum / valid) : LOAD_UNKNOWN;
+}
+
+uint32_t System::getLoadSamples(void)
+{
+    uint32_t samples = 0;
+
+    portENTER_CRITICAL(&loadLock);
+    samples = loadSamples;
+    portEXIT_CRITICAL(&loadLock);
+    return samples;
+}
+
+void System::printTaskLoad(void)
+{
+    SYS_LoadTask task = {};
+    uint32_t samples = 0;
+    uint32_t sum = 0;
+    uint16_t peak = 0;
+    uint8_t valid = 0;
+
+    printf("...................................................\n");
+    printf("  Core load now:  ");
+    for (int core = 0; core < portNUM_PROCESSORS; core++)
+    {
+        if (getCoreLoad(core) != LOAD_UNKNOWN)
+            printf("  core%d %5.1f%%", core, getCoreLoad(core) / 10.0);
+    }
+    printf("\n  name         core   now %%   avg %%   peak %%   (last %d samples)\n", LOAD_HISTORY);
+
+    for (int j = 0; j < LOAD_MAX_TASKS; j++)
+    {
+        portENTER_CRITICAL(&loadLock); // Copy one slot at a time.  printf() can't run inside a critical section.
+        task = loadTasks[j];
+        samples = loadSamples;
+        portEXIT_CRITICAL(&loadLock);
+
+        if ((task.taskNumber == 0) || (samples == 0))
+            continue;
+
+        sum = 0;
+        peak = 0;
+        valid = 0;
+        for (uint32_t back = 0; (back < LOAD_HISTORY) && (back < samples); back++)
+        {
+            uint16_t permille = task.permille[(samples - 1 - back) % LOAD_HISTORY];
+            if (permille == LOAD_UNKNOWN)
+                continue;
+
+            sum += permille;
+            peak = std::max(peak, permille);
+            valid++;
+        }
+
+        if (valid == 0)
+            continue;
+
+        printf("  %-10s   %-4s  %5.1f   %5.1f   %5.1f\n", task.name, (task.core == tskNO_AFFINITY) ? "any" : (task.core == 0) ? "0" : "1",
+               (task.permille[(samples - 1) % LOAD_HISTORY] == LOAD_UNKNOWN) ? 0.0 : task.permille[(samples - 1) % LOAD_HISTORY] / 10.0, (sum / valid) / 10.0, peak / 10.0);
+    }
+    printf("...................................................\n");
+}
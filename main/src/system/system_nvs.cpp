@@ -13,6 +13,8 @@ extern SemaphoreHandle_t semNVSEntry;
 
 void System::restoreVariablesFromNVS()
 {
+    LOG_TraceSpan span("System::restoreVariablesFromNVS");
+
     esp_err_t ret = ESP_OK;
     bool successFlag = true;
     uint8_t temp = 0;
@@ -24,7 +26,7 @@ void System::restoreVariablesFromNVS()
         ESP_GOTO_ON_ERROR(nvs->openNVSStorage("system"), sys_restoreVariablesFromNVS_err, TAG, "nvs->openNVSStorage('system') failed");
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): system namespace start");
+        LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): system namespace start");
 
     if (successFlag) // Restore runStackSizeK
     {
@@ -33,20 +35,20 @@ void System::restoreVariablesFromNVS()
 
         if (ret == ESP_OK)
         {
-            if (temp > runStackSizeK) // Ok to use any value greater than the default size.
+            if ((temp != runStackSizeK) && LOG_Tasks::stackSizeKValid(temp, runStackSizeK)) // The stack tuner may have grown the default.  See LOG_Tasks::stackSizeKValid().
             {
                 runStackSizeK = temp;
                 ret = nvs->writeU8IntegerToNVS("runStackSizeK", runStackSizeK); // Over-write the value with the default minumum value.
             }
 
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): runStackSizeK       is " + std::to_string(runStackSizeK));
+                LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): runStackSizeK       is " + std::to_string(runStackSizeK));
         }
 
         if (ret != ESP_OK)
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore runStackSizeK");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore runStackSizeK");
         }
     }
 
@@ -57,20 +59,20 @@ void System::restoreVariablesFromNVS()
 
         if (ret == ESP_OK)
         {
-            if (temp > gpioStackSizeK) // Ok to use any value greater than the default size.
+            if ((temp != gpioStackSizeK) && LOG_Tasks::stackSizeKValid(temp, gpioStackSizeK)) // Tuned like runStackSizeK
             {
                 gpioStackSizeK = temp;
                 ret = nvs->writeU8IntegerToNVS("gpioStackSizeK", gpioStackSizeK); // Over-write the value with the default minumum value.
             }
 
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): gpioStackSizeK      is " + std::to_string(gpioStackSizeK));
+                LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): gpioStackSizeK      is " + std::to_string(gpioStackSizeK));
         }
 
         if (ret != ESP_OK)
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore gpioStackSizeK");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore gpioStackSizeK");
         }
     }
 
@@ -81,20 +83,35 @@ void System::restoreVariablesFromNVS()
 
         if (ret == ESP_OK)
         {
-            if (temp > timerStackSizeK) // Ok to use any value greater than the default size.
+            if ((temp != timerStackSizeK) && LOG_Tasks::stackSizeKValid(temp, timerStackSizeK)) // Tuned like runStackSizeK
             {
                 timerStackSizeK = temp;
                 ret = nvs->writeU8IntegerToNVS("timerStackSizeK", timerStackSizeK); // Over-write the value with the default minumum value.
             }
 
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): timerStackSizeK      is " + std::to_string(timerStackSizeK));
+                LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): timerStackSizeK      is " + std::to_string(timerStackSizeK));
         }
 
         if (ret != ESP_OK)
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore timerStackSizeK");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore timerStackSizeK");
+        }
+    }
+
+    if (successFlag) // Restore taskPlan
+    {
+        SYS_TaskPlacement plan[(int)SYS_TASK::Count] = {};
+        size_t length = sizeof(plan);
+
+        // Only saved when a plan other than the built in one is chosen.  One of the wrong size or out of range is ignored.
+        if ((nvs->readBlobFromNVS("taskPlan", plan, &length) == ESP_OK) && (length == sizeof(plan)))
+        {
+            if (!applyTaskPlan(plan))
+                LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error, taskPlan is out of range.  Using the built in plan.");
+            else if (show & _showNVS)
+                LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): taskPlan            is layout " + std::to_string(getTaskLayout()));
         }
     }
 
@@ -103,32 +120,32 @@ void System::restoreVariablesFromNVS()
         if (nvs->readU32IntegerFromNVS("bootCount", &bootCount) == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): bootCount           is " + std::to_string(bootCount));
+                LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): bootCount           is " + std::to_string(bootCount));
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore bootCount. Error = " + esp_err_to_name(ret));
+            LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error, Unable to restore bootCount. Error = " + esp_err_to_name(ret));
         }
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): system name end");
+        LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): system name end");
 
     if (successFlag)
     {
         if (show & _showNVS)
-            logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): Succeeded");
+            LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): Succeeded");
     }
     else
-        logByValue(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): restoreVariablesFromNVS Failed");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): restoreVariablesFromNVS Failed");
 
     nvs->closeNVStorage();
     xSemaphoreGive(semNVSEntry);
     return;
 
 sys_restoreVariablesFromNVS_err:
-    logByValue(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
     xSemaphoreGive(semNVSEntry);
 }
 
@@ -148,19 +165,19 @@ void System::saveVariablesToNVS()
         ESP_GOTO_ON_ERROR(nvs->openNVSStorage("system"), sys_saveVariablesToNVS_err, TAG, "nvs->openNVSStorage('system') failed");
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): system namespace start");
+        LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): system namespace start");
 
     if (successFlag) // Save runStackSizeK
     {
         if (nvs->writeU8IntegerToNVS("runStackSizeK", runStackSizeK) == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): runStackSizeK       = " + std::to_string(runStackSizeK));
+                LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): runStackSizeK       = " + std::to_string(runStackSizeK));
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Unable to writeU8IntegerToNVS runStackSizeK");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Unable to writeU8IntegerToNVS runStackSizeK");
         }
     }
 
@@ -169,12 +186,12 @@ void System::saveVariablesToNVS()
         if (nvs->writeU8IntegerToNVS("gpioStackSizeK", gpioStackSizeK) == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): gpioStackSizeK      = " + std::to_string(gpioStackSizeK));
+                LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): gpioStackSizeK      = " + std::to_string(gpioStackSizeK));
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Unable to writeU8IntegerToNVS gpioStackSizeK");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Unable to writeU8IntegerToNVS gpioStackSizeK");
         }
     }
 
@@ -183,12 +200,12 @@ void System::saveVariablesToNVS()
         if (nvs->writeU8IntegerToNVS("timerStackSizeK", timerStackSizeK) == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): timerStackSizeK     = " + std::to_string(timerStackSizeK));
+                LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): timerStackSizeK     = " + std::to_string(timerStackSizeK));
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Unable to writeU8IntegerToNVS timerStackSizeK");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Unable to writeU8IntegerToNVS timerStackSizeK");
         }
     }
 
@@ -197,31 +214,75 @@ void System::saveVariablesToNVS()
         if (nvs->writeU32IntegerToNVS("bootCount", bootCount) == ESP_OK)
         {
             if (show & _showNVS)
-                logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): bootCount           = " + std::to_string(bootCount));
+                LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): bootCount           = " + std::to_string(bootCount));
         }
         else
         {
             successFlag = false;
-            logByValue(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Unable to writeU32IntegerToNVS bootCount");
+            LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Unable to writeU32IntegerToNVS bootCount");
         }
     }
 
     if (show & _showNVS)
-        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): system namespace end");
+        LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): system namespace end");
 
     if (successFlag)
     {
         if (show & _showNVS)
-            logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): saveVariablesToNVS Succeeded");
+            LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): saveVariablesToNVS Succeeded");
     }
     else if (show & _showNVS)
-        logByValue(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): saveVariablesToNVS Failed");
+        LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): saveVariablesToNVS Failed");
 
     nvs->closeNVStorage();
     xSemaphoreGive(semNVSEntry);
     return;
 
 sys_saveVariablesToNVS_err:
-    logByValue(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
+    LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
+    xSemaphoreGive(semNVSEntry);
+}
+
+void System::tuneTaskStacks()
+{
+    //
+    // Every object with a tunable stack registered a pointer to its stack size and the NVS key it restores it from.  When the
+    // registry recommends a new size, we write it straight into that object's namespace and into the object's own copy, so a
+    // later saveVariablesToNVS() by the owner writes the same value.  The new size takes effect on the next boot.
+    //
+    esp_err_t ret = ESP_OK;
+    LOG_TaskEntry entry = {};
+    uint8_t tunedK = 0;
+
+    for (uint8_t i = 0; i < LOG_TASK_SLOTS; i++)
+    {
+        if (!LOG_Tasks::getTaskEntry(i, &entry))
+            continue;
+
+        tunedK = LOG_Tasks::getTunedStackSizeK(&entry);
+        if (tunedK == 0)
+            continue;
+
+        if (xSemaphoreTake(semNVSEntry, portMAX_DELAY))
+        {
+            ESP_GOTO_ON_ERROR(nvs->openNVSStorage(entry.nvsNamespace), sys_tuneTaskStacks_err, TAG, "nvs->openNVSStorage() failed");
+            ret = nvs->writeU8IntegerToNVS(entry.nvsKey, tunedK);
+            nvs->closeNVStorage();
+            xSemaphoreGive(semNVSEntry);
+        }
+
+        if (ret == ESP_OK)
+        {
+            LOG_PRINTF(ESP_LOG_WARN, semSysRouteLock, TAG, "%s %s/%s %dK -> %dK (deepest use %ld of %ld bytes)", entry.name, entry.nvsNamespace, entry.nvsKey,
+                       *entry.stackSizeK, tunedK, entry.stackBytes - entry.minFreeBytes, entry.stackBytes);
+            *entry.stackSizeK = tunedK;
+        }
+        else
+            LOG_PRINTF(ESP_LOG_ERROR, semSysRouteLock, TAG, "Unable to save %s/%s.  Error = %s", entry.nvsNamespace, entry.nvsKey, esp_err_to_name(ret));
+    }
+    return;
+
+sys_tuneTaskStacks_err:
+    LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
     xSemaphoreGive(semNVSEntry);
 }
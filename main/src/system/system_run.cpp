@@ -13,12 +13,13 @@ extern SemaphoreHandle_t semI2CEntry;
 extern SemaphoreHandle_t semWifiEntry;
 
 extern SemaphoreHandle_t semSysRouteLock;
-extern SemaphoreHandle_t semSysUint8Lock;
 
 void System::runMarshaller(void *arg)
 {
+    LOG_Heap::setTaskHeapTag(LOG_HEAP_TAG::System);
     ((System *)arg)->run();
     ((System *)arg)->taskHandleSystemRun = nullptr; // This doesn't happen automatically but we look at this variable for validity, so set it manually.
+    LOG_Tasks::unregisterTask(nullptr);
     vTaskDelete(NULL);
 }
 
@@ -27,79 +28,122 @@ void System::run(void)
     esp_err_t ret = ESP_OK;
     // int8_t oneSecCounter = 6;
 
+    uint32_t sysNotifyPending = 0;
+
+    uint32_t heapAllocsAtPass = 0; // A quiet Run pass (nothing received, nothing pending) must not allocate.
+    bool quietPass = false;        //
+
     while (true)
     {
+        LOG_Tasks::heartbeat((uint8_t)sysOP, (sysOP == SYS_OP::Idle) ? LOG_HEARTBEAT_IDLE_MS : LOG_HEARTBEAT_MS); // Watched by superviseRunLoops()
+
         switch (sysOP)
         {
-        case SYS_OP::Run: // We would like to achieve about a 4Hz entry cadence in the Run state.
+        case SYS_OP::Run:
         {
+            //
+            // We sleep until there is something to do.  Everything that gives us work wakes us through our task notification:
+            // a SYS_NOTIFY code from another object, SYS_WAKE_COMMAND from sendCmdRequest(), or SYS_WAKE_PENDING when the timer
+            // raises a pending action with setPending().  The timer raises the heap check slice every second, so a healthy loop
+            // still beats well inside LOG_HEARTBEAT_MS.
+            //
+            sysNotifyBits = 0;
+            xTaskNotifyWait(0, UINT32_MAX, &sysNotifyBits, runWaitTicks);
+            runWaitTicks = portMAX_DELAY;
+
             /*  Service all Task Notifications */
             /* Task Notifications should be used for notifications or commands which need no input and return no data. */
-            sysTaskNotifyValue = static_cast<SYS_NOTIFY>(ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(250))); // Wait 250 mSec for any notifications then move on.
+            sysNotifyPending = sysNotifyBits & SYS_NOTIFY_CODE_MASK;
 
-            if (sysTaskNotifyValue > static_cast<SYS_NOTIFY>(0)) // We are not using commands right now, so there is no value is waiting here.
+            heapAllocsAtPass = LOG_Heap::getTaskHeapAllocs();
+            quietPass = (sysNotifyBits == 0);
+
+            if (sysNotifyPending != 0) // Every SYS_NOTIFY bit sent since our last pass is handled now
             {
-                switch (sysTaskNotifyValue)
-                {
-                case SYS_NOTIFY::NFY_WIFI_CONNECTING:
-                {
-                    if (show & _showRun)
-                       logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_NOTIFY::NFY_WIFI_CONNECTING"); // Tell all parties who care that Internet is available.
-                    sysWifiConnState = WIFI_CONN_STATE::WIFI_CONNECTING_STA;
-                    break;
-                }
+                LOG_Latency::latencyNotified(LOG_LAT_SOURCE::System, sysNotifyPending);
 
-                case SYS_NOTIFY::NFY_WIFI_CONNECTED:
+                while (sysNotifyPending != 0)
                 {
-                    if (show & _showRun)
-                        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_NOTIFY::NFY_WIFI_CONNECTED"); // Tell all parties who care that Internet is available.
-                    sysWifiConnState = WIFI_CONN_STATE::WIFI_CONNECTED_STA;
-                    break;
-                }
+                    sysTaskNotifyValue = takeNotify(&sysNotifyPending); // Wifi events in lifecycle order
 
-                case SYS_NOTIFY::NFY_WIFI_DISCONNECTING:
-                {
-                    if (show & _showRun)
-                        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_NOTIFY::NFY_WIFI_DISCONNECTING"); // Tell all parties who care that the Internet is not avaiable.
-                    sysWifiConnState = WIFI_CONN_STATE::WIFI_DISCONNECTING_STA;
-                    break;
-                }
+                    switch (sysTaskNotifyValue)
+                    {
+                    case SYS_NOTIFY::NFY_WIFI_CONNECTING:
+                    {
+                        if (show & _showRun)
+                           LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "SYS_NOTIFY::NFY_WIFI_CONNECTING"); // Tell all parties who care that Internet is available.
+                        sysWifiConnState = WIFI_CONN_STATE::WIFI_CONNECTING_STA;
+                        publishConnectivity();
+                        break;
+                    }
 
-                case SYS_NOTIFY::NFY_WIFI_DISCONNECTED:
-                {
-                    if (show & _showRun)
-                        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_NOTIFY::NFY_WIFI_DISCONNECTED"); // Wifi is competlely ready to be connected again.
-                    sysWifiConnState = WIFI_CONN_STATE::WIFI_DISCONNECTED;
-                    break;
-                }
+                    case SYS_NOTIFY::NFY_WIFI_CONNECTED:
+                    {
+                        if (show & _showRun)
+                            LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "SYS_NOTIFY::NFY_WIFI_CONNECTED"); // Tell all parties who care that Internet is available.
+                        sysWifiConnState = WIFI_CONN_STATE::WIFI_CONNECTED_STA;
+                        publishConnectivity();
+
+                        bootMark(SYS_BOOT_MARK::Network_Up);
+                        if (!bootProfileSaved.get())
+                            bootProfileFlag.set(true);
+
+                        if ((strlen(LOG_STREAM_COLLECTOR_IP) > 0) && !LOG_Stream::startLogStream(LOG_STREAM_COLLECTOR_IP, LOG_STREAM_COLLECTOR_PORT))
+                            LOG_PRINTF(ESP_LOG_ERROR, semSysRouteLock, TAG, "Log stream collector address %s is not valid", LOG_STREAM_COLLECTOR_IP);
+                        break;
+                    }
 
-                case SYS_NOTIFY::CMD_DESTROY_WIFI:
-                {
-                    if (show & _showRun)
-                        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_NOTIFY::WIFI_SHUTDOWN");
+                    case SYS_NOTIFY::NFY_WIFI_DISCONNECTING:
+                    {
+                        if (show & _showRun)
+                            LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "SYS_NOTIFY::NFY_WIFI_DISCONNECTING"); // Tell all parties who care that the Internet is not avaiable.
+                        sysWifiConnState = WIFI_CONN_STATE::WIFI_DISCONNECTING_STA;
+                        publishConnectivity();
+                        LOG_Stream::stopLogStream(); // Stop before the network goes, or the last frames are lost
+                        break;
+                    }
 
-                    if (wifi != nullptr)
+                    case SYS_NOTIFY::NFY_WIFI_DISCONNECTED:
                     {
-                        if (semWifiEntry != nullptr)
+                        if (show & _showRun)
+                            LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "SYS_NOTIFY::NFY_WIFI_DISCONNECTED"); // Wifi is competlely ready to be connected again.
+                        sysWifiConnState = WIFI_CONN_STATE::WIFI_DISCONNECTED;
+                        publishConnectivity();
+                        break;
+                    }
+
+                    case SYS_NOTIFY::CMD_DESTROY_WIFI:
+                    {
+                        if (show & _showRun)
+                            LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "SYS_NOTIFY::WIFI_SHUTDOWN");
+
+                        if (wifi != nullptr)
                         {
-                            xSemaphoreTake(semWifiEntry, portMAX_DELAY); // Wait here until we gain the lock.
+                            if (semWifiEntry != nullptr)
+                            {
+                                xSemaphoreTake(semWifiEntry, portMAX_DELAY); // Wait here until we gain the lock.
 
-                            // Send out notifications to any object that uses the wifi and tell them wifi is no longer available.
+                                if (sysWifiConnState != WIFI_CONN_STATE::WIFI_DISCONNECTED) // Tell every subscriber that wifi is no longer available.
+                                {
+                                    sysWifiConnState = WIFI_CONN_STATE::WIFI_DISCONNECTED;
+                                    publishConnectivity();
+                                }
 
-                            taskHandleWIFIRun = nullptr;       // Clear the wifi task handle
-                            queHandleWIFICmdRequest = nullptr; // Clear the wifi Command Queue handle
+                                taskHandleWIFIRun = nullptr;       // Clear the wifi task handle
+                                queHandleWIFICmdRequest = nullptr; // Clear the wifi Command Queue handle
 
-                            delete wifi;    // Locking the object will be done inside the destructor.
-                            wifi = nullptr; // Destructor will not set pointer null.  We must to do that manually.
+                                delete wifi;    // Locking the object will be done inside the destructor.
+                                wifi = nullptr; // Destructor will not set pointer null.  We must to do that manually.
 
-                            // Note: The semWifiEntry semaphore is already destroyed - so don't "Give" it or a run time error will occur
+                                // Note: The semWifiEntry semaphore is already destroyed - so don't "Give" it or a run time error will occur
 
-                            if (show & _showRun)
-                                logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): wifi deleted");
+                                if (show & _showRun)
+                                    LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "wifi deleted");
+                            }
                         }
+                        break;
+                    }
                     }
-                    break;
-                }
                 }
             }
 
@@ -107,11 +151,14 @@ void System::run(void)
             /* Queue based commands should be used for commands which may provide input or perhaps return data. */
             if (xQueuePeek(systemCmdRequestQue, (void *)&ptrSYSCmdRequest, 0)) // We cycle through here and look for incoming mail box command requests
             {
+                quietPass = false;
+                LOG_Latency::latencyDequeued(LOG_LAT_SOURCE::System, (uint8_t)ptrSYSCmdRequest->requestedCmd, &ptrSYSCmdRequest->stamp);
+
                 if (ptrSYSCmdRequest->stringData != nullptr)
                 {
                     strCmdPayload = *ptrSYSCmdRequest->stringData; // We should always try to copy the payload even if we don't use that payload.
                     if (show & _showPayload)
-                       logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): Payload = " + strCmdPayload);
+                       LOG_PRINTF(ESP_LOG_INFO, semSysRouteLock, TAG, "Payload = %s", strCmdPayload.c_str());
                 }
 
                 switch (ptrSYSCmdRequest->requestedCmd)
@@ -119,24 +166,102 @@ void System::run(void)
                 case SYS_COMMAND::NONE:
                 {
                     if (show & _showRun)
-                        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_COMMAND::NONE");
+                        LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "SYS_COMMAND::NONE");
                     break;
                 }
+
+                case SYS_COMMAND::SET_SHOW_FLAGS:
+                {
+                    if (show & _showRun)
+                        LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "Received the command SYS_COMMAND::SET_SHOW_FLAGS");
+
+                    show = (uint8_t)(ptrSYSCmdRequest->data64bit & 0xFF);
+                    showSys = (uint8_t)((ptrSYSCmdRequest->data64bit >> 8) & 0xFF);
+                    setLogLevels();
+                    break;
                 }
 
+                case SYS_COMMAND::GET_STATS:
+                {
+                    if (show & _showRun)
+                        LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "Received the command SYS_COMMAND::GET_STATS");
+
+                    takeStats(&stats);
+                    ptrSYSResponse->stats = &stats;
+                    ptrSYSResponse->jsonResponse = nullptr;
+                    ptrSYSResponse->responseCode = SYS_STATUS::DATA_OK;
+
+                    if (ptrSYSCmdRequest->data64bit == 1)
+                    {
+                        if (serializeStats(&stats, &statsJson))
+                            ptrSYSResponse->jsonResponse = &statsJson;
+                        else
+                            ptrSYSResponse->responseCode = SYS_STATUS::ERROR; // Larger than SYS_STATS_JSON_SIZE.  The binary form is still good.
+                    }
+
+                    if (ptrSYSCmdRequest->queueToSendResponse != nullptr)
+                        xQueueSendToBack(ptrSYSCmdRequest->queueToSendResponse, &ptrSYSResponse, 50);
+                    break;
+                }
+                }
+
+                LOG_Latency::latencyServiced(LOG_LAT_SOURCE::System, (uint8_t)ptrSYSCmdRequest->requestedCmd, &ptrSYSCmdRequest->stamp);
                 xQueueReceive(systemCmdRequestQue, (void *)&ptrSYSCmdRequest, pdMS_TO_TICKS(10));
             }
 
             /* Pending Actions and State Change Actions */
-            if (lockGetBool(&saveToNVSFlag))
+            if (saveToNVSFlag.take())
             {
-                lockSetBool(&saveToNVSFlag, false);
+                quietPass = false;
                 saveVariablesToNVS();
             }
 
-            if (lockGetUint8(&diagSys)) // We may run periodic or commanded diagnostics
+            if (heapCheckFlag.take())
+            {
+                quietPass = false;
+                heapCheckStep();
+            }
+
+            if (loadSampleFlag.take()) // Background CPU load sampler
+            {
+                quietPass = false;
+                sampleTaskLoad();
+            }
+
+            if (stackTuneFlag.take())
+            {
+                quietPass = false;
+                LOG_Tasks::sampleTaskStacks();
+                tuneTaskStacks();
+            }
+
+            if (bootProfileFlag.take()) // Once per boot
+            {
+                quietPass = false;
+                if (!bootProfileSaved.get())
+                    saveBootProfile();
+            }
+
+            if (journalFlushFlag.take()) // Error journal entries go to flash in batches
+            {
+                quietPass = false;
+                flushErrorJournal();
+            }
+
+            if (diagSys.get()) // We may run periodic or commanded diagnostics
+            {
+                quietPass = false;
                 runDiagnostics();
 
+                if (diagSys.get()) // One diagnostic a pass.  Come straight back for the next one.
+                    runWaitTicks = 0;
+            }
+
+            if (quietPass && (sysOP == SYS_OP::Run))
+            {
+                runHeapAllocs.quietPasses++;
+                runHeapAllocs.quietAllocs += LOG_Heap::getTaskHeapAllocs() - heapAllocsAtPass;
+            }
             break;
         }
 
@@ -153,7 +278,9 @@ void System::run(void)
             case SYS_INIT::Start:
             {
                 if (show & _showInit)
-                   logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_INIT::Start");
+                   LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "SYS_INIT::Start");
+
+                bootMark(SYS_BOOT_MARK::Run_Task_Started);
 
                 sysInitStep = SYS_INIT::Power_Down_Unused_Resources;
                 [[fallthrough]];
@@ -177,7 +304,7 @@ void System::run(void)
             case SYS_INIT::Start_Network_Interface:
             {
                 if (show & _showInit)
-                   logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_INIT::Start_Network_Interface - Step " + std::to_string((int)SYS_INIT::Start_Network_Interface));
+                   LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "SYS_INIT::Start_Network_Interface - Step %d", (int)SYS_INIT::Start_Network_Interface);
 
                 ESP_GOTO_ON_ERROR(esp_netif_init(), sys_Start_Network_Interface_err, TAG, "esp_netif_init() failure."); // Network Interface initialization - starts up the TCP/IP stack.
                 sysInitStep = SYS_INIT::Create_Default_Event_Loop;
@@ -192,7 +319,7 @@ void System::run(void)
             case SYS_INIT::Create_Default_Event_Loop:
             {
                 if (show & _showInit)
-                   logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_INIT::Create_Default_Event_Loop - Step " + std::to_string((int)SYS_INIT::Create_Default_Event_Loop));
+                   LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "SYS_INIT::Create_Default_Event_Loop - Step %d", (int)SYS_INIT::Create_Default_Event_Loop);
 
                 ESP_GOTO_ON_ERROR(esp_event_loop_create_default(), sys_Create_Default_Event_Loop_err, TAG, "esp_event_loop_create_default() failure.");
                 sysInitStep = SYS_INIT::Start_GPIO;
@@ -207,20 +334,20 @@ void System::run(void)
             case SYS_INIT::Start_GPIO:
             {
                 if (show & _showInit)
-                   logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_INIT::Start_GPIO - Step " + std::to_string((int)SYS_INIT::Start_GPIO));
+                   LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "SYS_INIT::Start_GPIO - Step %d", (int)SYS_INIT::Start_GPIO);
 
                 initGPIOPins(); // Set up all our pin General Purpose Input Output pin definitions
                 initGPIOTask(); // Assigning ISRs to pins and start GPIO Task
 
                 // NOTE: Timer task will be not be started until System initialization is complete.
-                sysInitStep = SYS_INIT::Create_I2C;
+                sysInitStep = SYS_INIT::Start_Components;
                 break;
             }
 
                 // case SYS_INIT::Create_Speaker:
                 // {
                 // if (show & _showInit)
-                //     logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_INIT::Create_Speaker - Step " + std::to_string((int)SYS_INIT::Create_Speaker));
+                //     LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_INIT::Create_Speaker - Step " + std::to_string((int)SYS_INIT::Create_Speaker));
 
                 // if (speak == nullptr)
                 //     speak = new Speaker();
@@ -228,7 +355,7 @@ void System::run(void)
                 // if (speak != nullptr)
                 // {
                 //     if (show & _showInit)
-                //         logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_INIT::Wait_On_Speaker - Step " + std::to_string((int)SYS_INIT::Wait_On_Speaker));
+                //         LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_INIT::Wait_On_Speaker - Step " + std::to_string((int)SYS_INIT::Wait_On_Speaker));
 
                 //     sysInitStep = SYS_INIT::Wait_On_Speaker;
                 // }
@@ -255,124 +382,43 @@ void System::run(void)
                 // Create_IMU,
                 // Wait_On_IMU,
 
-            case SYS_INIT::Create_I2C:
+            case SYS_INIT::Start_Components:
             {
                 if (show & _showInit)
-                    logByValue(ESP_LOG_INFO, semSysRouteLock, TAG,  std::string(__func__) + "(): SYS_INIT::Create_I2C - Step " + std::to_string((int)SYS_INIT::Create_I2C));
-
-                if (i2c == nullptr)
-                    i2c = new I2C();
-
-                if (i2c != nullptr)
-                {
-                    if (show & _showInit)
-                        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_INIT::Wait_On_I2C - Step " + std::to_string((int)SYS_INIT::Wait_On_I2C));
+                    LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "SYS_INIT::Start_Components - Step %d", (int)SYS_INIT::Start_Components);
 
-                    sysInitStep = SYS_INIT::Wait_On_I2C;
-                }
-                [[fallthrough]];
-            }
-
-            case SYS_INIT::Wait_On_I2C:
-            {
-                if (xSemaphoreTake(semI2CEntry, 100))
+                if (!startComponents())
                 {
-                    taskHandleI2CRun = i2c->getRunTaskHandle();
-                    queHandleI2CCmdRequest = i2c->getCmdRequestQueue();
-                    xSemaphoreGive(semI2CEntry);
-                    sysInitStep = SYS_INIT::Create_SPI;
+                    errMsg = std::string(__func__) + "(): SYS_INIT::Start_Components: error: unable to create the event group";
+                    sysInitStep = SYS_INIT::Error;
+                    break;
                 }
-                break;
-            }
 
-                // Create_SPI,
-                // Wait_On_SPI,
-
-            case SYS_INIT::Create_SPI:
-            {
                 if (show & _showInit)
-                    logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_INIT::Create_SPI - Step " + std::to_string((int)SYS_INIT::Create_SPI));
-
-                if (spi == nullptr)
-                    spi = new SPI(SPI2_HOST, 11, 12, 10); // MOSI_Pin, MISO_Pin, Clock_Pin
-
-                if (spi != nullptr)
-                {
-                    if (show & _showInit)
-                        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_INIT::Wait_On_SPI - Step " + std::to_string((int)SYS_INIT::Wait_On_SPI));
+                    LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "SYS_INIT::Wait_On_Components - Step %d", (int)SYS_INIT::Wait_On_Components);
 
-                    sysInitStep = SYS_INIT::Wait_On_SPI;
-                }
+                sysInitStep = SYS_INIT::Wait_On_Components;
                 [[fallthrough]];
             }
 
-            case SYS_INIT::Wait_On_SPI:
+            case SYS_INIT::Wait_On_Components:
             {
-                if (xSemaphoreTake(semSPIEntry, 100))
-                {
-                    taskHandleSPIRun = spi->getRunTaskHandle();
-                    queHandleSPICmdRequest = spi->getCmdRequestQueue();
-                    xSemaphoreGive(semSPIEntry);
-                    sysInitStep = SYS_INIT::Create_Display;
-                }
-                break;
-            }
-
-            case SYS_INIT::Create_Display:
-            {
-                if (show & _showInit)
-                    logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_INIT::Create_Display - Step " + std::to_string((int)SYS_INIT::Create_Display));
-
-                if (disp == nullptr)
-                    disp = new Display();
-
-                if (disp != nullptr)
-                {
-                    if (show & _showInit)
-                        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_INIT::Wait_On_Display - Step " + std::to_string((int)SYS_INIT::Wait_On_Display));
-
-                    sysInitStep = SYS_INIT::Wait_On_Display;
-                }
-                [[fallthrough]];
-            }
+                uint32_t failed = 0;
 
-            case SYS_INIT::Wait_On_Display:
-            {
-                if (xSemaphoreTake(semDisplayEntry, 100))
+                if (waitOnComponents(&failed))
                 {
-                    taskHandleDisplayRun = disp->getRunTaskHandle();
-                    queHandleDisplayCmdRequest = disp->getCmdRequestQueue();
-                    xSemaphoreGive(semDisplayEntry);
-                    sysInitStep = SYS_INIT::Create_Wifi;
-                }
-                break;
-            }
-
-            case SYS_INIT::Create_Wifi:
-            {
-                if (show & _showInit)
-                    logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_INIT::Create_Wifi - Step " + std::to_string((int)SYS_INIT::Create_Wifi));
-
-                if (wifi == nullptr)
-                    wifi = new Wifi();
+                    if (failed != 0)
+                    {
+                        errMsg = std::string(__func__) + "(): SYS_INIT::Wait_On_Components: error: objects not ready (SYS_COMPONENT bits " + std::to_string(failed) + ")";
+                        sysInitStep = SYS_INIT::Error;
+                        break;
+                    }
 
-                if (wifi != nullptr)
-                {
                     if (show & _showInit)
-                        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_INIT::Wait_On_Wifi - Step " + std::to_string((int)SYS_INIT::Wait_On_Wifi));
+                        LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "Ready (us): I2C %ld  SPI %ld  Display %ld  Wifi %ld", bootProfile.componentUs[(int)SYS_COMPONENT::I2C],
+                                     bootProfile.componentUs[(int)SYS_COMPONENT::SPI], bootProfile.componentUs[(int)SYS_COMPONENT::Display],
+                                     bootProfile.componentUs[(int)SYS_COMPONENT::Wifi]);
 
-                    sysInitStep = SYS_INIT::Wait_On_Wifi;
-                }
-                [[fallthrough]];
-            }
-
-            case SYS_INIT::Wait_On_Wifi:
-            {
-                if (xSemaphoreTake(semWifiEntry, 100))
-                {
-                    taskHandleWIFIRun = wifi->getRunTaskHandle();
-                    queHandleWIFICmdRequest = wifi->getCmdRequestQueue();
-                    xSemaphoreGive(semWifiEntry);
                     sysInitStep = SYS_INIT::Start_System_Timer;
                 }
                 break;
@@ -388,10 +434,11 @@ void System::run(void)
             case SYS_INIT::Finished:
             {
                 if (show & _showInit)
-                    logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): SYS_INIT::Finished");
+                    LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "SYS_INIT::Finished");
 
                 bootCount++;
-                lockSetUint8(&saveToNVSDelaySecs, 2);
+                saveToNVSDelaySecs.set(2);
+                bootInitFinished(); // Step times for the boot profile
 
                 sysOP = SYS_OP::Run;
                 break;
@@ -408,14 +455,14 @@ void System::run(void)
 
         case SYS_OP::Error:
         {
-            logByValue(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + errMsg);
+            LOG_PRINTF(ESP_LOG_ERROR, semSysRouteLock, TAG, "%s", errMsg.c_str());
             sysOP = SYS_OP::Idle;
             break;
         }
 
         case SYS_OP::Idle:
         {
-            logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): Idle...");
+            LOG_DEFERRED(ESP_LOG_INFO, semSysRouteLock, TAG, "Idle...");
             vTaskDelay(pdMS_TO_TICKS(5000));
             break;
         }
@@ -0,0 +1,115 @@
+#include "system_.hpp"
+
+#include <cstdarg>
+
+//
+// SYS_COMMAND::GET_STATS gathers one SYS_Stats and, if asked, its JSON form.  Both live in the System object and are handed
+// out by pointer in ptrSYSResponse, the way I2C hands out its response, so the caller must be done with them before it polls
+// again.  Nothing here allocates: the JSON goes into statsJson, whose capacity was reserved once, and a snapshot which would
+// need more room is cut short instead.
+//
+void System::takeStats(SYS_Stats *snapshot)
+{
+    LOG_TaskEntry entry = {};
+    nvs_stats_t nvsStats = {};
+    QueueHandle_t queues[SYS_STATS_QUEUES] = {systemCmdRequestQue, queHandleWIFICmdRequest, queHandleDisplayCmdRequest, queHandleI2CCmdRequest, queHandleSPICmdRequest};
+
+    *snapshot = {};
+    snapshot->version = SYS_STATS_VERSION;
+    snapshot->size = sizeof(SYS_Stats);
+    snapshot->uptimeSecs = (uint32_t)(esp_timer_get_time() / 1000000);
+    snapshot->bootCount = bootCount;
+
+    snapshot->heapFree = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+    snapshot->heapMinFree = heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+    snapshot->heapLargestFree = heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
+    snapshot->internalFree = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+    snapshot->spiramFree = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+
+    for (uint8_t core = 0; core < portNUM_PROCESSORS; core++)
+        snapshot->coreLoad[core] = getCoreLoad(core);
+
+    for (uint8_t i = 0; i < SYS_STATS_QUEUES; i++)
+        snapshot->queueDepth[i] = (queues[i] != nullptr) ? (uint8_t)uxQueueMessagesWaiting(queues[i]) : 0; // Zero for an object not created yet
+
+    snapshot->wifiConnState = (uint8_t)sysWifiConnState;
+    snapshot->rtosTasks = (uint16_t)uxTaskGetNumberOfTasks();
+
+    if (nvs == nullptr)
+        nvs = NVS::getInstance();
+
+    if (nvs->getNVSStats(&nvsStats) == ESP_OK)
+    {
+        snapshot->nvsUsedEntries = nvsStats.used_entries;
+        snapshot->nvsFreeEntries = nvsStats.free_entries;
+        snapshot->nvsNamespaces = nvsStats.namespace_count;
+    }
+
+    for (uint8_t i = 0; i < LOG_TASK_SLOTS; i++)
+    {
+        if (!LOG_Tasks::getTaskEntry(i, &entry))
+            continue;
+
+        SYS_StatsTask *task = &snapshot->tasks[snapshot->taskCount++];
+        strlcpy(task->name, entry.name, sizeof(task->name));
+        task->stackBytes = entry.stackBytes;
+        task->minFreeBytes = entry.minFreeBytes;
+        task->beats = entry.beats;
+        task->stalls = entry.stalls;
+        task->loadPermille = getTaskLoad(entry.name);
+        task->state = entry.state;
+        task->stalled = entry.stalled;
+    }
+}
+
+static bool statsAppend(std::string *out, const char *format, ...) __attribute__((format(printf, 2, 3)));
+
+static bool statsAppend(std::string *out, const char *format, ...)
+{
+    char chunk[128]; // Large enough for any one piece we write
+    va_list args;
+
+    va_start(args, format);
+    int length = vsnprintf(chunk, sizeof(chunk), format, args);
+    va_end(args);
+
+    if ((length < 0) || (length >= (int)sizeof(chunk)) || ((out->size() + length) > out->capacity())) // Would need the heap
+        return false;
+
+    out->append(chunk, length);
+    return true;
+}
+
+bool System::serializeStats(const SYS_Stats *snapshot, std::string *out)
+{
+    bool ok = true;
+
+    out->clear(); // Keeps the capacity
+
+    ok = ok && statsAppend(out, "{\"version\":%d,\"uptime\":%ld,\"bootCount\":%ld,", snapshot->version, snapshot->uptimeSecs, snapshot->bootCount);
+    ok = ok && statsAppend(out, "\"heap\":{\"free\":%ld,\"minFree\":%ld,\"largestFree\":%ld,\"internalFree\":%ld,\"spiramFree\":%ld},", snapshot->heapFree,
+                           snapshot->heapMinFree, snapshot->heapLargestFree, snapshot->internalFree, snapshot->spiramFree);
+
+    ok = ok && statsAppend(out, "\"coreLoad\":[");
+    for (uint8_t core = 0; core < portNUM_PROCESSORS; core++)
+        ok = ok && statsAppend(out, "%s%d", (core == 0) ? "" : ",", snapshot->coreLoad[core]);
+
+    ok = ok && statsAppend(out, "],\"queues\":{\"system\":%d,\"wifi\":%d,\"display\":%d,\"i2c\":%d,\"spi\":%d},", snapshot->queueDepth[0], snapshot->queueDepth[1],
+                           snapshot->queueDepth[2], snapshot->queueDepth[3], snapshot->queueDepth[4]);
+    ok = ok && statsAppend(out, "\"wifi\":\"%s\",\"rtosTasks\":%d,", convertWifiStateToChars(snapshot->wifiConnState), snapshot->rtosTasks);
+    ok = ok && statsAppend(out, "\"nvs\":{\"used\":%ld,\"free\":%ld,\"namespaces\":%ld},", snapshot->nvsUsedEntries, snapshot->nvsFreeEntries, snapshot->nvsNamespaces);
+
+    ok = ok && statsAppend(out, "\"tasks\":[");
+    for (uint8_t i = 0; i < snapshot->taskCount; i++)
+    {
+        const SYS_StatsTask *task = &snapshot->tasks[i];
+        ok = ok && statsAppend(out, "%s{\"name\":\"%s\",\"stack\":%ld,\"minFree\":%ld,\"load\":%d,", (i == 0) ? "" : ",", task->name, task->stackBytes,
+                               task->minFreeBytes, (task->loadPermille == LOAD_UNKNOWN) ? -1 : task->loadPermille);
+        ok = ok && statsAppend(out, "\"beats\":%ld,\"state\":%d,\"stalls\":%ld,\"stalled\":%s}", task->beats, task->state, task->stalls, task->stalled ? "true" : "false");
+    }
+    ok = ok && statsAppend(out, "]}");
+
+    if (!ok)
+        out->clear(); // Half a document is of no use to a parser
+    return ok;
+}
@@ -0,0 +1,184 @@
+#include "system_.hpp"
+
+#include "esp_check.h"
+
+#include <algorithm>
+
+/* External Semaphores */
+extern SemaphoreHandle_t semSysRouteLock;
+extern SemaphoreHandle_t semNVSEntry;
+
+//
+// The task plan.  Every object creates its run task through createTask(), so the core, priority, and stack of all our tasks
+// are decided here, in one table, instead of in each constructor.  A pinned task is never migrated by the scheduler and
+// keeps its cache warm on its own core.
+//
+// Layout 0 is built in.  It keeps the network tasks on core 0 with the IDF Wifi and lwIP tasks, and the rest of our objects
+// on core 1.  A plan saved in NVS ("taskPlan" in the "system" namespace) replaces it from the next boot.  The placement test
+// (SYS_TEST_TYPE::TASK_PLACEMENT) steps through the built in layouts and watches each one with benchTaskPlan().
+//
+static const SYS_TaskPlacement taskLayouts[TASK_PLAN_LAYOUTS][(int)SYS_TASK::Count] = {
+    {
+        // 0: Network on core 0, everything else on core 1
+        {1, TASK_PRIORITY_MID, 0},             // System_Run
+        {1, TASK_PRIORITY_HIGH, 0},            // System_Timer
+        {TASK_ANY_CORE, TASK_PRIORITY_MID, 0}, // System_GPIO.  Only wakes for a button.
+        {1, TASK_PRIORITY_MID, 0},             // I2C_Run
+        {1, TASK_PRIORITY_MID, 0},             // SPI_Run
+        {1, TASK_PRIORITY_MID, 0},             // Display_Run
+        {0, TASK_PRIORITY_MID, 0},             // Wifi_Run
+        {0, TASK_PRIORITY_MID, 0},             // Prov_Run
+    },
+    {
+        // 1: Nothing pinned.  Shows what pinning alone is worth.
+        {TASK_ANY_CORE, TASK_PRIORITY_MID, 0},
+        {TASK_ANY_CORE, TASK_PRIORITY_HIGH, 0},
+        {TASK_ANY_CORE, TASK_PRIORITY_MID, 0},
+        {TASK_ANY_CORE, TASK_PRIORITY_MID, 0},
+        {TASK_ANY_CORE, TASK_PRIORITY_MID, 0},
+        {TASK_ANY_CORE, TASK_PRIORITY_MID, 0},
+        {TASK_ANY_CORE, TASK_PRIORITY_MID, 0},
+        {TASK_ANY_CORE, TASK_PRIORITY_MID, 0},
+    },
+    {
+        // 2: Layout 0 with the cores swapped.  The System and the other objects on core 0, the network tasks alone on core 1.
+        {0, TASK_PRIORITY_MID, 0},
+        {0, TASK_PRIORITY_HIGH, 0},
+        {TASK_ANY_CORE, TASK_PRIORITY_MID, 0},
+        {0, TASK_PRIORITY_MID, 0},
+        {0, TASK_PRIORITY_MID, 0},
+        {0, TASK_PRIORITY_MID, 0},
+        {1, TASK_PRIORITY_MID, 0},
+        {1, TASK_PRIORITY_MID, 0},
+    },
+};
+
+static const char *taskPlanNames[(int)SYS_TASK::Count] = {"sys_run", "sys_tmr", "sys_gpio", "I2C::Run", "SPI::Run", "disp_run", "wifi_run", "prov_run"};
+
+SYS_TaskPlacement System::taskPlan[(int)SYS_TASK::Count] = {};
+bool System::taskPlanFromNVS = false;
+
+BaseType_t System::createTask(SYS_TASK task, TaskFunction_t function, const char *name, uint8_t *stackSizeK, void *arg, TaskHandle_t *handle)
+{
+    const SYS_TaskPlacement *placement = taskPlanFromNVS ? &taskPlan[(int)task] : &taskLayouts[0][(int)task];
+
+    if (placement->stackSizeK != 0)
+        *stackSizeK = placement->stackSizeK; // The owner registers its task with this, so the stack tuner starts from the plan
+
+    return xTaskCreatePinnedToCore(function, name, 1024 * *stackSizeK, arg, placement->priority, handle,
+                                   (placement->core == TASK_ANY_CORE) ? tskNO_AFFINITY : placement->core);
+}
+
+bool System::applyTaskPlan(const SYS_TaskPlacement *plan)
+{
+    for (uint8_t i = 0; i < (uint8_t)SYS_TASK::Count; i++)
+    {
+        if ((plan[i].core != TASK_ANY_CORE) && ((plan[i].core < 0) || (plan[i].core >= portNUM_PROCESSORS)))
+            return false;
+
+        if ((plan[i].priority == 0) || (plan[i].priority >= configMAX_PRIORITIES))
+            return false;
+
+        if ((plan[i].stackSizeK != 0) && (plan[i].stackSizeK < LOG_STACK_MIN_K))
+            return false;
+    }
+
+    memcpy(taskPlan, plan, sizeof(taskPlan));
+    taskPlanFromNVS = true;
+    return true;
+}
+
+int8_t System::getTaskLayout(void)
+{
+    if (!taskPlanFromNVS)
+        return 0;
+
+    for (uint8_t layout = 0; layout < TASK_PLAN_LAYOUTS; layout++)
+    {
+        if (memcmp(taskPlan, taskLayouts[layout], sizeof(taskPlan)) == 0)
+            return layout;
+    }
+    return -1;
+}
+
+esp_err_t System::saveTaskLayout(uint8_t layout)
+{
+    esp_err_t ret = ESP_OK;
+
+    if (layout >= TASK_PLAN_LAYOUTS)
+        return ESP_ERR_INVALID_ARG;
+
+    if (nvs == nullptr)
+        nvs = NVS::getInstance();
+
+    if (xSemaphoreTake(semNVSEntry, portMAX_DELAY))
+    {
+        ESP_GOTO_ON_ERROR(nvs->openNVSStorage("system"), sys_saveTaskLayout_err, TAG, "nvs->openNVSStorage('system') failed");
+        ret = nvs->writeBlobToNVS("taskPlan", taskLayouts[layout], sizeof(taskLayouts[layout]));
+        nvs->closeNVStorage();
+        xSemaphoreGive(semNVSEntry);
+    }
+    return ret;
+
+sys_saveTaskLayout_err:
+    LOG_BY_VALUE(ESP_LOG_ERROR, semSysRouteLock, TAG, std::string(__func__) + "(): Error " + esp_err_to_name(ret));
+    xSemaphoreGive(semNVSEntry);
+    return ret;
+}
+
+void System::printTaskPlan(void)
+{
+    const SYS_TaskPlacement *plan = taskPlanFromNVS ? taskPlan : taskLayouts[0];
+
+    ESP_LOGW(TAG, "Task plan (%s, layout %d)", taskPlanFromNVS ? "from NVS" : "built in", getTaskLayout());
+
+    for (uint8_t i = 0; i < (uint8_t)SYS_TASK::Count; i++)
+    {
+        if (plan[i].core == TASK_ANY_CORE)
+            ESP_LOGW(TAG, "  %-9s  core any  priority %2d  stack %2dK", taskPlanNames[i], plan[i].priority, plan[i].stackSizeK);
+        else
+            ESP_LOGW(TAG, "  %-9s  core %d    priority %2d  stack %2dK", taskPlanNames[i], plan[i].core, plan[i].priority, plan[i].stackSizeK);
+    }
+}
+
+void System::benchTaskPlan(void)
+{
+    //
+    // FreeRTOS keeps no count of context switches.  Our run loops block between passes, so each heartbeat is one switch in
+    // and one out.  Together with the latency histograms, that tells us how busy and how responsive a layout is.  Loads are
+    // averaged over the samples taken while we wait (one every five seconds).
+    //
+    LOG_TaskEntry entry = {};
+    uint32_t beats[LOG_TASK_SLOTS] = {};
+    uint32_t firstSample = 0;
+    uint8_t samples = 0;
+    uint16_t load = 0;
+
+    printTaskPlan();
+
+    for (uint8_t i = 0; i < LOG_TASK_SLOTS; i++)
+    {
+        if (LOG_Tasks::getTaskEntry(i, &entry))
+            beats[i] = entry.beats;
+    }
+
+    LOG_Latency::resetLatency();
+    firstSample = getLoadSamples();
+    vTaskDelay(pdMS_TO_TICKS(TASK_BENCH_SECS * 1000));
+    samples = (uint8_t)std::min<uint32_t>(getLoadSamples() - firstSample, LOAD_HISTORY);
+
+    ESP_LOGW(TAG, "Layout %d over %d seconds (%d load samples):  core 0 %d permille  core 1 %d permille", getTaskLayout(), TASK_BENCH_SECS, samples,
+             getCoreLoadAverage(0, samples), getCoreLoadAverage(1, samples));
+    ESP_LOGW(TAG, "Task               wakes/s  load permille");
+
+    for (uint8_t i = 0; i < LOG_TASK_SLOTS; i++)
+    {
+        if (!LOG_Tasks::getTaskEntry(i, &entry) || (entry.beats == 0)) // Not supervised, so we can't count its passes
+            continue;
+
+        load = getTaskLoadAverage(entry.name, samples);
+        ESP_LOGW(TAG, "  %-16s  %7ld  %13d", entry.name, (entry.beats - beats[i]) / TASK_BENCH_SECS, (load == LOAD_UNKNOWN) ? -1 : load);
+    }
+
+    LOG_Latency::printLatency();
+}
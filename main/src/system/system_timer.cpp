@@ -2,6 +2,7 @@
 
 #include "esp_system.h"
 #include "esp_heap_caps.h"
+#include "esp_task_wdt.h"
 
 /* External Semaphores */
 extern SemaphoreHandle_t semSysRouteLock;
@@ -22,8 +23,9 @@ uint8_t oneMinuteCount = 6;
 //
 void System::initSysTimerTask(void)
 {
-    logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): timerStackSizeK: " + std::to_string(timerStackSizeK));
-    xTaskCreate(runSysTimerTaskMarshaller, "sys_tmr", 1024 * timerStackSizeK, this, TASK_PRIORITY_HIGH, &taskHandleRunSysTimer);
+    LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): timerStackSizeK: " + std::to_string(timerStackSizeK));
+    createTask(SYS_TASK::System_Timer, runSysTimerTaskMarshaller, "sys_tmr", &timerStackSizeK, this, &taskHandleRunSysTimer);
+    LOG_Tasks::registerTask(taskHandleRunSysTimer, 1024 * timerStackSizeK, &timerStackSizeK, "system", "timerStackSizeK");
 
     const esp_timer_create_args_t general_timer_args = {
         &System::sysTimerCallback, //
@@ -36,6 +38,11 @@ void System::initSysTimerTask(void)
     esp_err_t ret = ESP_OK;
     ESP_GOTO_ON_ERROR(esp_timer_create(&general_timer_args, &handleTimer), sys_initSysTimer_err, TAG, "esp_timer_create() failed");
     ESP_GOTO_ON_ERROR(esp_timer_start_periodic(handleTimer, TIMER_PERIOD_10Hz), sys_initSysTimer_err, TAG, "esp_timer_create() failed");
+
+#if LIVENESS_TASK_WDT
+    // From here on, a stalled run loop (or a stalled timer task) ends in a task watchdog reset.  The error journal keeps the stall report.
+    ESP_GOTO_ON_ERROR(esp_task_wdt_add(taskHandleRunSysTimer), sys_initSysTimer_err, TAG, "esp_task_wdt_add() failed");
+#endif
     return;
 
 sys_initSysTimer_err:
@@ -56,6 +63,7 @@ void System::runSysTimerTaskMarshaller(void *arg)
 {
     ((System *)arg)->runSysTimerTask();
     ((System *)arg)->taskHandleRunSysTimer = nullptr; // This doesn't happen automatically but we look at this variable for validity, so set it manually.
+    LOG_Tasks::unregisterTask(nullptr);
     vTaskDelete(NULL);
 }
 
@@ -139,22 +147,31 @@ void System::halfSecondActions(void)
 void System::oneSecondActions(void)
 {
     if (showSys & _showSysTimerSeconds)
-        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): One Second");
+        LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): One Second");
 
     //
     // When we are working with multiple variables at the same time, we don't want 'save to NVS' being called too quickly.
     // Allow a save even if we are in the process of reboot count-down.
     //
-    if (lockGetUint8(&saveToNVSDelaySecs) > 0)
+    if (saveToNVSDelaySecs.get() > 0)
+    {
+        if (saveToNVSDelaySecs.decrement() < 1)
+            setPending(&saveToNVSFlag);
+    }
+
+    setPending(&heapCheckFlag); // One region of the incremental heap check.  The full check (_diagHeapCheck) is now on demand only.
+
+    if (!superviseRunLoops()) // Checked here rather than in run(), which may itself be the loop that is stuck
     {
-        if (lockDecrementUint8(&saveToNVSDelaySecs) < 1)
-            lockSetBool(&saveToNVSFlag, true);
+#if LIVENESS_TASK_WDT
+        esp_task_wdt_reset();
+#endif
     }
 
     /* Reboot Request */
     if (rebootTimerSec > 0) // Currently, in this project, we don't invoke a reboot, but we will someday.
     {
-        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): Reboot in " + std::to_string(rebootTimerSec));
+        LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): Reboot in " + std::to_string(rebootTimerSec));
         if (--rebootTimerSec < 1)
             esp_restart(); // Reboot
         else
@@ -165,19 +182,44 @@ void System::oneSecondActions(void)
 void System::fiveSecondActions(void)
 {
     if (showSys & _showSysTimerSeconds)
-        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): Five Seconds");
+        LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): Five Seconds");
+
+    setPending(&loadSampleFlag);
 }
 
 void System::tenSecondActions(void)
 {
     if (showSys & _showSysTimerSeconds)
-        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): Ten Seconds");
+        LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): Ten Seconds");
 
-    lockOrUint8(&diagSys, _diagHeapCheck); // Set the diag bit to run the heap_caps_check_integrity_all(true) test
+    if (journalFlushDue()) // Checking only every ten seconds also limits how often we can write to flash.
+        setPending(&journalFlushFlag);
+
+    if (!bootProfileSaved.get() && (esp_timer_get_time() >= (BOOT_PROFILE_NETWORK_WAIT_SECS * 1000000LL))) // No network this boot
+        setPending(&bootProfileFlag);
 }
 
 void System::oneMinuteActions(void)
 {
     if (showSys & _showSysTimerMinutes)
-        logByValue(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): One Minute");
-}
\ No newline at end of file
+        LOG_BY_VALUE(ESP_LOG_INFO, semSysRouteLock, TAG, std::string(__func__) + "(): One Minute");
+
+    setPending(&stackTuneFlag); // Sample every registered stack and persist any size that needs to change
+}
+bool System::superviseRunLoops(void)
+{
+    LOG_TaskEntry entry = {};
+    int64_t nowUs = esp_timer_get_time();
+    bool stalled = false;
+
+    for (uint8_t i = 0; i < LOG_TASK_SLOTS; i++)
+    {
+        entry = {};
+        if (LOG_Tasks::checkHeartbeat(i, nowUs, &entry))
+            LOG_PRINTF(ESP_LOG_ERROR, semSysRouteLock, TAG, "Run loop %s stalled in state %d.  No pass for %lld ms, allowed %ld ms", entry.name, entry.state,
+                       (nowUs - entry.lastBeatUs) / 1000, entry.maxPeriodMs);
+
+        stalled |= entry.stalled;
+    }
+    return stalled;
+}
@@ -3,10 +3,6 @@
 #include "esp_efuse.h"
 #include "esp_efuse_table.h"
 
-/* Local Semaphores */
-SemaphoreHandle_t semSysBoolLock = NULL;
-SemaphoreHandle_t semSysUint8Lock = NULL;
-
 const char *System::convertWifiStateToChars(uint8_t state)
 {
     const char *rc = nullptr;
@@ -43,76 +39,66 @@ std::string System::getDeviceID()
     return id.str();
 }
 
-uint8_t System::lockGetUint8(uint8_t *variable)
+void System::setPending(SYS_Flag *flag)
 {
-    uint8_t value = 0;
-    if (xSemaphoreTake(semSysUint8Lock, portMAX_DELAY))
-    {
-        value = *variable; // Dereference and return the value
-        xSemaphoreGive(semSysUint8Lock);
-    }
-    return value;
-}
+    flag->set(true);
 
-/* Variable Locking */
-void System::lockSetBool(bool *variable, bool value)
-{
-    if (xSemaphoreTake(semSysBoolLock, portMAX_DELAY))
-    {
-        *variable = value; // Dereference and set the value
-        xSemaphoreGive(semSysBoolLock);
-    }
+    if (taskHandleSystemRun != nullptr)
+        xTaskNotify(taskHandleSystemRun, SYS_WAKE_PENDING, eSetBits);
 }
 
-bool System::lockGetBool(bool *variable)
+//
+// Several Wifi notifications may be waiting at once, and bits don't remember the order they were sent in.  The lifecycle does:
+// CONNECTING, CONNECTED, DISCONNECTING, DISCONNECTED and around again.  So the next one is the first pending after the state we
+// are in.  Replaying them this way, we pass through every state Wifi went through and end up where Wifi is now.
+//
+// A bit which is sent again before we take it is only seen once.  If Wifi goes around the whole lifecycle more than once
+// between two of our wakes, we replay one lap, not every lap.  That is acceptable because every handler only sets the state,
+// publishes it and starts or stops the log stream, all of which depend on where Wifi is, not on how often it got there.  A
+// handler which counts transitions would need a counter per bit instead.
+//
+SYS_NOTIFY System::takeNotify(uint32_t *pending)
 {
-    bool value = false;
-    if (xSemaphoreTake(semSysBoolLock, portMAX_DELAY))
-    {
-        value = *variable; // Dereference and return the value
-        xSemaphoreGive(semSysBoolLock);
-    }
-    return value;
-}
+    uint8_t current = 0; // Bit index of the state we are in.  Its successor is checked first.
+    uint32_t bit = 0;
 
-void System::lockOrUint8(uint8_t *variable, uint8_t value)
-{
-    if (xSemaphoreTake(semSysUint8Lock, portMAX_DELAY))
+    switch (sysWifiConnState)
     {
-        *variable |= value; // Dereference and set the value
-        xSemaphoreGive(semSysUint8Lock);
+    case WIFI_CONN_STATE::WIFI_CONNECTING_STA:
+        current = 0;
+        break;
+    case WIFI_CONN_STATE::WIFI_CONNECTED_STA:
+        current = 1;
+        break;
+    case WIFI_CONN_STATE::WIFI_DISCONNECTING_STA:
+        current = 2;
+        break;
+    default:
+        current = 3;
+        break;
     }
-}
 
-void System::lockAndUint8(uint8_t *variable, uint8_t value)
-{
-    if (xSemaphoreTake(semSysUint8Lock, portMAX_DELAY))
-    {
-        *variable &= value; // Dereference and set the value
-        xSemaphoreGive(semSysUint8Lock);
-    }
-}
+    for (uint8_t step = 1; (step <= 4) && (bit == 0); step++)
+        bit = *pending & (1 << ((current + step) & 0x03));
 
-void System::lockSetUint8(uint8_t *variable, uint8_t value)
-{
-    if (xSemaphoreTake(semSysUint8Lock, portMAX_DELAY))
-    {
-        *variable = value; // Dereference and set the value
-        xSemaphoreGive(semSysUint8Lock);
-    }
+    if (bit == 0) // No Wifi lifecycle bits left.  Any others are taken lowest first.
+        bit = *pending & (~*pending + 1);
+
+    *pending &= ~bit;
+    return static_cast<SYS_NOTIFY>(bit);
 }
 
-uint8_t System::lockDecrementUint8(uint8_t *variable)
+void System::publishConnectivity(void)
 {
-    uint8_t value = 0;
-    if (xSemaphoreTake(semSysUint8Lock, portMAX_DELAY))
-    {
-        value = *variable;
-        if (value > 0)
-            value--;
+    BUS_Message *msg = bus->acquire(BUS_TOPIC::Connectivity);
 
-        *variable = value;
-        xSemaphoreGive(semSysUint8Lock);
+    if (msg == nullptr)
+    {
+        LOG_LIMITED(ESP_LOG_WARN, semSysRouteLock, TAG, "Bus pool is empty.  Connectivity not published.");
+        return;
     }
-    return value;
-}
\ No newline at end of file
+
+    msg->connectivity.connected = (sysWifiConnState == WIFI_CONN_STATE::WIFI_CONNECTED_STA);
+    msg->connectivity.wifiConnState = (uint8_t)sysWifiConnState;
+    bus->publish(msg);
+}
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+#
+# Graphs the heap drift of an object lifecycle soak.
+#
+# The soak (GPIO test LIFE_CYCLE_CREATE, index 1) creates and destroys the Wifi object LIFECYCLE_SOAK_CYCLES times and every
+# LIFECYCLE_SOAK_REPORT cycles prints a line like:
+#
+#   #S <cycle>,<bytes>,<blocks>,<largestFree>,<wifiBytes>
+#
+# where bytes and blocks are the heap still allocated compared with the start of the soak, and wifiBytes is the share of that
+# charged to the Wifi component.  A flat line means no leak.  A steady climb is a leak of about (slope) bytes per cycle.
+#
+# Usage:
+#   idf.py monitor | tee capture.txt
+#   python3 tools/heap_drift.py capture.txt
+#   python3 tools/heap_drift.py --column largestFree < capture.txt
+#
+import argparse
+import sys
+
+PREFIX = "#S "
+COLUMNS = ("cycle", "bytes", "blocks", "largestFree", "wifiBytes")
+
+
+def read_samples(lines):
+    samples = []
+    for line in lines:
+        start = line.find(PREFIX)
+        if start < 0:
+            continue
+
+        fields = line[start + len(PREFIX):].strip().split(",")
+        if len(fields) != len(COLUMNS) or not fields[0].isdigit():
+            continue  # The header line, or a line cut short by other output
+
+        samples.append(dict(zip(COLUMNS, (int(field) for field in fields))))
+    return samples
+
+
+def plot(samples, column, height, width):
+    values = [sample[column] for sample in samples]
+    low = min(values)
+    high = max(values)
+    span = max(high - low, 1)
+
+    step = max(1, (len(samples) + width - 1) // width)  # Thin the samples so one column is one character
+    shown = samples[::step]
+
+    rows = []
+    for row in range(height, -1, -1):
+        level = low + (span * row) / height
+        cells = "".join("*" if round((sample[column] - low) * height / span) == row else " " for sample in shown)
+        rows.append("%10d | %s" % (level, cells))
+
+    rows.append("%10s +-%s" % ("", "-" * len(shown)))
+    rows.append("%10s   cycle %d .. %d" % ("", shown[0]["cycle"], shown[-1]["cycle"]))
+    return "\n".join(rows)
+
+
+def slope(samples, column):
+    count = len(samples)
+    if count < 2:
+        return 0.0
+
+    mean_x = sum(sample["cycle"] for sample in samples) / count
+    mean_y = sum(sample[column] for sample in samples) / count
+    spread = sum((sample["cycle"] - mean_x) ** 2 for sample in samples)
+    if spread == 0:
+        return 0.0
+
+    return sum((sample["cycle"] - mean_x) * (sample[column] - mean_y) for sample in samples) / spread
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Graph the '#S' heap drift lines of a lifecycle soak.")
+    parser.add_argument("capture", nargs="?", help="console capture (stdin if left out)")
+    parser.add_argument("--column", default="bytes", choices=COLUMNS[1:], help="value to graph")
+    parser.add_argument("--height", type=int, default=16, help="rows in the chart")
+    parser.add_argument("--width", type=int, default=64, help="most columns in the chart")
+    options = parser.parse_args()
+
+    source = open(options.capture, errors="replace") if options.capture else sys.stdin
+    samples = read_samples(source)
+
+    if not samples:
+        print("No '#S' lines found.")
+        return 1
+
+    print(plot(samples, options.column, options.height, options.width))
+    print()
+    print("%s: %d at cycle %d, %d at cycle %d, trend %.1f per cycle" % (options.column, samples[0][options.column], samples[0]["cycle"],
+                                                                        samples[-1][options.column], samples[-1]["cycle"], slope(samples, options.column)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,60 @@
+#!/usr/bin/env python3
+#
+# Host side collector for the network log stream.
+#
+# Once the device has an IP address, the System object calls LOG_Stream::startLogStream() with LOG_STREAM_COLLECTOR_IP and
+# LOG_STREAM_COLLECTOR_PORT (see system_defs.hpp).  The log drainer then sends UDP frames of up to LOG_STREAM_FRAME_SIZE bytes,
+# one record per line.  Besides ordinary log lines, a frame may hold:
+#
+#   #LB ...                                                   a deferred binary record (decoded with log_decoder.py)
+#   #D <count> records lost                                   frames the device dropped because the link was down or busy
+#   #M <timeStamp> <ringDropped> <suppressed> <streamLost> <logHeapAllocs> <transitions>
+#
+# Usage:
+#   python3 tools/log_collector.py                        (listens on 0.0.0.0:5140)
+#   python3 tools/log_collector.py --port 5140 --root . | tee capture.txt
+#
+import argparse
+import os
+import socket
+import sys
+
+from log_decoder import build_table, decode_line
+
+METRIC_NAMES = ("ringDropped", "suppressed", "streamLost", "logHeapAllocs", "transitions")
+
+
+def format_line(line, table, source):
+    fields = line.split()
+
+    if len(fields) >= 2 and fields[0] == "#M":
+        values = " ".join("%s=%s" % (name, value) for name, value in zip(METRIC_NAMES, fields[2:]))
+        return "M (%s) %s metrics: %s\n" % (fields[1], source, values)
+
+    if len(fields) >= 2 and fields[0] == "#D":
+        return "-- %s: %s records lost on the device --\n" % (source, fields[1])
+
+    return decode_line(line + "\n", table)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Receive and print the UDP log stream from one or more devices.")
+    parser.add_argument("--bind", default="0.0.0.0", help="address to listen on")
+    parser.add_argument("--port", type=int, default=5140, help="UDP port (LOG_STREAM_COLLECTOR_PORT)")
+    parser.add_argument("--root", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."), help="project root to scan")
+    options = parser.parse_args()
+
+    table = build_table(options.root)
+    listener = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    listener.bind((options.bind, options.port))
+
+    while True:
+        frame, (address, _) = listener.recvfrom(2048)
+        for line in frame.decode("utf-8", errors="replace").splitlines():
+            if line:
+                sys.stdout.write(format_line(line, table, address))
+        sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+#
+# Host side decoder for deferred (binary) log records.
+#
+# When Logging::setLogBinaryOutput(true) is in effect, every LOG_DEFERRED() record reaches the console as a line like:
+#
+#   #LB <timeStamp> <level> <tag> <msgId> <argCount> [<arg>...]     (all numbers in hex)
+#
+# The message ID is the FNV-1a hash of "<source file name>|<format>", computed at compile time in logging_.hpp.  We build the same
+# table here by scanning the sources for LOG_DEFERRED() and LOG_LIMITED() calls, so no extra build step is needed.  Lines that are
+# not binary records are passed through unchanged.
+#
+# Usage:
+#   idf.py monitor | tee capture.txt
+#   python3 tools/log_decoder.py capture.txt
+#   python3 tools/log_decoder.py --root . < capture.txt
+#
+import argparse
+import os
+import re
+import sys
+
+BINARY_PREFIX = "#LB"
+LEVEL_LETTERS = {1: "E", 2: "W", 3: "I", 4: "D", 5: "V"}
+
+CALL_RE = re.compile(r'LOG_(?:DEFERRED|LIMITED)\(\s*[^,]+,\s*[^,]+,\s*[^,]+,\s*"((?:[^"\\]|\\.)*)"')
+FUNC_RE = re.compile(r'^[A-Za-z_][\w:<>\s\*&]*?\b(\w+)::(\w+)\s*\([^;]*$')
+
+
+def fnv1a(text):
+    hash = 2166136261
+    for byte in text.encode("utf-8"):
+        hash ^= byte
+        hash = (hash * 16777619) & 0xFFFFFFFF
+    return hash
+
+
+def build_table(root):
+    table = {}
+
+    for folder, _, files in os.walk(root):
+        if "build" in folder.split(os.sep):
+            continue
+
+        for name in files:
+            if not name.endswith((".cpp", ".hpp", ".c", ".h")):
+                continue
+
+            func = "?"
+            with open(os.path.join(folder, name), encoding="utf-8", errors="replace") as source:
+                for line in source:
+                    found = FUNC_RE.match(line)
+                    if found:
+                        func = found.group(2)
+
+                    for format in CALL_RE.findall(line):
+                        format = bytes(format, "utf-8").decode("unicode_escape")
+                        table[fnv1a(name + "|" + format)] = (func, format)
+
+    return table
+
+
+def to_signed(word):
+    return word - 0x100000000 if word & 0x80000000 else word
+
+
+def decode_line(line, table):
+    fields = line.split()
+
+    if len(fields) < 6 or fields[0] != BINARY_PREFIX:
+        return line
+
+    timeStamp = int(fields[1], 16)
+    level = LEVEL_LETTERS.get(int(fields[2]), "?")
+    tag = fields[3]
+    msgId = int(fields[4], 16)
+    args = [int(word, 16) for word in fields[6:6 + int(fields[5], 16)]]
+
+    if msgId not in table:
+        return "%s (%d) %s: <unknown message id %08x> %s\n" % (level, timeStamp, tag, msgId, " ".join(fields[6:]))
+
+    func, format = table[msgId]
+    conversions = re.findall(r"%[-+ #0]*\d*(?:\.\d+)?[hlLqjzt]*([diouxXc])", format)
+    values = tuple(to_signed(word) if conversion in "di" else word for word, conversion in zip(args, conversions))  # Words are unsigned on the wire
+
+    try:
+        text = format % values
+    except (TypeError, ValueError):
+        text = format + " " + " ".join(str(value) for value in values)
+
+    return "%s (%d) %s: %s(): %s\n" % (level, timeStamp, tag, func, text)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode deferred binary log records captured from the console.")
+    parser.add_argument("capture", nargs="?", help="captured console output (default: stdin)")
+    parser.add_argument("--root", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), ".."), help="project root to scan")
+    options = parser.parse_args()
+
+    table = build_table(options.root)
+    stream = open(options.capture, encoding="utf-8", errors="replace") if options.capture else sys.stdin
+
+    for line in stream:
+        sys.stdout.write(decode_line(line, table))
+
+
+if __name__ == "__main__":
+    main()
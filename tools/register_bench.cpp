@@ -0,0 +1,169 @@
+//
+// Host microbenchmark for SYS_Register (main/include/system/system_register.hpp).
+//
+//   g++ -O2 -std=gnu++2b -pthread -I main/include/system tools/register_bench.cpp -o register_bench && ./register_bench
+//
+// The System's timer task raises flags and counts down delays, and its run task reads and clears them.  Both used to take a
+// binary semaphore around every one-byte access.  This times the same mix of operations both ways: once with a binary
+// semaphore (modelled here with a mutex and a condition variable, as a FreeRTOS take can block) and once with SYS_Register.
+// It runs with one thread, and again with a "timer" and a "run" thread on the same variables.
+//
+// The absolute numbers belong to the host.  On the target, each semaphore take and give is a kernel call with a critical
+// section, so the gap there is wider.
+//
+#include "system_register.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+static constexpr uint32_t ITERATIONS = 2000000;
+
+class BinarySemaphore // xSemaphoreTake() / xSemaphoreGive() with portMAX_DELAY
+{
+public:
+    void take(void)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this] { return available; });
+        available = false;
+    }
+
+    void give(void)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            available = true;
+        }
+        cv.notify_one();
+    }
+
+private:
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool available = true;
+};
+
+struct Locked // The lockGetBool() family
+{
+    BinarySemaphore semBool;
+    BinarySemaphore semUint8;
+    bool flag = false;
+    uint8_t bits = 0;
+    uint8_t delay = 0;
+
+    void timerPass(void)
+    {
+        semBool.take();
+        flag = true;
+        semBool.give();
+
+        semUint8.take();
+        bits |= 0x04;
+        semUint8.give();
+
+        semUint8.take();
+        if (delay > 0)
+            delay--;
+        semUint8.give();
+    }
+
+    uint32_t runPass(void)
+    {
+        bool value = false;
+        uint8_t diag = 0;
+
+        semBool.take();
+        value = flag;
+        semBool.give();
+
+        if (value)
+        {
+            semBool.take();
+            flag = false;
+            semBool.give();
+        }
+
+        semUint8.take();
+        diag = bits;
+        semUint8.give();
+
+        semUint8.take();
+        bits &= (uint8_t)~0x04;
+        semUint8.give();
+        return value + diag;
+    }
+};
+
+struct Atomic // SYS_Register
+{
+    SYS_Flag flag;
+    SYS_Register<uint8_t> bits;
+    SYS_Register<uint8_t> delay;
+
+    void timerPass(void)
+    {
+        flag.set(true);
+        bits.setBits(0x04);
+        delay.decrement();
+    }
+
+    uint32_t runPass(void)
+    {
+        uint32_t value = flag.take();
+        uint8_t diag = bits.get();
+
+        bits.clearBits(0x04);
+        return value + diag;
+    }
+};
+
+template <typename T>
+static double benchSingle(void)
+{
+    T registers;
+    volatile uint32_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < ITERATIONS; i++)
+    {
+        registers.timerPass();
+        sink = sink + registers.runPass();
+    }
+
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / ITERATIONS;
+}
+
+template <typename T>
+static double benchShared(void)
+{
+    T registers;
+    volatile uint32_t sink = 0;
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread timer([&registers] {
+        for (uint32_t i = 0; i < ITERATIONS; i++)
+            registers.timerPass();
+    });
+
+    for (uint32_t i = 0; i < ITERATIONS; i++)
+        sink = sink + registers.runPass();
+
+    timer.join();
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / ITERATIONS;
+}
+
+int main(void)
+{
+    double lockedSingle = benchSingle<Locked>();
+    double atomicSingle = benchSingle<Atomic>();
+    double lockedShared = benchShared<Locked>();
+    double atomicShared = benchShared<Atomic>();
+
+    printf("ns per timer pass + run pass      semaphore   SYS_Register   speedup\n");
+    printf("  one thread                      %9.1f   %12.1f   %6.1fx\n", lockedSingle, atomicSingle, lockedSingle / atomicSingle);
+    printf("  timer and run threads           %9.1f   %12.1f   %6.1fx\n", lockedShared, atomicShared, lockedShared / atomicShared);
+    return 0;
+}
@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+#
+# Pulls the Chrome trace printed by LOG_Trace::exportTrace() out of a console capture.
+#
+# exportTrace() (GPIO test LOGGING, index 3) prints one JSON document between "#TRACE-BEGIN" and "#TRACE-END".  It holds the
+# LOG_TraceSpan events (one row per registered task) and one row per state machine built from the LOG_StateStep<> transitions.
+# Open the file written here in ui.perfetto.dev or chrome://tracing.  Step numbers are the values of the step enumerations
+# (SYS_INIT, WIFI_CONN, ...).
+#
+# Usage:
+#   idf.py monitor | tee capture.txt
+#   python3 tools/trace_extract.py capture.txt                 (writes trace.json, the last trace in the capture)
+#   python3 tools/trace_extract.py capture.txt --all -o boot   (writes boot_1.json, boot_2.json, ...)
+#
+import argparse
+import json
+import re
+import sys
+
+BEGIN = "#TRACE-BEGIN"
+END = "#TRACE-END"
+LOG_LINE_RE = re.compile(r"^(\x1b\[[0-9;]*m)?[EWIDV] \(\d+\) ")  # A log line which slipped in while the trace was printing
+
+
+def extract(lines):
+    traces = []
+    body = None
+
+    for line in lines:
+        if BEGIN in line:
+            body = []
+        elif END in line and body is not None:
+            traces.append("".join(body))
+            body = None
+        elif body is not None and not LOG_LINE_RE.match(line):
+            body.append(line)
+    return traces
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Write the Chrome traces found in a console capture to JSON files.")
+    parser.add_argument("capture", nargs="?", help="console capture (stdin if left out)")
+    parser.add_argument("-o", "--output", default="trace", help="output file name, without .json")
+    parser.add_argument("--all", action="store_true", help="write every trace found, not only the last one")
+    options = parser.parse_args()
+
+    source = open(options.capture, errors="replace") if options.capture else sys.stdin
+    traces = extract(source)
+
+    if not traces:
+        print("No trace found between %s and %s." % (BEGIN, END))
+        return 1
+
+    chosen = list(enumerate(traces, 1)) if options.all else [(None, traces[-1])]
+    for number, text in chosen:
+        trace = json.loads(text)  # Fails loudly on a damaged capture rather than writing a file the viewer rejects
+        name = "%s_%d.json" % (options.output, number) if number else options.output + ".json"
+        with open(name, "w") as output:
+            json.dump(trace, output)
+        spans = sum(1 for event in trace["traceEvents"] if event.get("ph") == "X")
+        print("%s: %d spans" % (name, spans))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())